@@ -26,4 +26,6 @@
 #include "oneapi/mkl/lapack.hpp"
 #include "oneapi/mkl/rng.hpp"
 
+#include "oneapi/mkl/preload.hpp"
+
 #endif //_ONEMKL_HPP_
@@ -43,6 +43,9 @@ namespace mkl {
 enum class device : uint16_t { x86cpu, intelgpu, nvidiagpu, amdgpu };
 enum class domain : uint16_t { blas, lapack, rng };
 
+// Number of values of device; must follow the last enumerator.
+constexpr std::size_t num_devices = static_cast<std::size_t>(device::amdgpu) + 1;
+
 static std::map<domain, std::map<device, std::vector<const char*>>> libraries = {
     { domain::blas,
       { { device::x86cpu,
@@ -26,6 +26,8 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include <vector>
+
 #include "oneapi/mkl/detail/backends_table.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 
@@ -40,7 +42,11 @@
 namespace oneapi {
 namespace mkl {
 
-inline oneapi::mkl::device get_device_id(sycl::queue &queue) {
+namespace detail {
+
+// Classifies the device of queue. This takes several SYCL runtime queries;
+//  use get_device_id, which caches the result.
+inline oneapi::mkl::device query_device_id(sycl::queue &queue) {
     oneapi::mkl::device device_id;
     if (queue.is_host())
         device_id = device::x86cpu;
@@ -66,6 +72,33 @@ inline oneapi::mkl::device get_device_id(sycl::queue &queue) {
     return device_id;
 }
 
+// Maximum number of devices remembered by each thread.
+constexpr std::size_t device_id_cache_size = 8;
+
+} // namespace detail
+
+inline oneapi::mkl::device get_device_id(sycl::queue &queue) {
+    if (queue.is_host())
+        return device::x86cpu;
+    // Each thread remembers the devices it has already classified, so a call
+    //  on a known device costs a get_device and a few comparisons.
+    struct cache_entry {
+        sycl::device device;
+        oneapi::mkl::device device_id;
+    };
+    thread_local std::vector<cache_entry> cache;
+    sycl::device queue_device = queue.get_device();
+    for (const auto &entry : cache) {
+        if (entry.device == queue_device)
+            return entry.device_id;
+    }
+    oneapi::mkl::device device_id = detail::query_device_id(queue);
+    if (cache.size() == detail::device_id_cache_size)
+        cache.erase(cache.begin());
+    cache.push_back({ queue_device, device_id });
+    return device_id;
+}
+
 } //namespace mkl
 } //namespace oneapi
 
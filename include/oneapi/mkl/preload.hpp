@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_PRELOAD_HPP_
+#define _ONEMKL_PRELOAD_HPP_
+
+#include "oneapi/mkl/detail/backends_table.hpp"
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+
+// Loads and validates the backends of domain_id for device_id ahead of the
+//  first run-time dispatched call, so that the library loads are not timed as
+//  part of that call. Throws the exception the first call would have thrown
+//  when no backend can be loaded, and oneapi::mkl::backend_not_found when the
+//  domain is not part of the library. Setting the ONEMKL_PRELOAD environment variable
+//  preloads all configured backends when the library is loaded instead;
+//  ONEMKL_PRELOAD=verbose also reports the load time of every backend library.
+ONEMKL_EXPORT void preload(oneapi::mkl::domain domain_id, oneapi::mkl::device device_id);
+
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_PRELOAD_HPP_
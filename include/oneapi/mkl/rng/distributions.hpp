@@ -20,8 +20,12 @@
 #ifndef _ONEMKL_RNG_DISTRIBUTIONS_HPP_
 #define _ONEMKL_RNG_DISTRIBUTIONS_HPP_
 
+#include <cmath>
 #include <cstdint>
 #include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
 #if __has_include(<sycl/sycl.hpp>)
 #include <sycl/sycl.hpp>
 #else
@@ -256,6 +260,328 @@ private:
     RealType scale_;
 };
 
+// Class template oneapi::mkl::rng::exponential
+//
+// Represents continuous exponential random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::exponential_method::icdf
+//      oneapi::mkl::rng::exponential_method::icdf_accurate
+//
+// Input arguments:
+//      a    - displacement. 0.0 by default
+//      beta - scalefactor. 1.0 by default
+
+namespace exponential_method {
+struct icdf {};
+struct icdf_accurate {};
+using by_default = icdf;
+} // namespace exponential_method
+
+template <typename RealType = float, typename Method = exponential_method::by_default>
+class exponential {
+public:
+    static_assert(std::is_same<Method, exponential_method::icdf>::value ||
+                      std::is_same<Method, exponential_method::icdf_accurate>::value,
+                  "rng exponential distribution method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "rng exponential distribution type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+
+    exponential() : exponential(static_cast<RealType>(0.0), static_cast<RealType>(1.0)) {}
+
+    explicit exponential(RealType a, RealType beta) : a_(a), beta_(beta) {
+        if (beta <= static_cast<RealType>(0.0)) {
+            throw oneapi::mkl::invalid_argument("rng", "exponential", "beta <= 0");
+        }
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType beta() const {
+        return beta_;
+    }
+
+private:
+    RealType a_;
+    RealType beta_;
+};
+
+// Class template oneapi::mkl::rng::gamma
+//
+// Represents continuous gamma random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::gamma_method::marsaglia - Marsaglia-Tsang method
+//      oneapi::mkl::rng::gamma_method::marsaglia_accurate
+//
+// Input arguments:
+//      alpha - shape. 1.0 by default
+//      a     - displacement. 0.0 by default
+//      beta  - scalefactor. 1.0 by default
+
+namespace gamma_method {
+struct marsaglia {};
+struct marsaglia_accurate {};
+using by_default = marsaglia;
+} // namespace gamma_method
+
+template <typename RealType = float, typename Method = gamma_method::by_default>
+class gamma {
+public:
+    static_assert(std::is_same<Method, gamma_method::marsaglia>::value ||
+                      std::is_same<Method, gamma_method::marsaglia_accurate>::value,
+                  "rng gamma distribution method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "rng gamma distribution type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+
+    gamma()
+            : gamma(static_cast<RealType>(1.0), static_cast<RealType>(0.0),
+                    static_cast<RealType>(1.0)) {}
+
+    explicit gamma(RealType alpha, RealType a, RealType beta) : alpha_(alpha), a_(a), beta_(beta) {
+        if (alpha <= static_cast<RealType>(0.0)) {
+            throw oneapi::mkl::invalid_argument("rng", "gamma", "alpha <= 0");
+        }
+        if (beta <= static_cast<RealType>(0.0)) {
+            throw oneapi::mkl::invalid_argument("rng", "gamma", "beta <= 0");
+        }
+    }
+
+    RealType alpha() const {
+        return alpha_;
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType beta() const {
+        return beta_;
+    }
+
+private:
+    RealType alpha_;
+    RealType a_;
+    RealType beta_;
+};
+
+// Class template oneapi::mkl::rng::beta
+//
+// Represents continuous beta random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::beta_method::cja - Cheng, Johnk and Atkinson methods
+//      oneapi::mkl::rng::beta_method::cja_accurate
+//
+// Input arguments:
+//      p - shape. 1.0 by default
+//      q - shape. 1.0 by default
+//      a - displacement. 0.0 by default
+//      b - scalefactor. 1.0 by default
+
+namespace beta_method {
+struct cja {};
+struct cja_accurate {};
+using by_default = cja;
+} // namespace beta_method
+
+template <typename RealType = float, typename Method = beta_method::by_default>
+class beta {
+public:
+    static_assert(std::is_same<Method, beta_method::cja>::value ||
+                      std::is_same<Method, beta_method::cja_accurate>::value,
+                  "rng beta distribution method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "rng beta distribution type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+
+    beta()
+            : beta(static_cast<RealType>(1.0), static_cast<RealType>(1.0),
+                   static_cast<RealType>(0.0), static_cast<RealType>(1.0)) {}
+
+    explicit beta(RealType p, RealType q, RealType a, RealType b) : p_(p), q_(q), a_(a), b_(b) {
+        if (p <= static_cast<RealType>(0.0)) {
+            throw oneapi::mkl::invalid_argument("rng", "beta", "p <= 0");
+        }
+        if (q <= static_cast<RealType>(0.0)) {
+            throw oneapi::mkl::invalid_argument("rng", "beta", "q <= 0");
+        }
+        if (b <= static_cast<RealType>(0.0)) {
+            throw oneapi::mkl::invalid_argument("rng", "beta", "b <= 0");
+        }
+    }
+
+    RealType p() const {
+        return p_;
+    }
+
+    RealType q() const {
+        return q_;
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType b() const {
+        return b_;
+    }
+
+private:
+    RealType p_;
+    RealType q_;
+    RealType a_;
+    RealType b_;
+};
+
+// Class template oneapi::mkl::rng::cauchy
+//
+// Represents continuous Cauchy random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::cauchy_method::icdf
+//
+// Input arguments:
+//      a - displacement. 0.0 by default
+//      b - scalefactor. 1.0 by default
+
+namespace cauchy_method {
+struct icdf {};
+using by_default = icdf;
+} // namespace cauchy_method
+
+template <typename RealType = float, typename Method = cauchy_method::by_default>
+class cauchy {
+public:
+    static_assert(std::is_same<Method, cauchy_method::icdf>::value,
+                  "rng cauchy distribution method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "rng cauchy distribution type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+
+    cauchy() : cauchy(static_cast<RealType>(0.0), static_cast<RealType>(1.0)) {}
+
+    explicit cauchy(RealType a, RealType b) : a_(a), b_(b) {
+        if (b <= static_cast<RealType>(0.0)) {
+            throw oneapi::mkl::invalid_argument("rng", "cauchy", "b <= 0");
+        }
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType b() const {
+        return b_;
+    }
+
+private:
+    RealType a_;
+    RealType b_;
+};
+
+// Class template oneapi::mkl::rng::weibull
+//
+// Represents continuous Weibull random number distribution
+//
+// Supported types:
+//      float
+//      double
+//
+// Supported methods:
+//      oneapi::mkl::rng::weibull_method::icdf
+//      oneapi::mkl::rng::weibull_method::icdf_accurate
+//
+// Input arguments:
+//      alpha - shape. 1.0 by default
+//      a     - displacement. 0.0 by default
+//      beta  - scalefactor. 1.0 by default
+
+namespace weibull_method {
+struct icdf {};
+struct icdf_accurate {};
+using by_default = icdf;
+} // namespace weibull_method
+
+template <typename RealType = float, typename Method = weibull_method::by_default>
+class weibull {
+public:
+    static_assert(std::is_same<Method, weibull_method::icdf>::value ||
+                      std::is_same<Method, weibull_method::icdf_accurate>::value,
+                  "rng weibull distribution method is incorrect");
+
+    static_assert(std::is_same<RealType, float>::value || std::is_same<RealType, double>::value,
+                  "rng weibull distribution type is not supported");
+
+    using method_type = Method;
+    using result_type = RealType;
+
+    weibull()
+            : weibull(static_cast<RealType>(1.0), static_cast<RealType>(0.0),
+                      static_cast<RealType>(1.0)) {}
+
+    explicit weibull(RealType alpha, RealType a, RealType beta)
+            : alpha_(alpha),
+              a_(a),
+              beta_(beta) {
+        if (alpha <= static_cast<RealType>(0.0)) {
+            throw oneapi::mkl::invalid_argument("rng", "weibull", "alpha <= 0");
+        }
+        if (beta <= static_cast<RealType>(0.0)) {
+            throw oneapi::mkl::invalid_argument("rng", "weibull", "beta <= 0");
+        }
+    }
+
+    RealType alpha() const {
+        return alpha_;
+    }
+
+    RealType a() const {
+        return a_;
+    }
+
+    RealType beta() const {
+        return beta_;
+    }
+
+private:
+    RealType alpha_;
+    RealType a_;
+    RealType beta_;
+};
+
 // Class template oneapi::mkl::rng::bernoulli
 //
 // Represents discrete Bernoulli random number distribution
@@ -351,6 +677,248 @@ private:
     double lambda_;
 };
 
+// Class template oneapi::mkl::rng::geometric
+//
+// Represents discrete geometric random number distribution: the number of
+//  failures before the first success in a sequence of Bernoulli trials
+//
+// Supported types:
+//      std::int32_t
+//      std::uint32_t
+//
+// Supported methods:
+//      oneapi::mkl::rng::geometric_method::icdf
+//
+// Input arguments:
+//      p - success probability of a trial. 0.5 by default
+
+namespace geometric_method {
+struct icdf {};
+using by_default = icdf;
+} // namespace geometric_method
+
+template <typename IntType = std::int32_t, typename Method = geometric_method::by_default>
+class geometric {
+public:
+    static_assert(std::is_same<Method, geometric_method::icdf>::value,
+                  "rng geometric method is incorrect");
+
+    static_assert(std::is_same<IntType, std::int32_t>::value ||
+                      std::is_same<IntType, std::uint32_t>::value,
+                  "rng geometric type is not supported");
+
+    using method_type = Method;
+    using result_type = IntType;
+
+    geometric() : geometric(0.5f) {}
+
+    explicit geometric(float p) : p_(p) {
+        if ((p >= 1.0f) || (p <= 0.0f)) {
+            throw oneapi::mkl::invalid_argument("rng", "geometric", "p >= 1 or p <= 0");
+        }
+    }
+
+    float p() const {
+        return p_;
+    }
+
+private:
+    float p_;
+};
+
+// Class template oneapi::mkl::rng::multinomial
+//
+// Represents discrete multinomial random number distribution: the numbers of
+//  outcomes in each of k categories of ntrial independent trials. Every k
+//  consecutive generated values are the counts of one experiment, so the
+//  number of generated values must be a multiple of k
+//
+// Supported types:
+//      std::int32_t
+//      std::uint32_t
+//
+// Supported methods:
+//      oneapi::mkl::rng::multinomial_method::poisson_icdf_based
+//
+// Input arguments:
+//      ntrial - number of independent trials
+//      p      - probabilities of the k categories, which sum to 1 up to a
+//               relative error of 1e-6. They are rescaled to sum to 1
+
+namespace multinomial_method {
+struct poisson_icdf_based {};
+using by_default = poisson_icdf_based;
+} // namespace multinomial_method
+
+template <typename IntType = std::int32_t, typename Method = multinomial_method::by_default>
+class multinomial {
+public:
+    static_assert(std::is_same<Method, multinomial_method::poisson_icdf_based>::value,
+                  "rng multinomial method is incorrect");
+
+    static_assert(std::is_same<IntType, std::int32_t>::value ||
+                      std::is_same<IntType, std::uint32_t>::value,
+                  "rng multinomial type is not supported");
+
+    using method_type = Method;
+    using result_type = IntType;
+
+    explicit multinomial(std::int32_t ntrial, std::vector<double> p)
+            : ntrial_(ntrial),
+              p_(std::move(p)) {
+        if (ntrial < 0) {
+            throw oneapi::mkl::invalid_argument("rng", "multinomial", "ntrial < 0");
+        }
+        if (p_.empty()) {
+            throw oneapi::mkl::invalid_argument("rng", "multinomial", "p is empty");
+        }
+        double sum = 0.0;
+        for (double p_i : p_) {
+            if (!(p_i >= 0.0 && p_i <= 1.0)) {
+                throw oneapi::mkl::invalid_argument("rng", "multinomial", "p[i] > 1 or p[i] < 0");
+            }
+            sum += p_i;
+        }
+        if (!(std::fabs(sum - 1.0) <= 1e-6)) {
+            throw oneapi::mkl::invalid_argument("rng", "multinomial", "p sum is not 1");
+        }
+        for (double& p_i : p_)
+            p_i /= sum;
+    }
+
+    std::int32_t ntrial() const {
+        return ntrial_;
+    }
+
+    const std::vector<double>& p() const {
+        return p_;
+    }
+
+private:
+    std::int32_t ntrial_;
+    std::vector<double> p_;
+};
+
+// Class template oneapi::mkl::rng::discrete
+//
+// Represents discrete random number distribution over the categories
+//  0, ..., k - 1 with given weights
+//
+// The alias table of Walker's method is built once, with Vose's algorithm, by
+//  the constructor and is shared by the copies of the object: generate draws
+//  every value in constant time from one uniform value, whatever k, without
+//  preprocessing the weights again.
+//
+// Supported types:
+//      std::int32_t
+//      std::uint32_t
+//
+// Supported methods:
+//      oneapi::mkl::rng::discrete_method::alias
+//
+// Input arguments:
+//      weights - non-negative weights of the k categories, not all 0. They are
+//                normalized, so they need not sum to 1
+
+namespace discrete_method {
+struct alias {};
+using by_default = alias;
+} // namespace discrete_method
+
+template <typename IntType = std::int32_t, typename Method = discrete_method::by_default>
+class discrete {
+public:
+    static_assert(std::is_same<Method, discrete_method::alias>::value,
+                  "rng discrete method is incorrect");
+
+    static_assert(std::is_same<IntType, std::int32_t>::value ||
+                      std::is_same<IntType, std::uint32_t>::value,
+                  "rng discrete type is not supported");
+
+    using method_type = Method;
+    using result_type = IntType;
+
+    explicit discrete(const std::vector<double>& weights)
+            : table_(std::make_shared<const table>(weights)) {}
+
+    // Number of categories
+    std::int32_t k() const {
+        return static_cast<std::int32_t>(table_->p.size());
+    }
+
+    // Probabilities of the categories: the normalized weights
+    const std::vector<double>& p() const {
+        return table_->p;
+    }
+
+    // Alias table: a column i is chosen uniformly, and the value is i with
+    //  probability threshold()[i] and alias()[i] otherwise
+    const std::vector<double>& threshold() const {
+        return table_->threshold;
+    }
+
+    const std::vector<std::int32_t>& alias() const {
+        return table_->alias;
+    }
+
+private:
+    struct table {
+        explicit table(const std::vector<double>& weights);
+
+        std::vector<double> p;
+        std::vector<double> threshold;
+        std::vector<std::int32_t> alias;
+    };
+
+    std::shared_ptr<const table> table_;
+};
+
+template <typename IntType, typename Method>
+discrete<IntType, Method>::table::table(const std::vector<double>& weights) {
+    if (weights.empty() || weights.size() > std::numeric_limits<std::int32_t>::max()) {
+        throw oneapi::mkl::invalid_argument("rng", "discrete", "weights size is incorrect");
+    }
+    double sum = 0.0;
+    for (double w : weights) {
+        if (!(w >= 0.0)) {
+            throw oneapi::mkl::invalid_argument("rng", "discrete", "weights[i] < 0");
+        }
+        sum += w;
+    }
+    if (!(sum > 0.0) || sum == std::numeric_limits<double>::infinity()) {
+        throw oneapi::mkl::invalid_argument("rng", "discrete", "weights sum is incorrect");
+    }
+
+    const std::int32_t k = static_cast<std::int32_t>(weights.size());
+    p.resize(k);
+    threshold.resize(k);
+    alias.resize(k);
+
+    // Vose's algorithm: the columns are filled to k * p[i] with the mass of
+    //  one over-full column each, pairing under- and over-full columns.
+    std::vector<std::int32_t> small, large;
+    for (std::int32_t i = 0; i < k; i++) {
+        p[i] = weights[i] / sum;
+        threshold[i] = p[i] * k;
+        alias[i] = i;
+        (threshold[i] < 1.0 ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+        const std::int32_t s = small.back();
+        const std::int32_t l = large.back();
+        small.pop_back();
+        large.pop_back();
+        alias[s] = l;
+        threshold[l] = (threshold[l] + threshold[s]) - 1.0;
+        (threshold[l] < 1.0 ? small : large).push_back(l);
+    }
+    // The columns left are full, up to rounding errors.
+    for (std::int32_t i : small)
+        threshold[i] = 1.0;
+    for (std::int32_t i : large)
+        threshold[i] = 1.0;
+}
+
 // Class template oneapi::mkl::rng::bits
 //
 // Represents bits of underlying random number engine
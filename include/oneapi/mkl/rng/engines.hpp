@@ -58,6 +58,7 @@ namespace rng {
 //
 // Supported parallelization methods:
 //      skip_ahead
+//      leapfrog (host CPU backend)
 class philox4x32x10 {
 public:
     static constexpr std::uint64_t default_seed = 0;
@@ -134,6 +135,9 @@ private:
     template <typename Engine>
     friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
 
+    template <typename Engine>
+    friend void leapfrog(Engine& engine, std::uint64_t idx, std::uint64_t stride);
+
     template <typename Distr, typename Engine>
     friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
                          sycl::buffer<typename Distr::result_type, 1>& r);
@@ -150,6 +154,7 @@ private:
 //
 // Supported parallelization methods:
 //      skip_ahead
+//      leapfrog (host CPU backend)
 class mrg32k3a {
 public:
     static constexpr std::uint32_t default_seed = 1;
@@ -223,6 +228,9 @@ private:
     template <typename Engine>
     friend void skip_ahead(Engine& engine, std::initializer_list<std::uint64_t> num_to_skip);
 
+    template <typename Engine>
+    friend void leapfrog(Engine& engine, std::uint64_t idx, std::uint64_t stride);
+
     template <typename Distr, typename Engine>
     friend void generate(const Distr& distr, Engine& engine, std::int64_t n,
                          sycl::buffer<typename Distr::result_type, 1>& r);
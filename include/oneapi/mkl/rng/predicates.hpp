@@ -28,12 +28,26 @@
 #endif
 
 #include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/rng/distributions.hpp"
 #include "oneapi/mkl/types.hpp"
 
 namespace oneapi {
 namespace mkl {
 namespace rng {
 
+// Checks of n specific to a distribution
+
+template <typename Distr>
+inline void distribution_precondition(const Distr& distr, std::int64_t n) {}
+
+template <typename IntType, typename Method>
+inline void distribution_precondition(const multinomial<IntType, Method>& distr, std::int64_t n) {
+    if (n % static_cast<std::int64_t>(distr.p().size()) != 0) {
+        throw oneapi::mkl::invalid_argument("rng", "generate",
+                                            "n is not a multiple of the size of p of multinomial");
+    }
+}
+
 // Buffer APIs
 
 template <typename Distr, typename Engine>
@@ -43,6 +57,7 @@ inline void generate_precondition(const Distr& distr, Engine& engine, std::int64
     if (n < 0 || n > r.size()) {
         throw oneapi::mkl::invalid_argument("rng", "generate", "n");
     }
+    distribution_precondition(distr, n);
 #endif
 }
 
@@ -59,6 +74,7 @@ inline void generate_precondition(const Distr& distr, Engine& engine, std::int64
     if (r == nullptr) {
         throw oneapi::mkl::invalid_argument("rng", "generate", "r is nullptr");
     }
+    distribution_precondition(distr, n);
 #endif
 }
 
@@ -22,103 +22,178 @@
 void copy_batch(sycl::queue &queue, int64_t n, sycl::buffer<float, 1> &x, int64_t incx,
                 int64_t stridex, sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_scopy_batch>(cgh, [=]() {
+            const float *x_ptr = accessor_x.get_pointer();
+            float *y_ptr = accessor_y.get_pointer();
+            const int64_t grain = get_streaming_grain_size(2 * n * sizeof(float));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    copy_kernel(n, x_ptr + i * stridex, incx, y_ptr + i * stridey, incy);
+                }
+            });
+        });
+    });
 }
 
 void copy_batch(sycl::queue &queue, int64_t n, sycl::buffer<double, 1> &x, int64_t incx,
                 int64_t stridex, sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dcopy_batch>(cgh, [=]() {
+            const double *x_ptr = accessor_x.get_pointer();
+            double *y_ptr = accessor_y.get_pointer();
+            const int64_t grain = get_streaming_grain_size(2 * n * sizeof(double));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    copy_kernel(n, x_ptr + i * stridex, incx, y_ptr + i * stridey, incy);
+                }
+            });
+        });
+    });
 }
 
 void copy_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<float>, 1> &x,
                 int64_t incx, int64_t stridex, sycl::buffer<std::complex<float>, 1> &y,
                 int64_t incy, int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ccopy_batch>(cgh, [=]() {
+            const std::complex<float> *x_ptr = accessor_x.get_pointer();
+            std::complex<float> *y_ptr = accessor_y.get_pointer();
+            const int64_t grain = get_streaming_grain_size(2 * n * sizeof(std::complex<float>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    copy_kernel(n, x_ptr + i * stridex, incx, y_ptr + i * stridey, incy);
+                }
+            });
+        });
+    });
 }
 
 void copy_batch(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &x,
                 int64_t incx, int64_t stridex, sycl::buffer<std::complex<double>, 1> &y,
                 int64_t incy, int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zcopy_batch>(cgh, [=]() {
+            const std::complex<double> *x_ptr = accessor_x.get_pointer();
+            std::complex<double> *y_ptr = accessor_y.get_pointer();
+            const int64_t grain = get_streaming_grain_size(2 * n * sizeof(std::complex<double>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    copy_kernel(n, x_ptr + i * stridex, incx, y_ptr + i * stridey, incy);
+                }
+            });
+        });
+    });
 }
 
 void axpy_batch(sycl::queue &queue, int64_t n, float alpha, sycl::buffer<float, 1> &x,
                 int64_t incx, int64_t stridex, sycl::buffer<float, 1> &y, int64_t incy,
                 int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_saxpy_batch>(cgh, [=]() {
+            const float *x_ptr = accessor_x.get_pointer();
+            float *y_ptr = accessor_y.get_pointer();
+            const int64_t grain = get_streaming_grain_size(3 * n * sizeof(float));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    axpy_kernel(n, alpha, x_ptr + i * stridex, incx, y_ptr + i * stridey, incy);
+                }
+            });
+        });
+    });
 }
 
 void axpy_batch(sycl::queue &queue, int64_t n, double alpha, sycl::buffer<double, 1> &x,
                 int64_t incx, int64_t stridex, sycl::buffer<double, 1> &y, int64_t incy,
                 int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_daxpy_batch>(cgh, [=]() {
+            const double *x_ptr = accessor_x.get_pointer();
+            double *y_ptr = accessor_y.get_pointer();
+            const int64_t grain = get_streaming_grain_size(3 * n * sizeof(double));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    axpy_kernel(n, alpha, x_ptr + i * stridex, incx, y_ptr + i * stridey, incy);
+                }
+            });
+        });
+    });
 }
 
 void axpy_batch(sycl::queue &queue, int64_t n, std::complex<float> alpha,
                 sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t stridex,
                 sycl::buffer<std::complex<float>, 1> &y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_caxpy_batch>(cgh, [=]() {
+            const std::complex<float> *x_ptr = accessor_x.get_pointer();
+            std::complex<float> *y_ptr = accessor_y.get_pointer();
+            const int64_t grain = get_streaming_grain_size(3 * n * sizeof(std::complex<float>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    axpy_kernel(n, alpha, x_ptr + i * stridex, incx, y_ptr + i * stridey, incy);
+                }
+            });
+        });
+    });
 }
 
 void axpy_batch(sycl::queue &queue, int64_t n, std::complex<double> alpha,
                 sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t stridex,
                 sycl::buffer<std::complex<double>, 1> &y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zaxpy_batch>(cgh, [=]() {
+            const std::complex<double> *x_ptr = accessor_x.get_pointer();
+            std::complex<double> *y_ptr = accessor_y.get_pointer();
+            const int64_t grain = get_streaming_grain_size(3 * n * sizeof(std::complex<double>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    axpy_kernel(n, alpha, x_ptr + i * stridex, incx, y_ptr + i * stridey, incy);
+                }
+            });
+        });
+    });
 }
 
 void gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n, float alpha,
                 sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
                 sycl::buffer<float, 1> &x, int64_t incx, int64_t stride_x, float beta,
                 sycl::buffer<float, 1> &y, int64_t incy, int64_t stride_y, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemv_batch>(cgh, [=]() {
+            const float *a_ptr = accessor_a.get_pointer();
+            const float *x_ptr = accessor_x.get_pointer();
+            float *y_ptr = accessor_y.get_pointer();
+            const int64_t grain = get_streaming_grain_size((m * n + m + n) * sizeof(float));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    cblas_gemv(MAJOR, transa, m, n, alpha, a_ptr + i * stride_a, lda,
+                               x_ptr + i * stride_x, incx, beta, y_ptr + i * stride_y, incy);
+                }
+            });
+        });
+    });
 }
 
 void gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n, double alpha,
@@ -126,12 +201,23 @@ void gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n, doub
                 sycl::buffer<double, 1> &x, int64_t incx, int64_t stride_x, double beta,
                 sycl::buffer<double, 1> &y, int64_t incy, int64_t stride_y,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemv_batch>(cgh, [=]() {
+            const double *a_ptr = accessor_a.get_pointer();
+            const double *x_ptr = accessor_x.get_pointer();
+            double *y_ptr = accessor_y.get_pointer();
+            const int64_t grain = get_streaming_grain_size((m * n + m + n) * sizeof(double));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    cblas_gemv(MAJOR, transa, m, n, alpha, a_ptr + i * stride_a, lda,
+                               x_ptr + i * stride_x, incx, beta, y_ptr + i * stride_y, incy);
+                }
+            });
+        });
+    });
 }
 
 void gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -140,12 +226,24 @@ void gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n,
                 int64_t stride_x, std::complex<float> beta,
                 sycl::buffer<std::complex<float>, 1> &y, int64_t incy, int64_t stride_y,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemv_batch>(cgh, [=]() {
+            const std::complex<float> *a_ptr = accessor_a.get_pointer();
+            const std::complex<float> *x_ptr = accessor_x.get_pointer();
+            std::complex<float> *y_ptr = accessor_y.get_pointer();
+            const int64_t grain =
+                get_streaming_grain_size((m * n + m + n) * sizeof(std::complex<float>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    cblas_gemv(MAJOR, transa, m, n, alpha, a_ptr + i * stride_a, lda,
+                               x_ptr + i * stride_x, incx, beta, y_ptr + i * stride_y, incy);
+                }
+            });
+        });
+    });
 }
 
 void gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -154,36 +252,74 @@ void gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n,
                 int64_t incx, int64_t stride_x, std::complex<double> beta,
                 sycl::buffer<std::complex<double>, 1> &y, int64_t incy, int64_t stride_y,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemv_batch>(cgh, [=]() {
+            const std::complex<double> *a_ptr = accessor_a.get_pointer();
+            const std::complex<double> *x_ptr = accessor_x.get_pointer();
+            std::complex<double> *y_ptr = accessor_y.get_pointer();
+            const int64_t grain =
+                get_streaming_grain_size((m * n + m + n) * sizeof(std::complex<double>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    cblas_gemv(MAJOR, transa, m, n, alpha, a_ptr + i * stride_a, lda,
+                               x_ptr + i * stride_x, incx, beta, y_ptr + i * stride_y, incy);
+                }
+            });
+        });
+    });
 }
 
 void dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n,
                 sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
                 sycl::buffer<float, 1> &x, int64_t incx, int64_t stride_x,
                 sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sdgmm_batch>(cgh, [=]() {
+            const float *a_ptr = accessor_a.get_pointer();
+            const float *x_ptr = accessor_x.get_pointer();
+            float *c_ptr = accessor_c.get_pointer();
+            const bool stream = use_streaming_stores(batch_size * m * n * sizeof(float));
+            const int64_t grain = get_streaming_grain_size(2 * m * n * sizeof(float));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    dgmm_kernel(MAJOR, left_right, m, n, a_ptr + i * stride_a, lda,
+                                x_ptr + i * stride_x, incx, c_ptr + i * stride_c, ldc, stream);
+                }
+                stream_fence();
+            });
+        });
+    });
 }
 
 void dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n,
                 sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
                 sycl::buffer<double, 1> &x, int64_t incx, int64_t stride_x,
                 sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ddgmm_batch>(cgh, [=]() {
+            const double *a_ptr = accessor_a.get_pointer();
+            const double *x_ptr = accessor_x.get_pointer();
+            double *c_ptr = accessor_c.get_pointer();
+            const bool stream = use_streaming_stores(batch_size * m * n * sizeof(double));
+            const int64_t grain = get_streaming_grain_size(2 * m * n * sizeof(double));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    dgmm_kernel(MAJOR, left_right, m, n, a_ptr + i * stride_a, lda,
+                                x_ptr + i * stride_x, incx, c_ptr + i * stride_c, ldc, stream);
+                }
+                stream_fence();
+            });
+        });
+    });
 }
 
 void dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n,
@@ -191,12 +327,26 @@ void dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n,
                 sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t stride_x,
                 sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cdgmm_batch>(cgh, [=]() {
+            const std::complex<float> *a_ptr = accessor_a.get_pointer();
+            const std::complex<float> *x_ptr = accessor_x.get_pointer();
+            std::complex<float> *c_ptr = accessor_c.get_pointer();
+            const bool stream =
+                use_streaming_stores(batch_size * m * n * sizeof(std::complex<float>));
+            const int64_t grain = get_streaming_grain_size(2 * m * n * sizeof(std::complex<float>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    dgmm_kernel(MAJOR, left_right, m, n, a_ptr + i * stride_a, lda,
+                                x_ptr + i * stride_x, incx, c_ptr + i * stride_c, ldc, stream);
+                }
+                stream_fence();
+            });
+        });
+    });
 }
 
 void dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n,
@@ -204,12 +354,27 @@ void dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n,
                 sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t stride_x,
                 sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zdgmm_batch>(cgh, [=]() {
+            const std::complex<double> *a_ptr = accessor_a.get_pointer();
+            const std::complex<double> *x_ptr = accessor_x.get_pointer();
+            std::complex<double> *c_ptr = accessor_c.get_pointer();
+            const bool stream =
+                use_streaming_stores(batch_size * m * n * sizeof(std::complex<double>));
+            const int64_t grain =
+                get_streaming_grain_size(2 * m * n * sizeof(std::complex<double>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    dgmm_kernel(MAJOR, left_right, m, n, a_ptr + i * stride_a, lda,
+                                x_ptr + i * stride_x, incx, c_ptr + i * stride_c, ldc, stream);
+                }
+                stream_fence();
+            });
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -217,12 +382,26 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t stride_a, sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
                 float beta, sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemm_batch>(cgh, [=]() {
+            const float *a_ptr = accessor_a.get_pointer();
+            const float *b_ptr = accessor_b.get_pointer();
+            float *c_ptr = accessor_c.get_pointer();
+            const int64_t grain = get_grain_size(2 * m * n * k);
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa),
+                                  convert_to_cblas_trans(transb), (const int)m, (const int)n,
+                                  (const int)k, (const float)alpha, a_ptr + i * stride_a,
+                                  (const int)lda, b_ptr + i * stride_b, (const int)ldb,
+                                  (const float)beta, c_ptr + i * stride_c, (const int)ldc);
+                }
+            });
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -230,12 +409,26 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t stride_a, sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
                 double beta, sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemm_batch>(cgh, [=]() {
+            const double *a_ptr = accessor_a.get_pointer();
+            const double *b_ptr = accessor_b.get_pointer();
+            double *c_ptr = accessor_c.get_pointer();
+            const int64_t grain = get_grain_size(2 * m * n * k);
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa),
+                                  convert_to_cblas_trans(transb), (const int)m, (const int)n,
+                                  (const int)k, (const double)alpha, a_ptr + i * stride_a,
+                                  (const int)lda, b_ptr + i * stride_b, (const int)ldb,
+                                  (const double)beta, c_ptr + i * stride_c, (const int)ldc);
+                }
+            });
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -244,12 +437,26 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t ldb, int64_t stride_b, std::complex<float> beta,
                 sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemm_batch>(cgh, [=]() {
+            const std::complex<float> *a_ptr = accessor_a.get_pointer();
+            const std::complex<float> *b_ptr = accessor_b.get_pointer();
+            std::complex<float> *c_ptr = accessor_c.get_pointer();
+            const int64_t grain = get_grain_size(8 * m * n * k);
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa),
+                                  convert_to_cblas_trans(transb), (const int)m, (const int)n,
+                                  (const int)k, (const void *)&alpha, a_ptr + i * stride_a,
+                                  (const int)lda, b_ptr + i * stride_b, (const int)ldb,
+                                  (const void *)&beta, c_ptr + i * stride_c, (const int)ldc);
+                }
+            });
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -258,12 +465,26 @@ void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t
                 int64_t ldb, int64_t stride_b, std::complex<double> beta,
                 sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemm_batch>(cgh, [=]() {
+            const std::complex<double> *a_ptr = accessor_a.get_pointer();
+            const std::complex<double> *b_ptr = accessor_b.get_pointer();
+            std::complex<double> *c_ptr = accessor_c.get_pointer();
+            const int64_t grain = get_grain_size(8 * m * n * k);
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa),
+                                  convert_to_cblas_trans(transb), (const int)m, (const int)n,
+                                  (const int)k, (const void *)&alpha, a_ptr + i * stride_a,
+                                  (const int)lda, b_ptr + i * stride_b, (const int)ldb,
+                                  (const void *)&beta, c_ptr + i * stride_c, (const int)ldc);
+                }
+            });
+        });
+    });
 }
 
 void gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -283,24 +504,42 @@ void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose
                 diag unit_diag, int64_t m, int64_t n, float alpha, sycl::buffer<float, 1> &a,
                 int64_t lda, int64_t stride_a, sycl::buffer<float, 1> &b, int64_t ldb,
                 int64_t stride_b, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_strsm_batch>(cgh, [=]() {
+            const float *a_ptr = accessor_a.get_pointer();
+            float *b_ptr = accessor_b.get_pointer();
+            const int64_t grain = get_grain_size(trsm_flops<float>(left_right, m, n));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_trsm(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a_ptr + i * stride_a, lda, b_ptr + i * stride_b, ldb);
+                }
+            });
+        });
+    });
 }
 
 void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
                 diag unit_diag, int64_t m, int64_t n, double alpha, sycl::buffer<double, 1> &a,
                 int64_t lda, int64_t stride_a, sycl::buffer<double, 1> &b, int64_t ldb,
                 int64_t stride_b, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dtrsm_batch>(cgh, [=]() {
+            const double *a_ptr = accessor_a.get_pointer();
+            double *b_ptr = accessor_b.get_pointer();
+            const int64_t grain = get_grain_size(trsm_flops<double>(left_right, m, n));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_trsm(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a_ptr + i * stride_a, lda, b_ptr + i * stride_b, ldb);
+                }
+            });
+        });
+    });
 }
 
 void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
@@ -308,12 +547,21 @@ void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose
                 sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
                 sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, int64_t stride_b,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ctrsm_batch>(cgh, [=]() {
+            const std::complex<float> *a_ptr = accessor_a.get_pointer();
+            std::complex<float> *b_ptr = accessor_b.get_pointer();
+            const int64_t grain = get_grain_size(trsm_flops<std::complex<float>>(left_right, m, n));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_trsm(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a_ptr + i * stride_a, lda, b_ptr + i * stride_b, ldb);
+                }
+            });
+        });
+    });
 }
 
 void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
@@ -321,36 +569,64 @@ void trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower, transpose
                 sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
                 sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ztrsm_batch>(cgh, [=]() {
+            const std::complex<double> *a_ptr = accessor_a.get_pointer();
+            std::complex<double> *b_ptr = accessor_b.get_pointer();
+            const int64_t grain =
+                get_grain_size(trsm_flops<std::complex<double>>(left_right, m, n));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_trsm(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a_ptr + i * stride_a, lda, b_ptr + i * stride_b, ldb);
+                }
+            });
+        });
+    });
 }
 
 void syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                 float alpha, sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
                 float beta, sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ssyrk_batch>(cgh, [=]() {
+            const float *a_ptr = accessor_a.get_pointer();
+            float *c_ptr = accessor_c.get_pointer();
+            const int64_t grain = get_grain_size(syrk_flops<float>(n, k));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_syrk(MAJOR, upper_lower, trans, n, k, alpha, a_ptr + i * stride_a, lda,
+                               beta, c_ptr + i * stride_c, ldc);
+                }
+            });
+        });
+    });
 }
 
 void syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                 double alpha, sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
                 double beta, sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dsyrk_batch>(cgh, [=]() {
+            const double *a_ptr = accessor_a.get_pointer();
+            double *c_ptr = accessor_c.get_pointer();
+            const int64_t grain = get_grain_size(syrk_flops<double>(n, k));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_syrk(MAJOR, upper_lower, trans, n, k, alpha, a_ptr + i * stride_a, lda,
+                               beta, c_ptr + i * stride_c, ldc);
+                }
+            });
+        });
+    });
 }
 
 void syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
@@ -358,12 +634,21 @@ void syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n
                 int64_t stride_a, std::complex<float> beta,
                 sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_csyrk_batch>(cgh, [=]() {
+            const std::complex<float> *a_ptr = accessor_a.get_pointer();
+            std::complex<float> *c_ptr = accessor_c.get_pointer();
+            const int64_t grain = get_grain_size(syrk_flops<std::complex<float>>(n, k));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_syrk(MAJOR, upper_lower, trans, n, k, alpha, a_ptr + i * stride_a, lda,
+                               beta, c_ptr + i * stride_c, ldc);
+                }
+            });
+        });
+    });
 }
 
 void syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
@@ -371,12 +656,21 @@ void syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n
                 int64_t lda, int64_t stride_a, std::complex<double> beta,
                 sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zsyrk_batch>(cgh, [=]() {
+            const std::complex<double> *a_ptr = accessor_a.get_pointer();
+            std::complex<double> *c_ptr = accessor_c.get_pointer();
+            const int64_t grain = get_grain_size(syrk_flops<std::complex<double>>(n, k));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_syrk(MAJOR, upper_lower, trans, n, k, alpha, a_ptr + i * stride_a, lda,
+                               beta, c_ptr + i * stride_c, ldc);
+                }
+            });
+        });
+    });
 }
 
 void omatcopy_batch(sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
@@ -526,187 +820,367 @@ void omatadd_batch(sycl::queue &queue, transpose transa, transpose transb, int64
 sycl::event copy_batch(sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
                            float **y, int64_t *incy, int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_scopy_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_streaming_grain_size(2 * n[group] * sizeof(float));
+                parallel_for(group_size[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        copy_kernel(n[group], x[i], incx[group], y[i], incy[group]);
+                    }
+                });
+                offset += group_size[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
                            double **y, int64_t *incy, int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dcopy_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_streaming_grain_size(2 * n[group] * sizeof(double));
+                parallel_for(group_size[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        copy_kernel(n[group], x[i], incx[group], y[i], incy[group]);
+                    }
+                });
+                offset += group_size[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue &queue, int64_t *n, const std::complex<float> **x,
                            int64_t *incx, std::complex<float> **y, int64_t *incy,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ccopy_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_streaming_grain_size(2 * n[group] * sizeof(std::complex<float>));
+                parallel_for(group_size[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        copy_kernel(n[group], x[i], incx[group], y[i], incy[group]);
+                    }
+                });
+                offset += group_size[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue &queue, int64_t *n, const std::complex<double> **x,
                            int64_t *incx, std::complex<double> **y, int64_t *incy,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zcopy_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_streaming_grain_size(2 * n[group] * sizeof(std::complex<double>));
+                parallel_for(group_size[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        copy_kernel(n[group], x[i], incx[group], y[i], incy[group]);
+                    }
+                });
+                offset += group_size[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                            std::int64_t stridex, float *y, int64_t incy, std::int64_t stridey,
                            std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_scopy_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_streaming_grain_size(2 * n * sizeof(float));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    copy_kernel(n, x + i * stridex, incx, y + i * stridey, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                            std::int64_t stridex, double *y, int64_t incy, std::int64_t stridey,
                            std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dcopy_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_streaming_grain_size(2 * n * sizeof(double));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    copy_kernel(n, x + i * stridex, incx, y + i * stridey, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue &queue, int64_t n, const std::complex<float> *x,
                            int64_t incx, std::int64_t stridex, std::complex<float> *y, int64_t incy,
                            std::int64_t stridey, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ccopy_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_streaming_grain_size(2 * n * sizeof(std::complex<float>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    copy_kernel(n, x + i * stridex, incx, y + i * stridey, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue &queue, int64_t n, const std::complex<double> *x,
                            int64_t incx, std::int64_t stridex, std::complex<double> *y,
                            int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zcopy_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_streaming_grain_size(2 * n * sizeof(std::complex<double>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    copy_kernel(n, x + i * stridex, incx, y + i * stridey, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue &queue, int64_t *n, float *alpha, const float **x,
                            int64_t *incx, float **y, int64_t *incy, int64_t group_count,
                            int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpy_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_streaming_grain_size(3 * n[group] * sizeof(float));
+                parallel_for(group_size[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        axpy_kernel(n[group], alpha[group], x[i], incx[group], y[i], incy[group]);
+                    }
+                });
+                offset += group_size[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue &queue, int64_t *n, double *alpha, const double **x,
                            int64_t *incx, double **y, int64_t *incy, int64_t group_count,
                            int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpy_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_streaming_grain_size(3 * n[group] * sizeof(double));
+                parallel_for(group_size[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        axpy_kernel(n[group], alpha[group], x[i], incx[group], y[i], incy[group]);
+                    }
+                });
+                offset += group_size[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue &queue, int64_t *n, std::complex<float> *alpha,
                            const std::complex<float> **x, int64_t *incx, std::complex<float> **y,
                            int64_t *incy, int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_caxpy_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_streaming_grain_size(3 * n[group] * sizeof(std::complex<float>));
+                parallel_for(group_size[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        axpy_kernel(n[group], alpha[group], x[i], incx[group], y[i], incy[group]);
+                    }
+                });
+                offset += group_size[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue &queue, int64_t *n, std::complex<double> *alpha,
                            const std::complex<double> **x, int64_t *incx, std::complex<double> **y,
                            int64_t *incy, int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zaxpy_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_streaming_grain_size(3 * n[group] * sizeof(std::complex<double>));
+                parallel_for(group_size[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        axpy_kernel(n[group], alpha[group], x[i], incx[group], y[i], incy[group]);
+                    }
+                });
+                offset += group_size[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue &queue, int64_t n, float alpha, const float *x,
                            int64_t incx, int64_t stridex, float *y, int64_t incy, int64_t stridey,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpy_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_streaming_grain_size(3 * n * sizeof(float));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    axpy_kernel(n, alpha, x + i * stridex, incx, y + i * stridey, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue &queue, int64_t n, double alpha, const double *x,
                            int64_t incx, int64_t stridex, double *y, int64_t incy, int64_t stridey,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpy_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_streaming_grain_size(3 * n * sizeof(double));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    axpy_kernel(n, alpha, x + i * stridex, incx, y + i * stridey, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue &queue, int64_t n, std::complex<float> alpha,
                            const std::complex<float> *x, int64_t incx, int64_t stridex,
                            std::complex<float> *y, int64_t incy, int64_t stridey,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_caxpy_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_streaming_grain_size(3 * n * sizeof(std::complex<float>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    axpy_kernel(n, alpha, x + i * stridex, incx, y + i * stridey, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue &queue, int64_t n, std::complex<double> alpha,
                            const std::complex<double> *x, int64_t incx, int64_t stridex,
                            std::complex<double> *y, int64_t incy, int64_t stridey,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zaxpy_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_streaming_grain_size(3 * n * sizeof(std::complex<double>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    axpy_kernel(n, alpha, x + i * stridex, incx, y + i * stridey, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -714,12 +1188,22 @@ sycl::event gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t
                            const float *x, int64_t incx, int64_t stride_x, float beta, float *y,
                            int64_t incy, int64_t stride_y, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemv_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_streaming_grain_size((m * n + m + n) * sizeof(float));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    cblas_gemv(MAJOR, transa, m, n, alpha, a + i * stride_a, lda, x + i * stride_x,
+                               incx, beta, y + i * stride_y, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -727,12 +1211,22 @@ sycl::event gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t
                            const double *x, int64_t incx, int64_t stride_x, double beta, double *y,
                            int64_t incy, int64_t stride_y, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemv_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_streaming_grain_size((m * n + m + n) * sizeof(double));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    cblas_gemv(MAJOR, transa, m, n, alpha, a + i * stride_a, lda, x + i * stride_x,
+                               incx, beta, y + i * stride_y, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -741,12 +1235,23 @@ sycl::event gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t
                            int64_t stride_x, std::complex<float> beta, std::complex<float> *y,
                            int64_t incy, int64_t stride_y, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemv_batch_usm>(cgh, [=]() {
+            const int64_t grain =
+                get_streaming_grain_size((m * n + m + n) * sizeof(std::complex<float>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    cblas_gemv(MAJOR, transa, m, n, alpha, a + i * stride_a, lda, x + i * stride_x,
+                               incx, beta, y + i * stride_y, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -755,12 +1260,23 @@ sycl::event gemv_batch(sycl::queue &queue, transpose transa, int64_t m, int64_t
                            int64_t stride_x, std::complex<double> beta, std::complex<double> *y,
                            int64_t incy, int64_t stride_y, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemv_batch_usm>(cgh, [=]() {
+            const int64_t grain =
+                get_streaming_grain_size((m * n + m + n) * sizeof(std::complex<double>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    cblas_gemv(MAJOR, transa, m, n, alpha, a + i * stride_a, lda, x + i * stride_x,
+                               incx, beta, y + i * stride_y, incy);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue &queue, transpose *transa, int64_t *m, int64_t *n,
@@ -768,12 +1284,27 @@ sycl::event gemv_batch(sycl::queue &queue, transpose *transa, int64_t *m, int64_
                            int64_t *incx, float *beta, float **y, int64_t *incy,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemv_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_streaming_grain_size(
+                    (m[group] * n[group] + m[group] + n[group]) * sizeof(float));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        cblas_gemv(MAJOR, transa[group], m[group], n[group], alpha[group], a[i],
+                                   lda[group], x[i], incx[group], beta[group], y[i], incy[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue &queue, transpose *transa, int64_t *m, int64_t *n,
@@ -781,12 +1312,27 @@ sycl::event gemv_batch(sycl::queue &queue, transpose *transa, int64_t *m, int64_
                            int64_t *incx, double *beta, double **y, int64_t *incy,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemv_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_streaming_grain_size(
+                    (m[group] * n[group] + m[group] + n[group]) * sizeof(double));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        cblas_gemv(MAJOR, transa[group], m[group], n[group], alpha[group], a[i],
+                                   lda[group], x[i], incx[group], beta[group], y[i], incy[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue &queue, transpose *transa, int64_t *m, int64_t *n,
@@ -794,12 +1340,27 @@ sycl::event gemv_batch(sycl::queue &queue, transpose *transa, int64_t *m, int64_
                            const std::complex<float> **x, int64_t *incx, std::complex<float> *beta,
                            std::complex<float> **y, int64_t *incy, int64_t group_count,
                            int64_t *groupsize, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemv_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_streaming_grain_size(
+                    (m[group] * n[group] + m[group] + n[group]) * sizeof(std::complex<float>));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        cblas_gemv(MAJOR, transa[group], m[group], n[group], alpha[group], a[i],
+                                   lda[group], x[i], incx[group], beta[group], y[i], incy[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue &queue, transpose *transa, int64_t *m, int64_t *n,
@@ -808,36 +1369,75 @@ sycl::event gemv_batch(sycl::queue &queue, transpose *transa, int64_t *m, int64_
                            std::complex<double> *beta, std::complex<double> **y, int64_t *incy,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemv_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_streaming_grain_size(
+                    (m[group] * n[group] + m[group] + n[group]) * sizeof(std::complex<double>));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        cblas_gemv(MAJOR, transa[group], m[group], n[group], alpha[group], a[i],
+                                   lda[group], x[i], incx[group], beta[group], y[i], incy[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n,
                            const float *a, int64_t lda, int64_t stride_a, const float *x,
                            int64_t incx, int64_t stride_x, float *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sdgmm_batch_usm>(cgh, [=]() {
+            const bool stream = use_streaming_stores(batch_size * m * n * sizeof(float));
+            const int64_t grain = get_streaming_grain_size(2 * m * n * sizeof(float));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    dgmm_kernel(MAJOR, left_right, m, n, a + i * stride_a, lda, x + i * stride_x,
+                                incx, c + i * stride_c, ldc, stream);
+                }
+                stream_fence();
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n,
                            const double *a, int64_t lda, int64_t stride_a, const double *x,
                            int64_t incx, int64_t stride_x, double *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ddgmm_batch_usm>(cgh, [=]() {
+            const bool stream = use_streaming_stores(batch_size * m * n * sizeof(double));
+            const int64_t grain = get_streaming_grain_size(2 * m * n * sizeof(double));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    dgmm_kernel(MAJOR, left_right, m, n, a + i * stride_a, lda, x + i * stride_x,
+                                incx, c + i * stride_c, ldc, stream);
+                }
+                stream_fence();
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n,
@@ -845,12 +1445,25 @@ sycl::event dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n
                            const std::complex<float> *x, int64_t incx, int64_t stride_x,
                            std::complex<float> *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cdgmm_batch_usm>(cgh, [=]() {
+            const bool stream =
+                use_streaming_stores(batch_size * m * n * sizeof(std::complex<float>));
+            const int64_t grain = get_streaming_grain_size(2 * m * n * sizeof(std::complex<float>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    dgmm_kernel(MAJOR, left_right, m, n, a + i * stride_a, lda, x + i * stride_x,
+                                incx, c + i * stride_c, ldc, stream);
+                }
+                stream_fence();
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n,
@@ -858,36 +1471,92 @@ sycl::event dgmm_batch(sycl::queue &queue, side left_right, int64_t m, int64_t n
                            const std::complex<double> *x, int64_t incx, int64_t stride_x,
                            std::complex<double> *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zdgmm_batch_usm>(cgh, [=]() {
+            const bool stream =
+                use_streaming_stores(batch_size * m * n * sizeof(std::complex<double>));
+            const int64_t grain =
+                get_streaming_grain_size(2 * m * n * sizeof(std::complex<double>));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    dgmm_kernel(MAJOR, left_right, m, n, a + i * stride_a, lda, x + i * stride_x,
+                                incx, c + i * stride_c, ldc, stream);
+                }
+                stream_fence();
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue &queue, side *left_right, int64_t *m, int64_t *n,
                            const float **a, int64_t *lda, const float **x, int64_t *incx, float **c,
                            int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sdgmm_batch_group_usm>(cgh, [=]() {
+            int64_t output_bytes = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                output_bytes += groupsize[group] * m[group] * n[group] * sizeof(float);
+            }
+            const bool stream = use_streaming_stores(output_bytes);
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_streaming_grain_size(2 * m[group] * n[group] * sizeof(float));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        dgmm_kernel(MAJOR, left_right[group], m[group], n[group], a[i], lda[group],
+                                    x[i], incx[group], c[i], ldc[group], stream);
+                    }
+                    stream_fence();
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue &queue, side *left_right, int64_t *m, int64_t *n,
                            const double **a, int64_t *lda, const double **x, int64_t *incx,
                            double **c, int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ddgmm_batch_group_usm>(cgh, [=]() {
+            int64_t output_bytes = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                output_bytes += groupsize[group] * m[group] * n[group] * sizeof(double);
+            }
+            const bool stream = use_streaming_stores(output_bytes);
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_streaming_grain_size(2 * m[group] * n[group] * sizeof(double));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        dgmm_kernel(MAJOR, left_right[group], m[group], n[group], a[i], lda[group],
+                                    x[i], incx[group], c[i], ldc[group], stream);
+                    }
+                    stream_fence();
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue &queue, side *left_right, int64_t *m, int64_t *n,
@@ -895,12 +1564,34 @@ sycl::event dgmm_batch(sycl::queue &queue, side *left_right, int64_t *m, int64_t
                            const std::complex<float> **x, int64_t *incx, std::complex<float> **c,
                            int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cdgmm_batch_group_usm>(cgh, [=]() {
+            int64_t output_bytes = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                output_bytes +=
+                    groupsize[group] * m[group] * n[group] * sizeof(std::complex<float>);
+            }
+            const bool stream = use_streaming_stores(output_bytes);
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_streaming_grain_size(2 * m[group] * n[group] * sizeof(std::complex<float>));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        dgmm_kernel(MAJOR, left_right[group], m[group], n[group], a[i], lda[group],
+                                    x[i], incx[group], c[i], ldc[group], stream);
+                    }
+                    stream_fence();
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue &queue, side *left_right, int64_t *m, int64_t *n,
@@ -908,12 +1599,34 @@ sycl::event dgmm_batch(sycl::queue &queue, side *left_right, int64_t *m, int64_t
                            const std::complex<double> **x, int64_t *incx, std::complex<double> **c,
                            int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zdgmm_batch_group_usm>(cgh, [=]() {
+            int64_t output_bytes = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                output_bytes +=
+                    groupsize[group] * m[group] * n[group] * sizeof(std::complex<double>);
+            }
+            const bool stream = use_streaming_stores(output_bytes);
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_streaming_grain_size(
+                    2 * m[group] * n[group] * sizeof(std::complex<double>));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        dgmm_kernel(MAJOR, left_right[group], m[group], n[group], a[i], lda[group],
+                                    x[i], incx[group], c[i], ldc[group], stream);
+                    }
+                    stream_fence();
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -921,12 +1634,35 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const float **b, int64_t *ldb, float *beta, float **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_group_usm>(cgh, [=]() {
+            auto work = schedule_group_batch(group_count, group_size, m, n, k, gemm_flops<float>);
+            parallel_for(work.size(), 1, [&](int64_t begin, int64_t end) {
+                for (int64_t t = begin; t < end; t++) {
+                    for (const auto &item : work[t]) {
+                        const int64_t group = item.group;
+                        const int64_t offset_b =
+                            op_col_offset(MAJOR, transb[group], ldb[group], item.col_begin);
+                        const int64_t offset_c =
+                            matrix_offset(MAJOR, ldc[group], 0, item.col_begin);
+                        ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa[group]),
+                                      convert_to_cblas_trans(transb[group]), (const int)m[group],
+                                      (const int)(item.col_end - item.col_begin),
+                                      (const int)k[group], (const float)alpha[group],
+                                      a[item.matrix], (const int)lda[group],
+                                      b[item.matrix] + offset_b, (const int)ldb[group],
+                                      (const float)beta[group], c[item.matrix] + offset_c,
+                                      (const int)ldc[group]);
+                    }
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -934,12 +1670,35 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const double **b, int64_t *ldb, double *beta, double **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_group_usm>(cgh, [=]() {
+            auto work = schedule_group_batch(group_count, group_size, m, n, k, gemm_flops<double>);
+            parallel_for(work.size(), 1, [&](int64_t begin, int64_t end) {
+                for (int64_t t = begin; t < end; t++) {
+                    for (const auto &item : work[t]) {
+                        const int64_t group = item.group;
+                        const int64_t offset_b =
+                            op_col_offset(MAJOR, transb[group], ldb[group], item.col_begin);
+                        const int64_t offset_c =
+                            matrix_offset(MAJOR, ldc[group], 0, item.col_begin);
+                        ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa[group]),
+                                      convert_to_cblas_trans(transb[group]), (const int)m[group],
+                                      (const int)(item.col_end - item.col_begin),
+                                      (const int)k[group], (const double)alpha[group],
+                                      a[item.matrix], (const int)lda[group],
+                                      b[item.matrix] + offset_b, (const int)ldb[group],
+                                      (const double)beta[group], c[item.matrix] + offset_c,
+                                      (const int)ldc[group]);
+                    }
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -948,12 +1707,36 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const std::complex<float> **b, int64_t *ldb, std::complex<float> *beta,
                            std::complex<float> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_group_usm>(cgh, [=]() {
+            auto work = schedule_group_batch(group_count, group_size, m, n, k,
+                                             gemm_flops<std::complex<float>>);
+            parallel_for(work.size(), 1, [&](int64_t begin, int64_t end) {
+                for (int64_t t = begin; t < end; t++) {
+                    for (const auto &item : work[t]) {
+                        const int64_t group = item.group;
+                        const int64_t offset_b =
+                            op_col_offset(MAJOR, transb[group], ldb[group], item.col_begin);
+                        const int64_t offset_c =
+                            matrix_offset(MAJOR, ldc[group], 0, item.col_begin);
+                        ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa[group]),
+                                      convert_to_cblas_trans(transb[group]), (const int)m[group],
+                                      (const int)(item.col_end - item.col_begin),
+                                      (const int)k[group], (const void *)&alpha[group],
+                                      a[item.matrix], (const int)lda[group],
+                                      b[item.matrix] + offset_b, (const int)ldb[group],
+                                      (const void *)&beta[group], c[item.matrix] + offset_c,
+                                      (const int)ldc[group]);
+                    }
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -962,12 +1745,36 @@ sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb,
                            const std::complex<double> **b, int64_t *ldb, std::complex<double> *beta,
                            std::complex<double> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_group_usm>(cgh, [=]() {
+            auto work = schedule_group_batch(group_count, group_size, m, n, k,
+                                             gemm_flops<std::complex<double>>);
+            parallel_for(work.size(), 1, [&](int64_t begin, int64_t end) {
+                for (int64_t t = begin; t < end; t++) {
+                    for (const auto &item : work[t]) {
+                        const int64_t group = item.group;
+                        const int64_t offset_b =
+                            op_col_offset(MAJOR, transb[group], ldb[group], item.col_begin);
+                        const int64_t offset_c =
+                            matrix_offset(MAJOR, ldc[group], 0, item.col_begin);
+                        ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa[group]),
+                                      convert_to_cblas_trans(transb[group]), (const int)m[group],
+                                      (const int)(item.col_end - item.col_begin),
+                                      (const int)k[group], (const void *)&alpha[group],
+                                      a[item.matrix], (const int)lda[group],
+                                      b[item.matrix] + offset_b, (const int)ldb[group],
+                                      (const void *)&beta[group], c[item.matrix] + offset_c,
+                                      (const int)ldc[group]);
+                    }
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -988,12 +1795,25 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            int64_t stride_a, const float *b, int64_t ldb, int64_t stride_b,
                            float beta, float *c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(2 * m * n * k);
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa),
+                                  convert_to_cblas_trans(transb), (const int)m, (const int)n,
+                                  (const int)k, (const float)alpha, a + i * stride_a,
+                                  (const int)lda, b + i * stride_b, (const int)ldb,
+                                  (const float)beta, c + i * stride_c, (const int)ldc);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1001,12 +1821,25 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            int64_t stride_a, const double *b, int64_t ldb, int64_t stride_b,
                            double beta, double *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(2 * m * n * k);
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa),
+                                  convert_to_cblas_trans(transb), (const int)m, (const int)n,
+                                  (const int)k, (const double)alpha, a + i * stride_a,
+                                  (const int)lda, b + i * stride_b, (const int)ldb,
+                                  (const double)beta, c + i * stride_c, (const int)ldc);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1016,12 +1849,25 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(8 * m * n * k);
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa),
+                                  convert_to_cblas_trans(transb), (const int)m, (const int)n,
+                                  (const int)k, (const void *)&alpha, a + i * stride_a,
+                                  (const int)lda, b + i * stride_b, (const int)ldb,
+                                  (const void *)&beta, c + i * stride_c, (const int)ldc);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1031,12 +1877,25 @@ sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, i
                            std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(8 * m * n * k);
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa),
+                                  convert_to_cblas_trans(transb), (const int)m, (const int)n,
+                                  (const int)k, (const void *)&alpha, a + i * stride_a,
+                                  (const int)lda, b + i * stride_b, (const int)ldb,
+                                  (const void *)&beta, c + i * stride_c, (const int)ldc);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -1057,12 +1916,22 @@ sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
                            const float *a, int64_t lda, int64_t stride_a, float *b, int64_t ldb,
                            int64_t stride_b, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_strsm_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(trsm_flops<float>(left_right, m, n));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_trsm(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a + i * stride_a, lda, b + i * stride_b, ldb);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1070,12 +1939,22 @@ sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
                            const double *a, int64_t lda, int64_t stride_a, double *b, int64_t ldb,
                            int64_t stride_b, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dtrsm_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(trsm_flops<double>(left_right, m, n));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_trsm(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a + i * stride_a, lda, b + i * stride_b, ldb);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1083,12 +1962,22 @@ sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
                            std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
                            int64_t stride_a, std::complex<float> *b, int64_t ldb, int64_t stride_b,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ctrsm_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(trsm_flops<std::complex<float>>(left_right, m, n));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_trsm(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a + i * stride_a, lda, b + i * stride_b, ldb);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1096,12 +1985,23 @@ sycl::event trsm_batch(sycl::queue &queue, side left_right, uplo upper_lower,
                            std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
                            int64_t stride_a, std::complex<double> *b, int64_t ldb, int64_t stride_b,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ztrsm_batch_usm>(cgh, [=]() {
+            const int64_t grain =
+                get_grain_size(trsm_flops<std::complex<double>>(left_right, m, n));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_trsm(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a + i * stride_a, lda, b + i * stride_b, ldb);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -1109,12 +2009,28 @@ sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
                            const float **a, int64_t *lda, float **b, int64_t *ldb,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_strsm_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_grain_size(trsm_flops<float>(left_right[group], m[group], n[group]));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        small_trsm(MAJOR, left_right[group], upper_lower[group], trans[group],
+                                   unit_diag[group], m[group], n[group], alpha[group], a[i],
+                                   lda[group], b[i], ldb[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -1122,12 +2038,28 @@ sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
                            const double **a, int64_t *lda, double **b, int64_t *ldb,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dtrsm_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_grain_size(trsm_flops<double>(left_right[group], m[group], n[group]));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        small_trsm(MAJOR, left_right[group], upper_lower[group], trans[group],
+                                   unit_diag[group], m[group], n[group], alpha[group], a[i],
+                                   lda[group], b[i], ldb[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -1135,12 +2067,28 @@ sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
                            std::complex<float> *alpha, const std::complex<float> **a, int64_t *lda,
                            std::complex<float> **b, int64_t *ldb, int64_t group_count,
                            int64_t *groupsize, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ctrsm_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_grain_size(
+                    trsm_flops<std::complex<float>>(left_right[group], m[group], n[group]));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        small_trsm(MAJOR, left_right[group], upper_lower[group], trans[group],
+                                   unit_diag[group], m[group], n[group], alpha[group], a[i],
+                                   lda[group], b[i], ldb[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -1149,36 +2097,80 @@ sycl::event trsm_batch(sycl::queue &queue, side *left_right, uplo *upper_lower,
                            int64_t *lda, std::complex<double> **b, int64_t *ldb,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ztrsm_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_grain_size(
+                    trsm_flops<std::complex<double>>(left_right[group], m[group], n[group]));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        small_trsm(MAJOR, left_right[group], upper_lower[group], trans[group],
+                                   unit_diag[group], m[group], n[group], alpha[group], a[i],
+                                   lda[group], b[i], ldb[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue &queue, uplo *upper_lower, transpose *trans, int64_t *n,
                            int64_t *k, float *alpha, const float **a, int64_t *lda, float *beta,
                            float **c, int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssyrk_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_grain_size(syrk_flops<float>(n[group], k[group]));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        small_syrk(MAJOR, upper_lower[group], trans[group], n[group], k[group],
+                                   alpha[group], a[i], lda[group], beta[group], c[i], ldc[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue &queue, uplo *upper_lower, transpose *trans, int64_t *n,
                            int64_t *k, double *alpha, const double **a, int64_t *lda, double *beta,
                            double **c, int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsyrk_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain = get_grain_size(syrk_flops<double>(n[group], k[group]));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        small_syrk(MAJOR, upper_lower[group], trans[group], n[group], k[group],
+                                   alpha[group], a[i], lda[group], beta[group], c[i], ldc[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue &queue, uplo *upper_lower, transpose *trans, int64_t *n,
@@ -1186,12 +2178,27 @@ sycl::event syrk_batch(sycl::queue &queue, uplo *upper_lower, transpose *trans,
                            int64_t *lda, std::complex<float> *beta, std::complex<float> **c,
                            int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_csyrk_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_grain_size(syrk_flops<std::complex<float>>(n[group], k[group]));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        small_syrk(MAJOR, upper_lower[group], trans[group], n[group], k[group],
+                                   alpha[group], a[i], lda[group], beta[group], c[i], ldc[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue &queue, uplo *upper_lower, transpose *trans, int64_t *n,
@@ -1199,36 +2206,71 @@ sycl::event syrk_batch(sycl::queue &queue, uplo *upper_lower, transpose *trans,
                            int64_t *lda, std::complex<double> *beta, std::complex<double> **c,
                            int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zsyrk_batch_group_usm>(cgh, [=]() {
+            int64_t offset = 0;
+            for (int64_t group = 0; group < group_count; group++) {
+                const int64_t grain =
+                    get_grain_size(syrk_flops<std::complex<double>>(n[group], k[group]));
+                parallel_for(groupsize[group], grain, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = offset + begin; i < offset + end; i++) {
+                        small_syrk(MAJOR, upper_lower[group], trans[group], n[group], k[group],
+                                   alpha[group], a[i], lda[group], beta[group], c[i], ldc[group]);
+                    }
+                });
+                offset += groupsize[group];
+            }
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                            int64_t k, float alpha, const float *a, int64_t lda, int64_t stride_a,
                            float beta, float *c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssyrk_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(syrk_flops<float>(n, k));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_syrk(MAJOR, upper_lower, trans, n, k, alpha, a + i * stride_a, lda, beta,
+                               c + i * stride_c, ldc);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                            int64_t k, double alpha, const double *a, int64_t lda, int64_t stride_a,
                            double beta, double *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsyrk_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(syrk_flops<double>(n, k));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_syrk(MAJOR, upper_lower, trans, n, k, alpha, a + i * stride_a, lda, beta,
+                               c + i * stride_c, ldc);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
@@ -1236,12 +2278,22 @@ sycl::event syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, in
                            int64_t lda, int64_t stride_a, std::complex<float> beta,
                            std::complex<float> *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_csyrk_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(syrk_flops<std::complex<float>>(n, k));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_syrk(MAJOR, upper_lower, trans, n, k, alpha, a + i * stride_a, lda, beta,
+                               c + i * stride_c, ldc);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
@@ -1249,12 +2301,22 @@ sycl::event syrk_batch(sycl::queue &queue, uplo upper_lower, transpose trans, in
                            int64_t lda, int64_t stride_a, std::complex<double> beta,
                            std::complex<double> *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zsyrk_batch_usm>(cgh, [=]() {
+            const int64_t grain = get_grain_size(syrk_flops<std::complex<double>>(n, k));
+            parallel_for(batch_size, grain, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; i++) {
+                    small_syrk(MAJOR, upper_lower, trans, n, k, alpha, a + i * stride_a, lda, beta,
+                               c + i * stride_c, ldc);
+                }
+            });
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy_batch(sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
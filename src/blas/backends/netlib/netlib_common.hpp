@@ -25,10 +25,20 @@
 #else
 #include <CL/sycl.hpp>
 #endif
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <type_traits>
+#include <vector>
 
 #include "cblas.h"
 
+#include "host_thread_pool.hpp"
+
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
 #include "oneapi/mkl/types.hpp"
 
@@ -74,6 +84,143 @@ inline CBLAS_OFFSET convert_to_cblas_offset(offset offsetc) {
         return CBLAS_OFFSET::CblasRowOffset;
 }
 
+// Type-generic wrappers around CBLAS routines, used by the code
+//  paths that split a call into several smaller CBLAS calls.
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                       const float *b, int64_t ldb, float beta, float *c, int64_t ldc) {
+    ::cblas_sgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, alpha, a, (const int)lda, b,
+                  (const int)ldb, beta, c, (const int)ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
+                       const double *b, int64_t ldb, double beta, double *c, int64_t ldc) {
+    ::cblas_dgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, alpha, a, (const int)lda, b,
+                  (const int)ldb, beta, c, (const int)ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<float> alpha,
+                       const std::complex<float> *a, int64_t lda, const std::complex<float> *b,
+                       int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                       int64_t ldc) {
+    ::cblas_cgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
+                  (const int)lda, b, (const int)ldb, (const void *)&beta, c, (const int)ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<double> alpha,
+                       const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
+                       int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                       int64_t ldc) {
+    ::cblas_zgemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
+                  (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
+                  (const int)lda, b, (const int)ldb, (const void *)&beta, c, (const int)ldc);
+}
+
+inline void cblas_gemv(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n, float alpha,
+                       const float *a, int64_t lda, const float *x, int64_t incx, float beta,
+                       float *y, int64_t incy) {
+    ::cblas_sgemv(layout, convert_to_cblas_trans(trans), (const int)m, (const int)n, alpha, a,
+                  (const int)lda, x, (const int)incx, beta, y, (const int)incy);
+}
+
+inline void cblas_gemv(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n, double alpha,
+                       const double *a, int64_t lda, const double *x, int64_t incx, double beta,
+                       double *y, int64_t incy) {
+    ::cblas_dgemv(layout, convert_to_cblas_trans(trans), (const int)m, (const int)n, alpha, a,
+                  (const int)lda, x, (const int)incx, beta, y, (const int)incy);
+}
+
+inline void cblas_gemv(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n,
+                       std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                       const std::complex<float> *x, int64_t incx, std::complex<float> beta,
+                       std::complex<float> *y, int64_t incy) {
+    ::cblas_cgemv(layout, convert_to_cblas_trans(trans), (const int)m, (const int)n,
+                  (const void *)&alpha, a, (const int)lda, x, (const int)incx,
+                  (const void *)&beta, y, (const int)incy);
+}
+
+inline void cblas_gemv(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n,
+                       std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                       const std::complex<double> *x, int64_t incx, std::complex<double> beta,
+                       std::complex<double> *y, int64_t incy) {
+    ::cblas_zgemv(layout, convert_to_cblas_trans(trans), (const int)m, (const int)n,
+                  (const void *)&alpha, a, (const int)lda, x, (const int)incx,
+                  (const void *)&beta, y, (const int)incy);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n,
+                       int64_t k, float alpha, const float *a, int64_t lda, float beta, float *c,
+                       int64_t ldc) {
+    ::cblas_ssyrk(layout, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                  (const int)n, (const int)k, alpha, a, (const int)lda, beta, c, (const int)ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n,
+                       int64_t k, double alpha, const double *a, int64_t lda, double beta,
+                       double *c, int64_t ldc) {
+    ::cblas_dsyrk(layout, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                  (const int)n, (const int)k, alpha, a, (const int)lda, beta, c, (const int)ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n,
+                       int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                       int64_t lda, std::complex<float> beta, std::complex<float> *c,
+                       int64_t ldc) {
+    ::cblas_csyrk(layout, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                  (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda,
+                  (const void *)&beta, c, (const int)ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n,
+                       int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                       int64_t lda, std::complex<double> beta, std::complex<double> *c,
+                       int64_t ldc) {
+    ::cblas_zsyrk(layout, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                  (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda,
+                  (const void *)&beta, c, (const int)ldc);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose transa,
+                       diag unit_diag, int64_t m, int64_t n, float alpha, const float *a,
+                       int64_t lda, float *b, int64_t ldb) {
+    ::cblas_strsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(transa), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose transa,
+                       diag unit_diag, int64_t m, int64_t n, double alpha, const double *a,
+                       int64_t lda, double *b, int64_t ldb) {
+    ::cblas_dtrsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(transa), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose transa,
+                       diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
+                       const std::complex<float> *a, int64_t lda, std::complex<float> *b,
+                       int64_t ldb) {
+    ::cblas_ctrsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(transa), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose transa,
+                       diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
+                       const std::complex<double> *a, int64_t lda, std::complex<double> *b,
+                       int64_t ldb) {
+    ::cblas_ztrsm(layout, convert_to_cblas_side(left_right), convert_to_cblas_uplo(upper_lower),
+                  convert_to_cblas_trans(transa), convert_to_cblas_diag(unit_diag), (const int)m,
+                  (const int)n, (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+}
+
 // host_task automatically uses run_on_host_intel if it is supported by the
 //  compiler. Otherwise, it falls back to single_task.
 template <typename K, typename H, typename F>
@@ -93,6 +240,157 @@ static inline void host_task(H &cgh, F f) {
     (void)host_task_internal<K>(cgh, f, 0);
 }
 
+// Number of host threads a single netlib call may use to process independent
+//  pieces of work (e.g. the matrices of a batch) inside its host_task.
+//  Defaults to the size of the shared host thread pool and can be lowered
+//  with the ONEMKL_NETLIB_NUM_THREADS environment variable.
+inline int64_t get_max_threads() {
+    static const int64_t max_threads = []() {
+        auto &pool = oneapi::mkl::detail::host_thread_pool::instance();
+        const int64_t pool_threads = pool.num_threads();
+        int64_t num_threads = 0;
+        if (const char *env = std::getenv("ONEMKL_NETLIB_NUM_THREADS"))
+            num_threads = std::atoll(env);
+        if (num_threads <= 0)
+            return pool_threads;
+        return std::min(num_threads, pool_threads);
+    }();
+    return max_threads;
+}
+
+// Smallest amount of work, in flops, worth handing to an additional thread.
+constexpr int64_t min_flops_per_thread = int64_t(1) << 17;
+
+// Number of consecutive items a thread should at least process so that each
+//  thread gets min_flops_per_thread of work.
+inline int64_t get_grain_size(int64_t flops_per_item) {
+    return std::max<int64_t>(1, min_flops_per_thread / std::max<int64_t>(flops_per_item, 1));
+}
+
+// Splits [0, count) into contiguous ranges of at least grain items and calls
+//  f(begin, end) for each range on the shared host thread pool. The calling
+//  thread processes ranges too, so small problems never leave it.
+template <typename F>
+inline void parallel_for(int64_t count, int64_t grain, F f) {
+    auto &pool = oneapi::mkl::detail::host_thread_pool::instance();
+    pool.parallel_for(count, grain, get_max_threads(), f);
+}
+
+template <typename T>
+struct is_complex : std::false_type {};
+template <typename T>
+struct is_complex<std::complex<T>> : std::true_type {};
+
+template <typename T>
+inline T conj_if(T x, bool) {
+    return x;
+}
+
+template <typename T>
+inline std::complex<T> conj_if(std::complex<T> x, bool conj) {
+    return conj ? std::conj(x) : x;
+}
+
+// Number of floating point operations of a gemm with the given dimensions.
+template <typename T>
+inline int64_t gemm_flops(int64_t m, int64_t n, int64_t k) {
+    return (is_complex<T>::value ? 8 : 2) * m * n * k;
+}
+
+// A piece of a group-API batch call assigned to one thread: columns
+//  [col_begin, col_end) of the output of matrix `matrix` of the flattened
+//  batch, which belongs to group `group`.
+struct group_work_item {
+    int64_t group;
+    int64_t matrix;
+    int64_t col_begin;
+    int64_t col_end;
+};
+
+// Distributes a group-API batch call over host threads so that every thread
+//  gets the same number of flops rather than the same number of matrices.
+//  Groups are bucketed by their (m, n, k) dimensions and buckets are handed
+//  out from the most to the least expensive one, so each thread works on
+//  matrices of similar sizes. A matrix whose cost exceeds the share left for
+//  the current thread is split into column panels of its n columns.
+//  flops(m, n, k) returns the cost of one matrix of the given dimensions.
+template <typename F>
+inline std::vector<std::vector<group_work_item>> schedule_group_batch(
+    int64_t group_count, const int64_t *group_size, const int64_t *m, const int64_t *n,
+    const int64_t *k, F flops) {
+    struct bucket {
+        double cost;
+        std::vector<int64_t> groups;
+    };
+    std::map<std::array<int64_t, 3>, bucket> buckets;
+    std::vector<int64_t> group_offset(group_count + 1, 0);
+    double total_cost = 0.0;
+    for (int64_t group = 0; group < group_count; group++) {
+        group_offset[group + 1] = group_offset[group] + group_size[group];
+        if (group_size[group] <= 0 || m[group] <= 0 || n[group] <= 0)
+            continue;
+        auto &entry = buckets[{ m[group], n[group], k[group] }];
+        entry.cost = std::max(static_cast<double>(flops(m[group], n[group], k[group])), 1.0);
+        entry.groups.push_back(group);
+        total_cost += entry.cost * group_size[group];
+    }
+
+    std::vector<const bucket *> order;
+    for (auto &entry : buckets)
+        order.push_back(&entry.second);
+    std::stable_sort(order.begin(), order.end(),
+                     [](const bucket *x, const bucket *y) { return x->cost > y->cost; });
+
+    const int64_t num_threads = std::max<int64_t>(
+        1, std::min<int64_t>(get_max_threads(),
+                             static_cast<int64_t>(total_cost / min_flops_per_thread)));
+    const double share = total_cost / num_threads;
+    std::vector<std::vector<group_work_item>> work(num_threads);
+    int64_t thread = 0;
+    double budget = share;
+    for (const bucket *entry : order) {
+        for (int64_t group : entry->groups) {
+            const double col_cost = entry->cost / n[group];
+            for (int64_t i = 0; i < group_size[group]; i++) {
+                int64_t col = 0;
+                while (col < n[group]) {
+                    int64_t cols = n[group] - col;
+                    if (thread < num_threads - 1 && cols * col_cost > budget) {
+                        cols = std::max<int64_t>(
+                            1, static_cast<int64_t>(std::ceil(budget / col_cost)));
+                        cols = std::min(cols, n[group] - col);
+                    }
+                    work[thread].push_back({ group, group_offset[group] + i, col, col + cols });
+                    col += cols;
+                    budget -= cols * col_cost;
+                    if (budget <= 0.0 && thread < num_threads - 1) {
+                        thread++;
+                        budget += share;
+                    }
+                }
+            }
+        }
+    }
+    return work;
+}
+
+// Offset of row i of op(X), for a matrix X stored with leading dimension ld.
+inline int64_t op_row_offset(CBLAS_LAYOUT layout, transpose trans, int64_t ld, int64_t i) {
+    bool col_major = layout == CBLAS_LAYOUT::CblasColMajor;
+    return (col_major == (trans == transpose::nontrans)) ? i : i * ld;
+}
+
+// Offset of column j of op(X), for a matrix X stored with leading dimension ld.
+inline int64_t op_col_offset(CBLAS_LAYOUT layout, transpose trans, int64_t ld, int64_t j) {
+    bool col_major = layout == CBLAS_LAYOUT::CblasColMajor;
+    return (col_major == (trans == transpose::nontrans)) ? j * ld : j;
+}
+
+// Offset of element (i, j) of a matrix stored with leading dimension ld.
+inline int64_t matrix_offset(CBLAS_LAYOUT layout, int64_t ld, int64_t i, int64_t j) {
+    return layout == CBLAS_LAYOUT::CblasColMajor ? i + j * ld : i * ld + j;
+}
+
 } // namespace netlib
 } // namespace blas
 } // namespace mkl
@@ -24,6 +24,9 @@
 #endif
 
 #include "netlib_common.hpp"
+#include "netlib_gemm.hpp"
+#include "netlib_tiling.hpp"
+#include "netlib_transpose.hpp"
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 
@@ -33,15 +36,19 @@ namespace blas {
 namespace netlib {
 namespace column_major {
 
+#define MAJOR CblasColMajor
 #define COLUMN_MAJOR
 #include "netlib_extensions.cxx"
+#undef MAJOR
 #undef COLUMN_MAJOR
 
 } // namespace column_major
 namespace row_major {
 
+#define MAJOR CblasRowMajor
 #define ROW_MAJOR
 #include "netlib_extensions.cxx"
+#undef MAJOR
 #undef ROW_MAJOR
 
 } // namespace row_major
@@ -24,12 +24,17 @@ void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset of
                int64_t lda, int8_t ao, sycl::buffer<int8_t, 1> &b, int64_t ldb, int8_t bo,
                float beta, sycl::buffer<int32_t, 1> &c, int64_t ldc,
                sycl::buffer<int32_t, 1> &co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_s8s8>(cgh, [=]() {
+            native_gemm_bias(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                             accessor_a.get_pointer(), lda, ao, accessor_b.get_pointer(), ldb, bo,
+                             beta, accessor_c.get_pointer(), ldc, accessor_co.get_pointer());
+        });
+    });
 }
 
 void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -37,12 +42,17 @@ void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset of
                int64_t lda, int8_t ao, sycl::buffer<uint8_t, 1> &b, int64_t ldb, uint8_t bo,
                float beta, sycl::buffer<int32_t, 1> &c, int64_t ldc,
                sycl::buffer<int32_t, 1> &co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_s8u8>(cgh, [=]() {
+            native_gemm_bias(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                             accessor_a.get_pointer(), lda, ao, accessor_b.get_pointer(), ldb, bo,
+                             beta, accessor_c.get_pointer(), ldc, accessor_co.get_pointer());
+        });
+    });
 }
 
 void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -50,12 +60,17 @@ void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset of
                int64_t lda, uint8_t ao, sycl::buffer<int8_t, 1> &b, int64_t ldb, int8_t bo,
                float beta, sycl::buffer<int32_t, 1> &c, int64_t ldc,
                sycl::buffer<int32_t, 1> &co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_u8s8>(cgh, [=]() {
+            native_gemm_bias(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                             accessor_a.get_pointer(), lda, ao, accessor_b.get_pointer(), ldb, bo,
+                             beta, accessor_c.get_pointer(), ldc, accessor_co.get_pointer());
+        });
+    });
 }
 
 void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -63,188 +78,241 @@ void gemm_bias(sycl::queue &queue, transpose transa, transpose transb, offset of
                int64_t lda, uint8_t ao, sycl::buffer<uint8_t, 1> &b, int64_t ldb, uint8_t bo,
                float beta, sycl::buffer<int32_t, 1> &c, int64_t ldc,
                sycl::buffer<int32_t, 1> &co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_u8u8>(cgh, [=]() {
+            native_gemm_bias(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                             accessor_a.get_pointer(), lda, ao, accessor_b.get_pointer(), ldb, bo,
+                             beta, accessor_c.get_pointer(), ldc, accessor_co.get_pointer());
+        });
+    });
 }
 
 void gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, int64_t n,
            int64_t k, float alpha, sycl::buffer<float, 1> &a, int64_t lda,
            sycl::buffer<float, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
            int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemmt>(cgh, [=]() {
+            tiled_gemmt<float>(MAJOR, upper_lower, transa, transb, n, k, alpha,
+                               accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
+                               accessor_c.get_pointer(), ldc);
+        });
+    });
 }
 
 void gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, int64_t n,
            int64_t k, double alpha, sycl::buffer<double, 1> &a, int64_t lda,
            sycl::buffer<double, 1> &b, int64_t ldb, double beta, sycl::buffer<double, 1> &c,
            int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemmt>(cgh, [=]() {
+            tiled_gemmt<double>(MAJOR, upper_lower, transa, transb, n, k, alpha,
+                                accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
+                                accessor_c.get_pointer(), ldc);
+        });
+    });
 }
 
 void gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, int64_t n,
            int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
            int64_t lda, sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
            std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemmt>(cgh, [=]() {
+            tiled_gemmt<std::complex<float>>(MAJOR, upper_lower, transa, transb, n, k, alpha,
+                                             accessor_a.get_pointer(), lda,
+                                             accessor_b.get_pointer(), ldb, beta,
+                                             accessor_c.get_pointer(), ldc);
+        });
+    });
 }
 
 void gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb, int64_t n,
            int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
            int64_t lda, sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
            std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemmt>(cgh, [=]() {
+            tiled_gemmt<std::complex<double>>(MAJOR, upper_lower, transa, transb, n, k, alpha,
+                                              accessor_a.get_pointer(), lda,
+                                              accessor_b.get_pointer(), ldb, beta,
+                                              accessor_c.get_pointer(), ldc);
+        });
+    });
 }
 
 void omatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
               sycl::buffer<float, 1> &a, int64_t lda, sycl::buffer<float, 1> &b, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_somatcopy>(cgh, [=]() {
+            omatcopy_kernel<float>(MAJOR, trans, m, n, alpha, accessor_a.get_pointer(), lda,
+                                   accessor_b.get_pointer(), ldb);
+        });
+    });
 }
 
 void omatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
               sycl::buffer<double, 1> &a, int64_t lda, sycl::buffer<double, 1> &b, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_domatcopy>(cgh, [=]() {
+            omatcopy_kernel<double>(MAJOR, trans, m, n, alpha, accessor_a.get_pointer(), lda,
+                                    accessor_b.get_pointer(), ldb);
+        });
+    });
 }
 
 void omatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::complex<float> alpha,
               sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
               sycl::buffer<std::complex<float>, 1> &b, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_comatcopy>(cgh, [=]() {
+            omatcopy_kernel<std::complex<float>>(MAJOR, trans, m, n, alpha,
+                                                 accessor_a.get_pointer(), lda,
+                                                 accessor_b.get_pointer(), ldb);
+        });
+    });
 }
 
 void omatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::complex<double> alpha,
               sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
               sycl::buffer<std::complex<double>, 1> &b, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zomatcopy>(cgh, [=]() {
+            omatcopy_kernel<std::complex<double>>(MAJOR, trans, m, n, alpha,
+                                                  accessor_a.get_pointer(), lda,
+                                                  accessor_b.get_pointer(), ldb);
+        });
+    });
 }
 
 void imatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
               sycl::buffer<float, 1> &ab, int64_t lda, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_ab = ab.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_simatcopy>(cgh, [=]() {
+            imatcopy_kernel<float>(MAJOR, trans, m, n, alpha, accessor_ab.get_pointer(), lda, ldb);
+        });
+    });
 }
 
 void imatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
               sycl::buffer<double, 1> &ab, int64_t lda, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_ab = ab.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dimatcopy>(cgh, [=]() {
+            imatcopy_kernel<double>(MAJOR, trans, m, n, alpha, accessor_ab.get_pointer(), lda, ldb);
+        });
+    });
 }
 
 void imatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::complex<float> alpha,
               sycl::buffer<std::complex<float>, 1> &ab, int64_t lda, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_ab = ab.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cimatcopy>(cgh, [=]() {
+            imatcopy_kernel<std::complex<float>>(MAJOR, trans, m, n, alpha,
+                                                 accessor_ab.get_pointer(), lda, ldb);
+        });
+    });
 }
 
 void imatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::complex<double> alpha,
               sycl::buffer<std::complex<double>, 1> &ab, int64_t lda, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_ab = ab.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zimatcopy>(cgh, [=]() {
+            imatcopy_kernel<std::complex<double>>(MAJOR, trans, m, n, alpha,
+                                                  accessor_ab.get_pointer(), lda, ldb);
+        });
+    });
 }
 
 void omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
              float alpha, sycl::buffer<float, 1> &a, int64_t lda, float beta,
              sycl::buffer<float, 1> &b, int64_t ldb, sycl::buffer<float, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_somatadd>(cgh, [=]() {
+            omatadd_kernel<float>(MAJOR, transa, transb, m, n, alpha, accessor_a.get_pointer(), lda,
+                                  beta, accessor_b.get_pointer(), ldb, accessor_c.get_pointer(),
+                                  ldc);
+        });
+    });
 }
 
 void omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
              double alpha, sycl::buffer<double, 1> &a, int64_t lda, double beta,
              sycl::buffer<double, 1> &b, int64_t ldb, sycl::buffer<double, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_domatadd>(cgh, [=]() {
+            omatadd_kernel<double>(MAJOR, transa, transb, m, n, alpha, accessor_a.get_pointer(),
+                                   lda, beta, accessor_b.get_pointer(), ldb,
+                                   accessor_c.get_pointer(), ldc);
+        });
+    });
 }
 
 void omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
              std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
              std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
              sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_comatadd>(cgh, [=]() {
+            omatadd_kernel<std::complex<float>>(MAJOR, transa, transb, m, n, alpha,
+                                                accessor_a.get_pointer(), lda, beta,
+                                                accessor_b.get_pointer(), ldb,
+                                                accessor_c.get_pointer(), ldc);
+        });
+    });
 }
 
 void omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
              std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
              std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
              sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zomatadd>(cgh, [=]() {
+            omatadd_kernel<std::complex<double>>(MAJOR, transa, transb, m, n, alpha,
+                                                 accessor_a.get_pointer(), lda, beta,
+                                                 accessor_b.get_pointer(), ldb,
+                                                 accessor_c.get_pointer(), ldc);
+        });
+    });
 }
 
 void omatcopy_batch(sycl::queue& queue, transpose* trans, int64_t* m, int64_t* n, float* alpha,
@@ -300,12 +368,17 @@ sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
                           const int8_t *a, int64_t lda, int8_t ao, const int8_t *b, int64_t ldb,
                           int8_t bo, float beta, int32_t *c, int64_t ldc, const int32_t *co,
                           const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_s8s8_usm>(cgh, [=]() {
+            native_gemm_bias(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                             bo, beta, c, ldc, co);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
@@ -313,12 +386,17 @@ sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
                           const int8_t *a, int64_t lda, int8_t ao, const uint8_t *b, int64_t ldb,
                           uint8_t bo, float beta, int32_t *c, int64_t ldc, const int32_t *co,
                           const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_s8u8_usm>(cgh, [=]() {
+            native_gemm_bias(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                             bo, beta, c, ldc, co);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
@@ -326,12 +404,17 @@ sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
                           const uint8_t *a, int64_t lda, uint8_t ao, const int8_t *b, int64_t ldb,
                           int8_t bo, float beta, int32_t *c, int64_t ldc, const int32_t *co,
                           const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_u8s8_usm>(cgh, [=]() {
+            native_gemm_bias(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                             bo, beta, c, ldc, co);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
@@ -339,36 +422,51 @@ sycl::event gemm_bias(sycl::queue &queue, transpose transa, transpose transb,
                           const uint8_t *a, int64_t lda, uint8_t ao, const uint8_t *b, int64_t ldb,
                           uint8_t bo, float beta, int32_t *c, int64_t ldc, const int32_t *co,
                           const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_u8u8_usm>(cgh, [=]() {
+            native_gemm_bias(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                             bo, beta, c, ldc, co);
+        });
+    });
+    return done;
 }
 
 sycl::event gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
                       int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
                       const float *b, int64_t ldb, float beta, float *c, int64_t ldc,
                       const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemmt_usm>(cgh, [=]() {
+            tiled_gemmt<float>(MAJOR, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb,
+                               beta, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
                       int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
                       const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
                       const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemmt_usm>(cgh, [=]() {
+            tiled_gemmt<double>(MAJOR, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb,
+                                beta, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
@@ -376,12 +474,17 @@ sycl::event gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transp
                       int64_t lda, const std::complex<float> *b, int64_t ldb,
                       std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                       const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemmt_usm>(cgh, [=]() {
+            tiled_gemmt<std::complex<float>>(MAJOR, upper_lower, transa, transb, n, k, alpha, a,
+                                             lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transpose transb,
@@ -389,126 +492,172 @@ sycl::event gemmt(sycl::queue &queue, uplo upper_lower, transpose transa, transp
                       const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
                       int64_t ldb, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                       const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemmt_usm>(cgh, [=]() {
+            tiled_gemmt<std::complex<double>>(MAJOR, upper_lower, transa, transb, n, k, alpha, a,
+                                              lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
                      const float *a, int64_t lda, float *b, int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_somatcopy_usm>(cgh, [=]() {
+            omatcopy_kernel<float>(MAJOR, trans, m, n, alpha, a, lda, b, ldb);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
                      const double *a, int64_t lda, double *b, int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_domatcopy_usm>(cgh, [=]() {
+            omatcopy_kernel<double>(MAJOR, trans, m, n, alpha, a, lda, b, ldb);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
                      std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
                      std::complex<float> *b, int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_comatcopy_usm>(cgh, [=]() {
+            omatcopy_kernel<std::complex<float>>(MAJOR, trans, m, n, alpha, a, lda, b, ldb);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
                      std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
                      std::complex<double> *b, int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zomatcopy_usm>(cgh, [=]() {
+            omatcopy_kernel<std::complex<double>>(MAJOR, trans, m, n, alpha, a, lda, b, ldb);
+        });
+    });
+    return done;
 }
 
 sycl::event imatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, float alpha,
                      float *ab, int64_t lda, int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_simatcopy_usm>(cgh, [=]() {
+            imatcopy_kernel<float>(MAJOR, trans, m, n, alpha, ab, lda, ldb);
+        });
+    });
+    return done;
 }
 
 sycl::event imatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n, double alpha,
                      double *ab, int64_t lda, int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dimatcopy_usm>(cgh, [=]() {
+            imatcopy_kernel<double>(MAJOR, trans, m, n, alpha, ab, lda, ldb);
+        });
+    });
+    return done;
 }
 
 sycl::event imatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
                      std::complex<float> alpha, std::complex<float> *ab, int64_t lda, int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cimatcopy_usm>(cgh, [=]() {
+            imatcopy_kernel<std::complex<float>>(MAJOR, trans, m, n, alpha, ab, lda, ldb);
+        });
+    });
+    return done;
 }
 
 sycl::event imatcopy(sycl::queue &queue, transpose trans, int64_t m, int64_t n,
                      std::complex<double> alpha, std::complex<double> *ab, int64_t lda, int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zimatcopy_usm>(cgh, [=]() {
+            imatcopy_kernel<std::complex<double>>(MAJOR, trans, m, n, alpha, ab, lda, ldb);
+        });
+    });
+    return done;
 }
 
 sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
                     float alpha, const float *a, int64_t lda, float beta, const float *b,
                     int64_t ldb, float *c, int64_t ldc,
                     const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_somatadd_usm>(cgh, [=]() {
+            omatadd_kernel<float>(MAJOR, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
                     double alpha, const double *a, int64_t lda, double beta, const double *b,
                     int64_t ldb, double *c, int64_t ldc,
                     const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_domatadd_usm>(cgh, [=]() {
+            omatadd_kernel<double>(MAJOR, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c,
+                                   ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -516,12 +665,17 @@ sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, int6
                     std::complex<float> beta, const std::complex<float> *b, int64_t ldb,
                     std::complex<float> *c, int64_t ldc,
                     const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_comatadd_usm>(cgh, [=]() {
+            omatadd_kernel<std::complex<float>>(MAJOR, transa, transb, m, n, alpha, a, lda, beta, b,
+                                                ldb, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -529,12 +683,17 @@ sycl::event omatadd(sycl::queue &queue, transpose transa, transpose transb, int6
                     std::complex<double> beta, const std::complex<double> *b, int64_t ldb,
                     std::complex<double> *c, int64_t ldc,
                     const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zomatadd_usm>(cgh, [=]() {
+            omatadd_kernel<std::complex<double>>(MAJOR, transa, transb, m, n, alpha, a, lda, beta,
+                                                 b, ldb, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy_batch(sycl::queue& queue, transpose* trans, int64_t* m, int64_t* n,
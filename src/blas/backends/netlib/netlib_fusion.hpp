@@ -0,0 +1,235 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_FUSION_HPP_
+#define _NETLIB_FUSION_HPP_
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "netlib_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Fusion of consecutive level 1 and level 2 USM calls on an in-order queue
+ * into a single host_task.
+ *
+ * Every USM call normally submits its own host_task, so a chain of short
+ * dependent calls pays one round trip through the SYCL scheduler per call.
+ * With fusion enabled, a call on an in-order queue whose dependencies are
+ * complete or are the event of the queue's open host_task is appended to the
+ * work list of that host_task instead; the host_task runs its list in call
+ * order until it is empty, so calls appended while it runs are still picked
+ * up. All calls fused into one host_task return its event.
+ *
+ * A call is only fused when the open host_task is still the last command
+ * submitted to the queue, so work the application submits to the queue in
+ * between keeps its place in the order. This is checked with the last event
+ * of the queue from the sycl_ext_oneapi_in_order_queue_events extension;
+ * without it, calls are never fused.
+ *
+ * Fusion is off by default and is enabled with ONEMKL_NETLIB_FUSION=1.
+ */
+
+#ifdef SYCL_EXT_ONEAPI_IN_ORDER_QUEUE_EVENTS
+// The extension returned the last event first as a sycl::event, then as a
+//  std::optional, empty when nothing was submitted yet.
+inline bool is_event(const sycl::event &last, const sycl::event &event) {
+    return last == event;
+}
+
+template <typename Optional>
+inline bool is_event(const Optional &last, const sycl::event &event) {
+    return last && *last == event;
+}
+#endif
+
+// Whether event is the last command submitted to the in-order queue.
+inline bool is_last_submission(sycl::queue &queue, const sycl::event &event) {
+#ifdef SYCL_EXT_ONEAPI_IN_ORDER_QUEUE_EVENTS
+    return is_event(queue.ext_oneapi_get_last_event(), event);
+#else
+    return false;
+#endif
+}
+
+// Whether calls on queue are fused.
+inline bool use_fusion(sycl::queue &queue) {
+    static const bool enabled = []() {
+        const char *env = std::getenv("ONEMKL_NETLIB_FUSION");
+        return env != nullptr && std::strcmp(env, "1") == 0;
+    }();
+#ifdef SYCL_EXT_ONEAPI_IN_ORDER_QUEUE_EVENTS
+    return enabled && queue.is_in_order();
+#else
+    return false;
+#endif
+}
+
+// Stands in for sycl::handler to record the dependencies and the host_task
+//  closure of a command group.
+class host_task_recorder {
+public:
+    void depends_on(const sycl::event &event) {
+        dependencies.push_back(event);
+    }
+
+    template <typename F>
+    void host_task(F f) {
+        task = std::move(f);
+    }
+
+    std::vector<sycl::event> dependencies;
+    std::function<void()> task;
+};
+
+// Host tasks fused on one queue, run in order by a single host_task.
+struct fused_tasks {
+    std::mutex mutex;
+    std::vector<std::function<void()>> tasks;
+    bool open = true;
+    sycl::event event;
+};
+
+class fusion_registry {
+public:
+    static fusion_registry &instance() {
+        static fusion_registry registry;
+        return registry;
+    }
+
+    sycl::event append(sycl::queue &queue, const std::vector<sycl::event> &dependencies,
+                       std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto entry = open_tasks.find(queue);
+            if (entry != open_tasks.end()) {
+                std::shared_ptr<fused_tasks> fused = entry->second;
+                std::lock_guard<std::mutex> fused_lock(fused->mutex);
+                if (fused->open && satisfied(dependencies, fused->event) &&
+                    is_last_submission(queue, fused->event)) {
+                    fused->tasks.push_back(std::move(task));
+                    return fused->event;
+                }
+            }
+        }
+
+        // Submitted without holding the lock, as the host_task may run before
+        //  submit returns.
+        auto fused = std::make_shared<fused_tasks>();
+        fused->tasks.push_back(std::move(task));
+        sycl::event event = queue.submit([&](sycl::handler &cgh) {
+            int64_t num_events = dependencies.size();
+            for (int64_t i = 0; i < num_events; i++) {
+                cgh.depends_on(dependencies[i]);
+            }
+            host_task<class netlib_fused_usm>(cgh, [this, queue, fused]() { run(queue, fused); });
+        });
+
+        std::lock_guard<std::mutex> lock(mutex);
+        std::lock_guard<std::mutex> fused_lock(fused->mutex);
+        fused->event = event;
+        if (fused->open)
+            open_tasks[queue] = fused;
+        return event;
+    }
+
+private:
+    static bool satisfied(const std::vector<sycl::event> &dependencies, const sycl::event &open) {
+        for (const auto &event : dependencies) {
+            if (event != open &&
+                event.get_info<sycl::info::event::command_execution_status>() !=
+                    sycl::info::event_command_status::complete)
+                return false;
+        }
+        return true;
+    }
+
+    void run(sycl::queue queue, const std::shared_ptr<fused_tasks> &fused) {
+        std::vector<std::function<void()>> tasks;
+        while (true) {
+            {
+                std::lock_guard<std::mutex> fused_lock(fused->mutex);
+                tasks.swap(fused->tasks);
+            }
+            if (tasks.empty()) {
+                // Close the list, unless a call was appended in the meantime.
+                std::lock_guard<std::mutex> lock(mutex);
+                std::lock_guard<std::mutex> fused_lock(fused->mutex);
+                if (!fused->tasks.empty())
+                    continue;
+                close(queue, fused);
+                return;
+            }
+            try {
+                for (auto &task : tasks)
+                    task();
+            }
+            catch (...) {
+                // The host_task ends here, so later calls must not be appended
+                //  to a list nothing would run.
+                std::lock_guard<std::mutex> lock(mutex);
+                std::lock_guard<std::mutex> fused_lock(fused->mutex);
+                close(queue, fused);
+                throw;
+            }
+            tasks.clear();
+        }
+    }
+
+    // Called with both locks held.
+    void close(const sycl::queue &queue, const std::shared_ptr<fused_tasks> &fused) {
+        fused->open = false;
+        auto entry = open_tasks.find(queue);
+        if (entry != open_tasks.end() && entry->second == fused)
+            open_tasks.erase(entry);
+    }
+
+    std::mutex mutex;
+    std::unordered_map<sycl::queue, std::shared_ptr<fused_tasks>> open_tasks;
+};
+
+// Submits the command group cgf, which adds dependencies and one host_task to
+//  its handler, or fuses it with the previous calls on queue.
+template <typename CGF>
+inline sycl::event submit_host_task(sycl::queue &queue, CGF cgf) {
+    if (!use_fusion(queue))
+        return queue.submit([&](sycl::handler &cgh) { cgf(cgh); });
+    host_task_recorder recorder;
+    cgf(recorder);
+    return fusion_registry::instance().append(queue, recorder.dependencies,
+                                              std::move(recorder.task));
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_FUSION_HPP_
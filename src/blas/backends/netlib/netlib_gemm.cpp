@@ -0,0 +1,886 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "netlib_common.hpp"
+#include "netlib_gemm.hpp"
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(__SYCL_DEVICE_ONLY__)
+#define NETLIB_GEMM_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+#define NETLIB_ALWAYS_INLINE inline __attribute__((always_inline))
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+namespace {
+
+template <typename T>
+struct real_type {
+    using type = T;
+};
+template <typename T>
+struct real_type<std::complex<T>> {
+    using type = T;
+};
+template <typename T>
+using real_t = typename real_type<T>::type;
+
+template <typename T, int W>
+struct simd {
+    typedef T type __attribute__((vector_size(W * sizeof(T))));
+};
+
+// Microkernels compute ab = Ap * Bp for an mr x kc micro-panel Ap of op(A)
+//  and a kc x nr micro-panel Bp of op(B); ab is stored column-major with
+//  leading dimension mr. The microkernel for real types holds MV vectors of W
+//  elements per column of the tile, i.e. mr = W * MV.
+template <typename R, int W, int MV, int NR>
+NETLIB_ALWAYS_INLINE void real_kernel(int64_t kc, const R *a, const R *b, R *ab) {
+    using V = typename simd<R, W>::type;
+    V acc[NR][MV] = {};
+    for (int64_t p = 0; p < kc; p++) {
+        V av[MV];
+#pragma GCC unroll 4
+        for (int i = 0; i < MV; i++)
+            std::memcpy(&av[i], a + i * W, sizeof(V));
+#pragma GCC unroll 16
+        for (int j = 0; j < NR; j++) {
+            const V bv = b[j] - V{};
+#pragma GCC unroll 4
+            for (int i = 0; i < MV; i++)
+                acc[j][i] += av[i] * bv;
+        }
+        a += W * MV;
+        b += NR;
+    }
+    for (int j = 0; j < NR; j++) {
+        for (int i = 0; i < MV; i++)
+            std::memcpy(ab + j * W * MV + i * W, &acc[j][i], sizeof(V));
+    }
+}
+
+// Complex micro-panels of op(A) store, for each k, the W real parts followed
+//  by the W imaginary parts of a column, so that the complex product only
+//  needs vertical multiply-adds. Micro-panels of op(B) keep the interleaved
+//  (real, imaginary) layout and are broadcast one component at a time.
+template <typename R, int W, int NR>
+NETLIB_ALWAYS_INLINE void complex_kernel(int64_t kc, const R *a, const R *b,
+                                         std::complex<R> *ab) {
+    using V = typename simd<R, W>::type;
+    V acc_re[NR] = {};
+    V acc_im[NR] = {};
+    for (int64_t p = 0; p < kc; p++) {
+        V a_re, a_im;
+        std::memcpy(&a_re, a, sizeof(V));
+        std::memcpy(&a_im, a + W, sizeof(V));
+#pragma GCC unroll 16
+        for (int j = 0; j < NR; j++) {
+            const V b_re = b[2 * j] - V{};
+            const V b_im = b[2 * j + 1] - V{};
+            acc_re[j] += a_re * b_re;
+            acc_re[j] -= a_im * b_im;
+            acc_im[j] += a_re * b_im;
+            acc_im[j] += a_im * b_re;
+        }
+        a += 2 * W;
+        b += 2 * NR;
+    }
+    for (int j = 0; j < NR; j++) {
+        for (int i = 0; i < W; i++)
+            ab[j * W + i] = std::complex<R>(acc_re[j][i], acc_im[j][i]);
+    }
+}
+
+template <typename T>
+using kernel_fn = void (*)(int64_t kc, const real_t<T> *a, const real_t<T> *b, T *ab);
+
+template <typename T>
+struct kernel_desc {
+    int64_t mr;
+    int64_t nr;
+    kernel_fn<T> kernel;
+};
+
+#define NETLIB_REAL_KERNEL(name, attr, R, W, MV, NR)             \
+    attr void name(int64_t kc, const R *a, const R *b, R *ab) {  \
+        real_kernel<R, W, MV, NR>(kc, a, b, ab);                 \
+    }                                                            \
+    constexpr kernel_desc<R> name##_desc = { W * MV, NR, name };
+
+#define NETLIB_COMPLEX_KERNEL(name, attr, R, W, NR)                           \
+    attr void name(int64_t kc, const R *a, const R *b, std::complex<R> *ab) { \
+        complex_kernel<R, W, NR>(kc, a, b, ab);                               \
+    }                                                                         \
+    constexpr kernel_desc<std::complex<R>> name##_desc = { W, NR, name };
+
+NETLIB_REAL_KERNEL(sgemm_kernel_generic, , float, 4, 2, 4)
+NETLIB_REAL_KERNEL(dgemm_kernel_generic, , double, 2, 2, 4)
+NETLIB_COMPLEX_KERNEL(cgemm_kernel_generic, , float, 4, 4)
+NETLIB_COMPLEX_KERNEL(zgemm_kernel_generic, , double, 2, 4)
+
+#ifdef NETLIB_GEMM_X86_KERNELS
+#define NETLIB_AVX2   __attribute__((target("avx2,fma")))
+#define NETLIB_AVX512 __attribute__((target("avx512f")))
+
+NETLIB_REAL_KERNEL(sgemm_kernel_avx2, NETLIB_AVX2, float, 8, 2, 6)
+NETLIB_REAL_KERNEL(dgemm_kernel_avx2, NETLIB_AVX2, double, 4, 2, 6)
+NETLIB_COMPLEX_KERNEL(cgemm_kernel_avx2, NETLIB_AVX2, float, 8, 6)
+NETLIB_COMPLEX_KERNEL(zgemm_kernel_avx2, NETLIB_AVX2, double, 4, 6)
+
+NETLIB_REAL_KERNEL(sgemm_kernel_avx512, NETLIB_AVX512, float, 16, 2, 12)
+NETLIB_REAL_KERNEL(dgemm_kernel_avx512, NETLIB_AVX512, double, 8, 2, 12)
+NETLIB_COMPLEX_KERNEL(cgemm_kernel_avx512, NETLIB_AVX512, float, 16, 12)
+NETLIB_COMPLEX_KERNEL(zgemm_kernel_avx512, NETLIB_AVX512, double, 8, 12)
+#endif
+
+enum class cpu_isa { generic = 0, avx2 = 1, avx512 = 2 };
+
+cpu_isa get_cpu_isa() {
+    static const cpu_isa isa = []() {
+        cpu_isa detected = cpu_isa::generic;
+#ifdef NETLIB_GEMM_X86_KERNELS
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            detected = cpu_isa::avx512;
+        else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            detected = cpu_isa::avx2;
+#endif
+        cpu_isa requested = cpu_isa::avx512;
+        if (const char *env = std::getenv("ONEMKL_NETLIB_GEMM_ISA")) {
+            if (std::strcmp(env, "generic") == 0)
+                requested = cpu_isa::generic;
+            else if (std::strcmp(env, "avx2") == 0)
+                requested = cpu_isa::avx2;
+        }
+        return std::min(detected, requested);
+    }();
+    return isa;
+}
+
+template <typename T>
+struct gemm_traits;
+
+#ifdef NETLIB_GEMM_X86_KERNELS
+#define NETLIB_SELECT_KERNEL(prefix)                       \
+    switch (get_cpu_isa()) {                               \
+        case cpu_isa::avx512: return prefix##_avx512_desc; \
+        case cpu_isa::avx2: return prefix##_avx2_desc;     \
+        default: return prefix##_generic_desc;             \
+    }
+#else
+#define NETLIB_SELECT_KERNEL(prefix) return prefix##_generic_desc;
+#endif
+
+// Cache blocking: a kc x nc panel of op(B) is packed once and shared by all
+//  threads, each thread packs its own mc x kc block of op(A).
+template <>
+struct gemm_traits<float> {
+    static constexpr int64_t mc = 256, kc = 256, nc = 4096;
+    static kernel_desc<float> kernel() {
+        NETLIB_SELECT_KERNEL(sgemm_kernel)
+    }
+};
+
+template <>
+struct gemm_traits<double> {
+    static constexpr int64_t mc = 128, kc = 256, nc = 4096;
+    static kernel_desc<double> kernel() {
+        NETLIB_SELECT_KERNEL(dgemm_kernel)
+    }
+};
+
+template <>
+struct gemm_traits<std::complex<float>> {
+    static constexpr int64_t mc = 128, kc = 256, nc = 2048;
+    static kernel_desc<std::complex<float>> kernel() {
+        NETLIB_SELECT_KERNEL(cgemm_kernel)
+    }
+};
+
+template <>
+struct gemm_traits<std::complex<double>> {
+    static constexpr int64_t mc = 64, kc = 128, nc = 2048;
+    static kernel_desc<std::complex<double>> kernel() {
+        NETLIB_SELECT_KERNEL(zgemm_kernel)
+    }
+};
+
+// Element (i, j) of op(X) for a column-major matrix X.
+template <typename Tx>
+inline Tx op_element(const Tx *x, int64_t ldx, transpose trans, int64_t i, int64_t j) {
+    if (trans == transpose::nontrans)
+        return x[i + j * ldx];
+    return conj_if(x[j + i * ldx], trans == transpose::conjtrans);
+}
+
+
+// Converts count contiguous elements of the storage type Ts to the compute
+//  type T.
+template <typename Ts, typename T>
+inline void convert(const Ts *src, int64_t count, T *dst) {
+    for (int64_t i = 0; i < count; i++)
+        dst[i] = static_cast<T>(src[i]);
+}
+
+// bfloat16 holds the upper half of a float, the conversion is a shift the
+//  compiler vectorizes.
+inline void convert(const bfloat16 *src, int64_t count, float *dst) {
+    for (int64_t i = 0; i < count; i++) {
+        const std::uint32_t bits = static_cast<std::uint32_t>(src[i].raw) << 16;
+        std::memcpy(dst + i, &bits, sizeof(float));
+    }
+}
+
+#ifdef NETLIB_GEMM_X86_KERNELS
+// Every processor with AVX2 also implements F16C.
+__attribute__((target("avx2,f16c"))) void convert_half_f16c(const sycl::half *src,
+                                                            int64_t count, float *dst) {
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    for (; i < count; i++)
+        dst[i] = static_cast<float>(src[i]);
+}
+#endif
+
+inline void convert(const sycl::half *src, int64_t count, float *dst) {
+#ifdef NETLIB_GEMM_X86_KERNELS
+    if (get_cpu_isa() != cpu_isa::generic) {
+        convert_half_f16c(src, count, dst);
+        return;
+    }
+#endif
+    for (int64_t i = 0; i < count; i++)
+        dst[i] = static_cast<float>(src[i]);
+}
+
+// Packs rows [i0, i0 + mc) and columns [p0, p0 + kc) of op(A) into micro-panels
+//  of mr rows, padding the last micro-panel with zeros. Real matrices are read
+//  along their contiguous dimension and converted to T on the fly.
+template <typename Ta, typename T>
+void pack_a(transpose trans, const Ta *a, int64_t lda, int64_t i0, int64_t mc, int64_t p0,
+            int64_t kc, int64_t mr, real_t<T> *ap) {
+    if constexpr (is_complex<T>::value) {
+        for (int64_t r = 0; r < mc; r += mr) {
+            const int64_t rows = std::min(mr, mc - r);
+            for (int64_t p = 0; p < kc; p++) {
+                real_t<T> *dst = ap + 2 * (r * kc + p * mr);
+                for (int64_t i = 0; i < mr; i++) {
+                    const T x = i < rows ? T(op_element(a, lda, trans, i0 + r + i, p0 + p)) : T(0);
+                    dst[i] = x.real();
+                    dst[mr + i] = x.imag();
+                }
+            }
+        }
+    }
+    else if (trans == transpose::nontrans) {
+        for (int64_t r = 0; r < mc; r += mr) {
+            const int64_t rows = std::min(mr, mc - r);
+            for (int64_t p = 0; p < kc; p++) {
+                T *dst = ap + r * kc + p * mr;
+                convert(a + (i0 + r) + (p0 + p) * lda, rows, dst);
+                std::fill(dst + rows, dst + mr, T(0));
+            }
+        }
+    }
+    else {
+        std::vector<T> row(kc);
+        for (int64_t r = 0; r < mc; r += mr) {
+            const int64_t rows = std::min(mr, mc - r);
+            T *dst = ap + r * kc;
+            for (int64_t i = 0; i < mr; i++) {
+                if (i < rows)
+                    convert(a + p0 + (i0 + r + i) * lda, kc, row.data());
+                else
+                    std::fill(row.begin(), row.end(), T(0));
+                for (int64_t p = 0; p < kc; p++)
+                    dst[p * mr + i] = row[p];
+            }
+        }
+    }
+}
+
+// Packs rows [p0, p0 + kc) and columns [j0, j0 + nc) of op(B) into micro-panels
+//  of nr columns, padding the last micro-panel with zeros. Real matrices are
+//  read along their contiguous dimension and converted to T on the fly.
+template <typename Tb, typename T>
+void pack_b(transpose trans, const Tb *b, int64_t ldb, int64_t p0, int64_t kc, int64_t j0,
+            int64_t nc, int64_t nr, real_t<T> *bp) {
+    if constexpr (is_complex<T>::value) {
+        for (int64_t s = 0; s < nc; s += nr) {
+            const int64_t cols = std::min(nr, nc - s);
+            for (int64_t p = 0; p < kc; p++) {
+                real_t<T> *dst = bp + 2 * (s * kc + p * nr);
+                for (int64_t j = 0; j < nr; j++) {
+                    const T x = j < cols ? T(op_element(b, ldb, trans, p0 + p, j0 + s + j)) : T(0);
+                    dst[2 * j] = x.real();
+                    dst[2 * j + 1] = x.imag();
+                }
+            }
+        }
+    }
+    else if (trans == transpose::nontrans) {
+        std::vector<T> col(kc);
+        for (int64_t s = 0; s < nc; s += nr) {
+            const int64_t cols = std::min(nr, nc - s);
+            T *dst = bp + s * kc;
+            for (int64_t j = 0; j < nr; j++) {
+                if (j < cols)
+                    convert(b + p0 + (j0 + s + j) * ldb, kc, col.data());
+                else
+                    std::fill(col.begin(), col.end(), T(0));
+                for (int64_t p = 0; p < kc; p++)
+                    dst[p * nr + j] = col[p];
+            }
+        }
+    }
+    else {
+        for (int64_t s = 0; s < nc; s += nr) {
+            const int64_t cols = std::min(nr, nc - s);
+            for (int64_t p = 0; p < kc; p++) {
+                T *dst = bp + s * kc + p * nr;
+                convert(b + (j0 + s) + (p0 + p) * ldb, cols, dst);
+                std::fill(dst + cols, dst + nr, T(0));
+            }
+        }
+    }
+}
+
+// C = alpha * ab + beta * C for a rows x cols tile of C stored as Tc; C is not
+//  read when beta is zero.
+template <typename T, typename Tc>
+inline void update_tile(int64_t rows, int64_t cols, int64_t mr, const T *ab, T alpha, T beta,
+                        Tc *c, int64_t ldc) {
+    if (beta == T(0)) {
+        for (int64_t j = 0; j < cols; j++)
+            for (int64_t i = 0; i < rows; i++)
+                c[i + j * ldc] = static_cast<Tc>(alpha * ab[i + j * mr]);
+    }
+    else if (beta == T(1)) {
+        for (int64_t j = 0; j < cols; j++)
+            for (int64_t i = 0; i < rows; i++)
+                c[i + j * ldc] = static_cast<Tc>(alpha * ab[i + j * mr] + T(c[i + j * ldc]));
+    }
+    else {
+        for (int64_t j = 0; j < cols; j++)
+            for (int64_t i = 0; i < rows; i++)
+                c[i + j * ldc] =
+                    static_cast<Tc>(alpha * ab[i + j * mr] + beta * T(c[i + j * ldc]));
+    }
+}
+
+template <typename T, typename Tc>
+void scale_c(int64_t m, int64_t n, T beta, Tc *c, int64_t ldc) {
+    for (int64_t j = 0; j < n; j++) {
+        for (int64_t i = 0; i < m; i++)
+            c[i + j * ldc] = static_cast<Tc>((beta == T(0)) ? T(0) : beta * T(c[i + j * ldc]));
+    }
+}
+
+// Column-major driver. Ta, Tb and Tc are the storage types of A, B and C; A and
+//  B are converted to the compute type T while packing, C when it is updated.
+template <typename Ta, typename Tb, typename T, typename Tc>
+void gemm_driver(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k, T alpha,
+                 const Ta *a, int64_t lda, const Tb *b, int64_t ldb, T beta, Tc *c, int64_t ldc) {
+    using R = real_t<T>;
+    using traits = gemm_traits<T>;
+    constexpr int64_t elems = is_complex<T>::value ? 2 : 1;
+
+    if (m <= 0 || n <= 0)
+        return;
+    if (k <= 0 || alpha == T(0)) {
+        scale_c(m, n, beta, c, ldc);
+        return;
+    }
+
+    if constexpr (!std::is_same<T, Tc>::value) {
+        // Partial sums over several blocks of k are kept in T rather than
+        //  rounded to Tc after each block.
+        if (k > traits::kc && alpha != T(0)) {
+            std::vector<T> c_acc(m * n);
+            for (int64_t j = 0; j < n; j++)
+                for (int64_t i = 0; i < m; i++)
+                    c_acc[i + j * m] = (beta == T(0)) ? T(0) : beta * T(c[i + j * ldc]);
+            gemm_driver<Ta, Tb, T, T>(transa, transb, m, n, k, alpha, a, lda, b, ldb, T(1),
+                                      c_acc.data(), m);
+            for (int64_t j = 0; j < n; j++)
+                for (int64_t i = 0; i < m; i++)
+                    c[i + j * ldc] = static_cast<Tc>(c_acc[i + j * m]);
+            return;
+        }
+    }
+
+    const kernel_desc<T> desc = traits::kernel();
+    const int64_t mr = desc.mr;
+    const int64_t nr = desc.nr;
+    const int64_t nc_max = std::max(nr, traits::nc / nr * nr);
+    const int64_t kc_max = traits::kc;
+
+    // Rows are distributed over threads in blocks of at most mc rows.
+    const int64_t num_threads = std::max<int64_t>(
+        1, std::min(get_max_threads(), gemm_flops<T>(m, n, k) / min_flops_per_thread));
+    const int64_t rows_per_thread = (m + num_threads - 1) / num_threads;
+    const int64_t mc = std::max(mr, std::min(traits::mc / mr * mr,
+                                             (rows_per_thread + mr - 1) / mr * mr));
+    const int64_t blocks_m = (m + mc - 1) / mc;
+
+    std::vector<R> b_pack(((std::min(n, nc_max) + nr - 1) / nr * nr) * kc_max * elems);
+
+    for (int64_t jc = 0; jc < n; jc += nc_max) {
+        const int64_t nc = std::min(nc_max, n - jc);
+        const int64_t panels_n = (nc + nr - 1) / nr;
+        for (int64_t pc = 0; pc < k; pc += kc_max) {
+            const int64_t kc = std::min(kc_max, k - pc);
+            const T beta_block = (pc == 0) ? beta : T(1);
+
+            parallel_for(panels_n, get_grain_size(2 * nr * kc), [&](int64_t begin, int64_t end) {
+                pack_b<Tb, T>(transb, b, ldb, pc, kc, jc + begin * nr,
+                              std::min(nc, end * nr) - begin * nr, nr,
+                              b_pack.data() + begin * nr * kc * elems);
+            });
+
+            parallel_for(blocks_m, 1, [&](int64_t begin, int64_t end) {
+                std::vector<R> a_pack(mc * kc * elems);
+                std::vector<T> ab(mr * nr);
+                for (int64_t block = begin; block < end; block++) {
+                    const int64_t ic = block * mc;
+                    const int64_t rows = std::min(mc, m - ic);
+                    pack_a<Ta, T>(transa, a, lda, ic, rows, pc, kc, mr, a_pack.data());
+                    for (int64_t jr = 0; jr < nc; jr += nr) {
+                        const R *bp = b_pack.data() + jr * kc * elems;
+                        for (int64_t ir = 0; ir < rows; ir += mr) {
+                            desc.kernel(kc, a_pack.data() + ir * kc * elems, bp, ab.data());
+                            update_tile(std::min(mr, rows - ir), std::min(nr, nc - jr), mr,
+                                        ab.data(), alpha, beta_block,
+                                        c + (ic + ir) + (jc + jr) * ldc, ldc);
+                        }
+                    }
+                }
+            });
+        }
+    }
+}
+
+// Row-major problems are solved as the transposed column-major problem
+//  C^T = op(B)^T * op(A)^T.
+template <typename Ta, typename Tb, typename T, typename Tc>
+void gemm_dispatch(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                   int64_t k, T alpha, const Ta *a, int64_t lda, const Tb *b, int64_t ldb,
+                   T beta, Tc *c, int64_t ldc) {
+    if (layout == CBLAS_LAYOUT::CblasColMajor)
+        gemm_driver<Ta, Tb, T, Tc>(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    else
+        gemm_driver<Tb, Ta, T, Tc>(transb, transa, n, m, k, alpha, b, ldb, a, lda, beta, c, ldc);
+}
+
+// Integer gemm_bias engine. op(A) - ao and op(B) - bo always fit in 16 bits,
+//  so both are packed as int16 with two consecutive values of k side by side.
+//  A pair of rows of op(A) times a pair of columns of op(B) is then exactly
+//  one 32-bit lane of pmaddwd (AVX2, AVX-512BW) or vpdpwssd (AVX-512 VNNI).
+//  pmaddubsw is not used as it saturates its 16-bit sums. ab receives the
+//  mr x nr int32 tile, column-major with leading dimension mr. Each product
+//  is at most 255 * 255 in magnitude, so a tile over kc <= int_kc values of k
+//  cannot overflow int32; longer sums are kept in int64 by the driver.
+using int_kernel_fn = void (*)(int64_t kq, const int16_t *a, const int16_t *b, int32_t *ab);
+
+struct int_kernel_desc {
+    int64_t mr;
+    int64_t nr;
+    int_kernel_fn kernel;
+};
+
+template <int MR, int NR>
+void int_kernel_generic(int64_t kq, const int16_t *a, const int16_t *b, int32_t *ab) {
+    int32_t acc[NR][MR] = {};
+    for (int64_t q = 0; q < kq; q++) {
+        for (int j = 0; j < NR; j++) {
+            const int32_t b0 = b[2 * j], b1 = b[2 * j + 1];
+            for (int i = 0; i < MR; i++)
+                acc[j][i] += a[2 * i] * b0 + a[2 * i + 1] * b1;
+        }
+        a += 2 * MR;
+        b += 2 * NR;
+    }
+    std::memcpy(ab, acc, sizeof(acc));
+}
+
+constexpr int_kernel_desc int_kernel_generic_desc = { 8, 4, int_kernel_generic<8, 4> };
+
+#ifdef NETLIB_GEMM_X86_KERNELS
+NETLIB_AVX2 void int_kernel_avx2(int64_t kq, const int16_t *a, const int16_t *b, int32_t *ab) {
+    constexpr int NR = 6;
+    __m256i acc[NR][2];
+#pragma GCC unroll 16
+    for (int j = 0; j < NR; j++)
+        acc[j][0] = acc[j][1] = _mm256_setzero_si256();
+    for (int64_t q = 0; q < kq; q++) {
+        const __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a));
+        const __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + 16));
+#pragma GCC unroll 16
+        for (int j = 0; j < NR; j++) {
+            int32_t pair;
+            std::memcpy(&pair, b + 2 * j, sizeof(pair));
+            const __m256i bj = _mm256_set1_epi32(pair);
+            acc[j][0] = _mm256_add_epi32(acc[j][0], _mm256_madd_epi16(a0, bj));
+            acc[j][1] = _mm256_add_epi32(acc[j][1], _mm256_madd_epi16(a1, bj));
+        }
+        a += 32;
+        b += 2 * NR;
+    }
+    for (int j = 0; j < NR; j++) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ab + 16 * j), acc[j][0]);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ab + 16 * j + 8), acc[j][1]);
+    }
+}
+
+constexpr int_kernel_desc int_kernel_avx2_desc = { 16, 6, int_kernel_avx2 };
+
+__attribute__((target("avx512f,avx512bw"))) void int_kernel_avx512(int64_t kq, const int16_t *a,
+                                                                   const int16_t *b, int32_t *ab) {
+    constexpr int NR = 12;
+    __m512i acc[NR][2];
+#pragma GCC unroll 16
+    for (int j = 0; j < NR; j++)
+        acc[j][0] = acc[j][1] = _mm512_setzero_si512();
+    for (int64_t q = 0; q < kq; q++) {
+        const __m512i a0 = _mm512_loadu_si512(a);
+        const __m512i a1 = _mm512_loadu_si512(a + 32);
+#pragma GCC unroll 16
+        for (int j = 0; j < NR; j++) {
+            int32_t pair;
+            std::memcpy(&pair, b + 2 * j, sizeof(pair));
+            const __m512i bj = _mm512_set1_epi32(pair);
+            acc[j][0] = _mm512_add_epi32(acc[j][0], _mm512_madd_epi16(a0, bj));
+            acc[j][1] = _mm512_add_epi32(acc[j][1], _mm512_madd_epi16(a1, bj));
+        }
+        a += 64;
+        b += 2 * NR;
+    }
+    for (int j = 0; j < NR; j++) {
+        _mm512_storeu_si512(ab + 32 * j, acc[j][0]);
+        _mm512_storeu_si512(ab + 32 * j + 16, acc[j][1]);
+    }
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vnni"))) void int_kernel_avx512_vnni(
+    int64_t kq, const int16_t *a, const int16_t *b, int32_t *ab) {
+    constexpr int NR = 12;
+    __m512i acc[NR][2];
+#pragma GCC unroll 16
+    for (int j = 0; j < NR; j++)
+        acc[j][0] = acc[j][1] = _mm512_setzero_si512();
+    for (int64_t q = 0; q < kq; q++) {
+        const __m512i a0 = _mm512_loadu_si512(a);
+        const __m512i a1 = _mm512_loadu_si512(a + 32);
+#pragma GCC unroll 16
+        for (int j = 0; j < NR; j++) {
+            int32_t pair;
+            std::memcpy(&pair, b + 2 * j, sizeof(pair));
+            const __m512i bj = _mm512_set1_epi32(pair);
+            acc[j][0] = _mm512_dpwssd_epi32(acc[j][0], a0, bj);
+            acc[j][1] = _mm512_dpwssd_epi32(acc[j][1], a1, bj);
+        }
+        a += 64;
+        b += 2 * NR;
+    }
+    for (int j = 0; j < NR; j++) {
+        _mm512_storeu_si512(ab + 32 * j, acc[j][0]);
+        _mm512_storeu_si512(ab + 32 * j + 16, acc[j][1]);
+    }
+}
+
+constexpr int_kernel_desc int_kernel_avx512_desc = { 32, 12, int_kernel_avx512 };
+constexpr int_kernel_desc int_kernel_avx512_vnni_desc = { 32, 12, int_kernel_avx512_vnni };
+#endif
+
+int_kernel_desc get_int_kernel() {
+#ifdef NETLIB_GEMM_X86_KERNELS
+    static const bool has_avx512bw = __builtin_cpu_supports("avx512bw");
+    static const bool has_avx512vnni = __builtin_cpu_supports("avx512vnni");
+    switch (get_cpu_isa()) {
+        case cpu_isa::avx512:
+            if (has_avx512bw && has_avx512vnni)
+                return int_kernel_avx512_vnni_desc;
+            if (has_avx512bw)
+                return int_kernel_avx512_desc;
+            return int_kernel_avx2_desc;
+        case cpu_isa::avx2: return int_kernel_avx2_desc;
+        default: break;
+    }
+#endif
+    return int_kernel_generic_desc;
+}
+
+// Packs rows [i0, i0 + mc) and columns [p0, p0 + kc) of op(A) - ao into
+//  micro-panels of mr rows and pairs of k, padded with zeros.
+template <typename Ta>
+void pack_int_a(transpose trans, const Ta *a, int64_t lda, int32_t ao, int64_t i0, int64_t mc,
+                int64_t p0, int64_t kc, int64_t mr, int16_t *ap) {
+    const int64_t kq = (kc + 1) / 2;
+    for (int64_t r = 0; r < mc; r += mr) {
+        const int64_t rows = std::min(mr, mc - r);
+        int16_t *dst = ap + 2 * r * kq;
+        std::fill(dst, dst + 2 * mr * kq, int16_t(0));
+        if (trans == transpose::nontrans) {
+            for (int64_t p = 0; p < kc; p++) {
+                const Ta *src = a + (i0 + r) + (p0 + p) * lda;
+                for (int64_t i = 0; i < rows; i++)
+                    dst[2 * ((p / 2) * mr + i) + (p % 2)] = static_cast<int16_t>(src[i] - ao);
+            }
+        }
+        else {
+            for (int64_t i = 0; i < rows; i++) {
+                const Ta *src = a + p0 + (i0 + r + i) * lda;
+                for (int64_t p = 0; p < kc; p++)
+                    dst[2 * ((p / 2) * mr + i) + (p % 2)] = static_cast<int16_t>(src[p] - ao);
+            }
+        }
+    }
+}
+
+// Packs rows [p0, p0 + kc) and columns [j0, j0 + nc) of op(B) - bo into
+//  micro-panels of nr columns and pairs of k, padded with zeros.
+template <typename Tb>
+void pack_int_b(transpose trans, const Tb *b, int64_t ldb, int32_t bo, int64_t p0, int64_t kc,
+                int64_t j0, int64_t nc, int64_t nr, int16_t *bp) {
+    const int64_t kq = (kc + 1) / 2;
+    for (int64_t s = 0; s < nc; s += nr) {
+        const int64_t cols = std::min(nr, nc - s);
+        int16_t *dst = bp + 2 * s * kq;
+        std::fill(dst, dst + 2 * nr * kq, int16_t(0));
+        if (trans == transpose::nontrans) {
+            for (int64_t j = 0; j < cols; j++) {
+                const Tb *src = b + p0 + (j0 + s + j) * ldb;
+                for (int64_t p = 0; p < kc; p++)
+                    dst[2 * ((p / 2) * nr + j) + (p % 2)] = static_cast<int16_t>(src[p] - bo);
+            }
+        }
+        else {
+            for (int64_t p = 0; p < kc; p++) {
+                const Tb *src = b + (j0 + s) + (p0 + p) * ldb;
+                for (int64_t j = 0; j < cols; j++)
+                    dst[2 * ((p / 2) * nr + j) + (p % 2)] = static_cast<int16_t>(src[j] - bo);
+            }
+        }
+    }
+}
+
+// C = alpha * acc + beta * C + co, rounded to nearest and saturated.
+inline int32_t scale_int(float alpha, int64_t acc, float beta, int32_t c, int32_t co) {
+    double value = double(alpha) * acc;
+    if (beta != 0.0f)
+        value += double(beta) * c;
+    value = std::nearbyint(value) + co;
+    value = std::min<double>(value, std::numeric_limits<int32_t>::max());
+    value = std::max<double>(value, std::numeric_limits<int32_t>::min());
+    return static_cast<int32_t>(value);
+}
+
+constexpr int64_t int_mc = 256, int_kc = 512, int_nc = 4096;
+
+// Column-major integer driver. The int32 tiles of each kc block are added into
+//  exact int64 sums over all of k before alpha, beta and the offset of C are
+//  applied.
+template <typename Ta, typename Tb>
+void gemm_bias_driver(transpose transa, transpose transb, offset offsetc, int64_t m, int64_t n,
+                      int64_t k, float alpha, const Ta *a, int64_t lda, Ta ao, const Tb *b,
+                      int64_t ldb, Tb bo, float beta, int32_t *c, int64_t ldc, const int32_t *co) {
+    if (m <= 0 || n <= 0)
+        return;
+
+    std::vector<int64_t> acc(m * n, 0);
+    if (k > 0 && alpha != 0.0f) {
+        const int_kernel_desc desc = get_int_kernel();
+        const int64_t mr = desc.mr;
+        const int64_t nr = desc.nr;
+        const int64_t nc_max = std::max(nr, int_nc / nr * nr);
+        const int64_t num_threads = std::max<int64_t>(
+            1, std::min(get_max_threads(), 2 * m * n * k / min_flops_per_thread));
+        const int64_t rows_per_thread = (m + num_threads - 1) / num_threads;
+        const int64_t mc =
+            std::max(mr, std::min(int_mc / mr * mr, (rows_per_thread + mr - 1) / mr * mr));
+        const int64_t blocks_m = (m + mc - 1) / mc;
+
+        std::vector<int16_t> b_pack(((std::min(n, nc_max) + nr - 1) / nr * nr) * int_kc);
+        for (int64_t jc = 0; jc < n; jc += nc_max) {
+            const int64_t nc = std::min(nc_max, n - jc);
+            const int64_t panels_n = (nc + nr - 1) / nr;
+            for (int64_t pc = 0; pc < k; pc += int_kc) {
+                const int64_t kc = std::min(int_kc, k - pc);
+                const int64_t kq = (kc + 1) / 2;
+                const int64_t grain = get_grain_size(2 * nr * kc);
+
+                parallel_for(panels_n, grain, [&](int64_t begin, int64_t end) {
+                    pack_int_b(transb, b, ldb, bo, pc, kc, jc + begin * nr,
+                               std::min(nc, end * nr) - begin * nr, nr,
+                               b_pack.data() + 2 * begin * nr * kq);
+                });
+
+                parallel_for(blocks_m, 1, [&](int64_t begin, int64_t end) {
+                    std::vector<int16_t> a_pack(2 * mc * kq);
+                    std::vector<int32_t> ab(mr * nr);
+                    for (int64_t block = begin; block < end; block++) {
+                        const int64_t ic = block * mc;
+                        const int64_t rows = std::min(mc, m - ic);
+                        pack_int_a(transa, a, lda, ao, ic, rows, pc, kc, mr, a_pack.data());
+                        for (int64_t jr = 0; jr < nc; jr += nr) {
+                            const int16_t *bp = b_pack.data() + 2 * jr * kq;
+                            for (int64_t ir = 0; ir < rows; ir += mr) {
+                                desc.kernel(kq, a_pack.data() + 2 * ir * kq, bp, ab.data());
+                                int64_t *acc_tile = acc.data() + (ic + ir) + (jc + jr) * m;
+                                for (int64_t j = 0; j < std::min(nr, nc - jr); j++)
+                                    for (int64_t i = 0; i < std::min(mr, rows - ir); i++)
+                                        acc_tile[i + j * m] += ab[i + j * mr];
+                            }
+                        }
+                    }
+                });
+            }
+        }
+    }
+
+    parallel_for(n, get_grain_size(4 * m), [&](int64_t begin, int64_t end) {
+        for (int64_t j = begin; j < end; j++) {
+            for (int64_t i = 0; i < m; i++) {
+                const int32_t offset_c = (offsetc == offset::fix)      ? co[0]
+                                         : (offsetc == offset::column) ? co[i]
+                                                                       : co[j];
+                c[i + j * ldc] = scale_int(alpha, acc[i + j * m], beta, c[i + j * ldc], offset_c);
+            }
+        }
+    });
+}
+
+// Row-major problems are solved as the transposed column-major problem, in
+//  which row offsets become column offsets and conversely.
+template <typename Ta, typename Tb>
+void gemm_bias_dispatch(CBLAS_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                        int64_t m, int64_t n, int64_t k, float alpha, const Ta *a, int64_t lda,
+                        Ta ao, const Tb *b, int64_t ldb, Tb bo, float beta, int32_t *c,
+                        int64_t ldc, const int32_t *co) {
+    if (layout == CBLAS_LAYOUT::CblasColMajor) {
+        gemm_bias_driver(transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c,
+                         ldc, co);
+    }
+    else {
+        const offset offsetc_t = (offsetc == offset::row)      ? offset::column
+                                 : (offsetc == offset::column) ? offset::row
+                                                               : offset::fix;
+        gemm_bias_driver(transb, transa, offsetc_t, n, m, k, alpha, b, ldb, bo, a, lda, ao, beta,
+                         c, ldc, co);
+    }
+}
+
+} // namespace
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, float alpha, const float *a, int64_t lda, const float *b, int64_t ldb,
+                 float beta, float *c, int64_t ldc) {
+    gemm_dispatch(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, double alpha, const double *a, int64_t lda, const double *b,
+                 int64_t ldb, double beta, double *c, int64_t ldc) {
+    gemm_dispatch(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                 const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                 std::complex<float> *c, int64_t ldc) {
+    gemm_dispatch(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                 int64_t lda, const std::complex<double> *b, int64_t ldb,
+                 std::complex<double> beta, std::complex<double> *c, int64_t ldc) {
+    gemm_dispatch(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+                 int64_t ldb, float beta, sycl::half *c, int64_t ldc) {
+    gemm_dispatch(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+                 int64_t ldb, float beta, float *c, int64_t ldc) {
+    gemm_dispatch(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+                 int64_t ldb, float beta, float *c, int64_t ldc) {
+    gemm_dispatch(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void native_gemm_bias(CBLAS_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                      int64_t m, int64_t n, int64_t k, float alpha, const int8_t *a, int64_t lda,
+                      int8_t ao, const int8_t *b, int64_t ldb, int8_t bo, float beta, int32_t *c,
+                      int64_t ldc, const int32_t *co) {
+    gemm_bias_dispatch(layout, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                       beta, c, ldc, co);
+}
+
+void native_gemm_bias(CBLAS_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                      int64_t m, int64_t n, int64_t k, float alpha, const int8_t *a, int64_t lda,
+                      int8_t ao, const uint8_t *b, int64_t ldb, uint8_t bo, float beta, int32_t *c,
+                      int64_t ldc, const int32_t *co) {
+    gemm_bias_dispatch(layout, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                       beta, c, ldc, co);
+}
+
+void native_gemm_bias(CBLAS_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                      int64_t m, int64_t n, int64_t k, float alpha, const uint8_t *a, int64_t lda,
+                      uint8_t ao, const int8_t *b, int64_t ldb, int8_t bo, float beta, int32_t *c,
+                      int64_t ldc, const int32_t *co) {
+    gemm_bias_dispatch(layout, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                       beta, c, ldc, co);
+}
+
+void native_gemm_bias(CBLAS_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                      int64_t m, int64_t n, int64_t k, float alpha, const uint8_t *a, int64_t lda,
+                      uint8_t ao, const uint8_t *b, int64_t ldb, uint8_t bo, float beta, int32_t *c,
+                      int64_t ldc, const int32_t *co) {
+    gemm_bias_dispatch(layout, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                       beta, c, ldc, co);
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_GEMM_HPP_
+#define _NETLIB_GEMM_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <complex>
+#include <cstdint>
+
+#include "cblas.h"
+
+#include "oneapi/mkl/bfloat16.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Built-in gemm engine of the netlib backend.
+ *
+ * op(A) and op(B) are packed into cache-sized blocks and multiplied by
+ * register-blocked microkernels. Microkernels for AVX-512 and AVX2 are
+ * selected at run time from the features of the host CPU, with a portable
+ * fallback for other processors. The blocks of C are computed in parallel on
+ * the netlib host threads.
+ *
+ * Half and bfloat16 inputs are converted to float while they are packed, so
+ * no float copy of A or B is created; half results are rounded when C is
+ * updated. These precisions are always computed by this engine. When the
+ * backend is built with ENABLE_NETLIB_NATIVE_GEMM, the float, double and
+ * complex gemm calls also use it instead of the external CBLAS, which is
+ * typically the slow reference implementation. The environment variable
+ * ONEMKL_NETLIB_GEMM_ISA=generic|avx2|avx512 caps the instruction set used.
+ *
+ * native_gemm_bias computes the integer gemm_bias with int16 packing and
+ * int32 accumulation over blocks of k (pmaddwd on AVX2/AVX-512BW, vpdpwssd
+ * on AVX-512 VNNI). The blocks are summed exactly in int64 before alpha,
+ * beta and the offset of C are applied.
+ */
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, float alpha, const float *a, int64_t lda, const float *b, int64_t ldb,
+                 float beta, float *c, int64_t ldc);
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, double alpha, const double *a, int64_t lda, const double *b,
+                 int64_t ldb, double beta, double *c, int64_t ldc);
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                 const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                 std::complex<float> *c, int64_t ldc);
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                 int64_t lda, const std::complex<double> *b, int64_t ldb,
+                 std::complex<double> beta, std::complex<double> *c, int64_t ldc);
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+                 int64_t ldb, float beta, sycl::half *c, int64_t ldc);
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, float alpha, const sycl::half *a, int64_t lda, const sycl::half *b,
+                 int64_t ldb, float beta, float *c, int64_t ldc);
+
+void native_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m, int64_t n,
+                 int64_t k, float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+                 int64_t ldb, float beta, float *c, int64_t ldc);
+
+void native_gemm_bias(CBLAS_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                      int64_t m, int64_t n, int64_t k, float alpha, const int8_t *a, int64_t lda,
+                      int8_t ao, const int8_t *b, int64_t ldb, int8_t bo, float beta, int32_t *c,
+                      int64_t ldc, const int32_t *co);
+
+void native_gemm_bias(CBLAS_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                      int64_t m, int64_t n, int64_t k, float alpha, const int8_t *a, int64_t lda,
+                      int8_t ao, const uint8_t *b, int64_t ldb, uint8_t bo, float beta, int32_t *c,
+                      int64_t ldc, const int32_t *co);
+
+void native_gemm_bias(CBLAS_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                      int64_t m, int64_t n, int64_t k, float alpha, const uint8_t *a, int64_t lda,
+                      uint8_t ao, const int8_t *b, int64_t ldb, int8_t bo, float beta, int32_t *c,
+                      int64_t ldc, const int32_t *co);
+
+void native_gemm_bias(CBLAS_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                      int64_t m, int64_t n, int64_t k, float alpha, const uint8_t *a, int64_t lda,
+                      uint8_t ao, const uint8_t *b, int64_t ldb, uint8_t bo, float beta, int32_t *c,
+                      int64_t ldc, const int32_t *co);
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_GEMM_HPP_
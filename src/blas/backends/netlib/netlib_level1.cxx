@@ -742,7 +742,7 @@ void swap(sycl::queue &queue, int64_t n, sycl::buffer<std::complex<double>, 1> &
 
 sycl::event asum(sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -755,7 +755,7 @@ sycl::event asum(sycl::queue &queue, int64_t n, const float *x, int64_t incx, fl
 
 sycl::event asum(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                      double *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -768,7 +768,7 @@ sycl::event asum(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
 
 sycl::event asum(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      float *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -781,7 +781,7 @@ sycl::event asum(sycl::queue &queue, int64_t n, const std::complex<float> *x, in
 
 sycl::event asum(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      double *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -794,7 +794,7 @@ sycl::event asum(sycl::queue &queue, int64_t n, const std::complex<double> *x, i
 
 sycl::event axpy(sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
                      float *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -808,7 +808,7 @@ sycl::event axpy(sycl::queue &queue, int64_t n, float alpha, const float *x, int
 
 sycl::event axpy(sycl::queue &queue, int64_t n, double alpha, const double *x, int64_t incx,
                      double *y, int64_t incy, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -824,7 +824,7 @@ sycl::event axpy(sycl::queue &queue, int64_t n, double alpha, const double *x, i
 sycl::event axpy(sycl::queue &queue, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *x, int64_t incx, std::complex<float> *y,
                      int64_t incy, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -840,7 +840,7 @@ sycl::event axpy(sycl::queue &queue, int64_t n, std::complex<float> alpha,
 sycl::event axpy(sycl::queue &queue, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *x, int64_t incx, std::complex<double> *y,
                      int64_t incy, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -901,7 +901,7 @@ sycl::event axpby(sycl::queue &queue, int64_t n, std::complex<double> alpha,
 
 sycl::event copy(sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *y,
                      int64_t incy, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -914,7 +914,7 @@ sycl::event copy(sycl::queue &queue, int64_t n, const float *x, int64_t incx, fl
 
 sycl::event copy(sycl::queue &queue, int64_t n, const double *x, int64_t incx, double *y,
                      int64_t incy, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -928,7 +928,7 @@ sycl::event copy(sycl::queue &queue, int64_t n, const double *x, int64_t incx, d
 sycl::event copy(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      std::complex<float> *y, int64_t incy,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -942,7 +942,7 @@ sycl::event copy(sycl::queue &queue, int64_t n, const std::complex<float> *x, in
 sycl::event copy(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      std::complex<double> *y, int64_t incy,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -955,7 +955,7 @@ sycl::event copy(sycl::queue &queue, int64_t n, const std::complex<double> *x, i
 
 sycl::event dot(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
                     int64_t incy, float *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -970,7 +970,7 @@ sycl::event dot(sycl::queue &queue, int64_t n, const float *x, int64_t incx, con
 sycl::event dot(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                     const double *y, int64_t incy, double *result,
                     const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -985,7 +985,7 @@ sycl::event dot(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
 sycl::event dot(sycl::queue &queue, int64_t n, const float *x, int64_t incx, const float *y,
                     int64_t incy, double *result,
                     const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1000,7 +1000,7 @@ sycl::event dot(sycl::queue &queue, int64_t n, const float *x, int64_t incx, con
 sycl::event dotc(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      const std::complex<float> *y, int64_t incy, std::complex<float> *result,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1015,7 +1015,7 @@ sycl::event dotc(sycl::queue &queue, int64_t n, const std::complex<float> *x, in
 sycl::event dotc(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *result,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1030,7 +1030,7 @@ sycl::event dotc(sycl::queue &queue, int64_t n, const std::complex<double> *x, i
 sycl::event dotu(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      const std::complex<float> *y, int64_t incy, std::complex<float> *result,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1045,7 +1045,7 @@ sycl::event dotu(sycl::queue &queue, int64_t n, const std::complex<float> *x, in
 sycl::event dotu(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      const std::complex<double> *y, int64_t incy, std::complex<double> *result,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1059,7 +1059,7 @@ sycl::event dotu(sycl::queue &queue, int64_t n, const std::complex<double> *x, i
 
 sycl::event iamin(sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                       int64_t *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1072,7 +1072,7 @@ sycl::event iamin(sycl::queue &queue, int64_t n, const float *x, int64_t incx,
 
 sycl::event iamin(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                       int64_t *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1085,7 +1085,7 @@ sycl::event iamin(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
 
 sycl::event iamin(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                       int64_t *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1099,7 +1099,7 @@ sycl::event iamin(sycl::queue &queue, int64_t n, const std::complex<float> *x, i
 sycl::event iamin(sycl::queue &queue, int64_t n, const std::complex<double> *x,
                       int64_t incx, int64_t *result,
                       const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1112,7 +1112,7 @@ sycl::event iamin(sycl::queue &queue, int64_t n, const std::complex<double> *x,
 
 sycl::event iamax(sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                       int64_t *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1125,7 +1125,7 @@ sycl::event iamax(sycl::queue &queue, int64_t n, const float *x, int64_t incx,
 
 sycl::event iamax(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                       int64_t *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1138,7 +1138,7 @@ sycl::event iamax(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
 
 sycl::event iamax(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                       int64_t *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1152,7 +1152,7 @@ sycl::event iamax(sycl::queue &queue, int64_t n, const std::complex<float> *x, i
 sycl::event iamax(sycl::queue &queue, int64_t n, const std::complex<double> *x,
                       int64_t incx, int64_t *result,
                       const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1165,7 +1165,7 @@ sycl::event iamax(sycl::queue &queue, int64_t n, const std::complex<double> *x,
 
 sycl::event nrm2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, float *result,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1178,7 +1178,7 @@ sycl::event nrm2(sycl::queue &queue, int64_t n, const float *x, int64_t incx, fl
 
 sycl::event nrm2(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                      double *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1191,7 +1191,7 @@ sycl::event nrm2(sycl::queue &queue, int64_t n, const double *x, int64_t incx,
 
 sycl::event nrm2(sycl::queue &queue, int64_t n, const std::complex<float> *x, int64_t incx,
                      float *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1204,7 +1204,7 @@ sycl::event nrm2(sycl::queue &queue, int64_t n, const std::complex<float> *x, in
 
 sycl::event nrm2(sycl::queue &queue, int64_t n, const std::complex<double> *x, int64_t incx,
                      double *result, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1218,7 +1218,7 @@ sycl::event nrm2(sycl::queue &queue, int64_t n, const std::complex<double> *x, i
 sycl::event rot(sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                     int64_t incy, float c, float s,
                     const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1234,7 +1234,7 @@ sycl::event rot(sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
 sycl::event rot(sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                     int64_t incy, double c, double s,
                     const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1250,7 +1250,7 @@ sycl::event rot(sycl::queue &queue, int64_t n, double *x, int64_t incx, double *
 sycl::event rot(sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t incx,
                     std::complex<float> *y, int64_t incy, float c, float s,
                     const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1266,7 +1266,7 @@ sycl::event rot(sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t i
 sycl::event rot(sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t incx,
                     std::complex<double> *y, int64_t incy, double c, double s,
                     const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1281,7 +1281,7 @@ sycl::event rot(sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t
 
 sycl::event rotg(sycl::queue &queue, float *a, float *b, float *c, float *s,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1293,7 +1293,7 @@ sycl::event rotg(sycl::queue &queue, float *a, float *b, float *c, float *s,
 
 sycl::event rotg(sycl::queue &queue, double *a, double *b, double *c, double *s,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1306,7 +1306,7 @@ sycl::event rotg(sycl::queue &queue, double *a, double *b, double *c, double *s,
 sycl::event rotg(sycl::queue &queue, std::complex<float> *a, std::complex<float> *b,
                      float *c, std::complex<float> *s,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1319,7 +1319,7 @@ sycl::event rotg(sycl::queue &queue, std::complex<float> *a, std::complex<float>
 sycl::event rotg(sycl::queue &queue, std::complex<double> *a, std::complex<double> *b,
                      double *c, std::complex<double> *s,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1331,7 +1331,7 @@ sycl::event rotg(sycl::queue &queue, std::complex<double> *a, std::complex<doubl
 
 sycl::event rotm(sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                      int64_t incy, float *param, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1346,7 +1346,7 @@ sycl::event rotm(sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y
 sycl::event rotm(sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                      int64_t incy, double *param,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1360,7 +1360,7 @@ sycl::event rotm(sycl::queue &queue, int64_t n, double *x, int64_t incx, double
 
 sycl::event rotmg(sycl::queue &queue, float *d1, float *d2, float *x1, float y1,
                       float *param, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1373,7 +1373,7 @@ sycl::event rotmg(sycl::queue &queue, float *d1, float *d2, float *x1, float y1,
 
 sycl::event rotmg(sycl::queue &queue, double *d1, double *d2, double *x1, double y1,
                       double *param, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1386,7 +1386,7 @@ sycl::event rotmg(sycl::queue &queue, double *d1, double *d2, double *x1, double
 
 sycl::event scal(sycl::queue &queue, int64_t n, float alpha, float *x, int64_t incx,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1400,7 +1400,7 @@ sycl::event scal(sycl::queue &queue, int64_t n, float alpha, float *x, int64_t i
 
 sycl::event scal(sycl::queue &queue, int64_t n, double alpha, double *x, int64_t incx,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1415,7 +1415,7 @@ sycl::event scal(sycl::queue &queue, int64_t n, double alpha, double *x, int64_t
 sycl::event scal(sycl::queue &queue, int64_t n, std::complex<float> alpha,
                      std::complex<float> *x, int64_t incx,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1429,7 +1429,7 @@ sycl::event scal(sycl::queue &queue, int64_t n, std::complex<float> alpha,
 
 sycl::event scal(sycl::queue &queue, int64_t n, float alpha, std::complex<float> *x,
                      int64_t incx, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1444,7 +1444,7 @@ sycl::event scal(sycl::queue &queue, int64_t n, float alpha, std::complex<float>
 sycl::event scal(sycl::queue &queue, int64_t n, std::complex<double> alpha,
                      std::complex<double> *x, int64_t incx,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1458,7 +1458,7 @@ sycl::event scal(sycl::queue &queue, int64_t n, std::complex<double> alpha,
 
 sycl::event scal(sycl::queue &queue, int64_t n, double alpha, std::complex<double> *x,
                      int64_t incx, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1473,7 +1473,7 @@ sycl::event scal(sycl::queue &queue, int64_t n, double alpha, std::complex<doubl
 sycl::event sdsdot(sycl::queue &queue, int64_t n, float sb, const float *x, int64_t incx,
                        const float *y, int64_t incy, float *result,
                        const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1488,7 +1488,7 @@ sycl::event sdsdot(sycl::queue &queue, int64_t n, float sb, const float *x, int6
 
 sycl::event swap(sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y,
                      int64_t incy, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1501,7 +1501,7 @@ sycl::event swap(sycl::queue &queue, int64_t n, float *x, int64_t incx, float *y
 
 sycl::event swap(sycl::queue &queue, int64_t n, double *x, int64_t incx, double *y,
                      int64_t incy, const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1515,7 +1515,7 @@ sycl::event swap(sycl::queue &queue, int64_t n, double *x, int64_t incx, double
 sycl::event swap(sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t incx,
                      std::complex<float> *y, int64_t incy,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
@@ -1529,7 +1529,7 @@ sycl::event swap(sycl::queue &queue, int64_t n, std::complex<float> *x, int64_t
 sycl::event swap(sycl::queue &queue, int64_t n, std::complex<double> *x, int64_t incx,
                      std::complex<double> *y, int64_t incy,
                      const std::vector<sycl::event> &dependencies) {
-    auto done = queue.submit([&](sycl::handler &cgh) {
+    auto done = submit_host_task(queue, [&](auto &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
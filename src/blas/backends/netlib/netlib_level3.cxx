@@ -28,11 +28,8 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sgemm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                          (const int)ldb, (const float)beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_gemm<float>(MAJOR, transa, transb, m, n, k, alpha, accessor_a.get_pointer(), lda,
+                              accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -46,11 +43,8 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dgemm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                          (const int)ldb, (const double)beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_gemm<double>(MAJOR, transa, transb, m, n, k, alpha, accessor_a.get_pointer(), lda,
+                               accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -64,11 +58,9 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cgemm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                          (const int)ldb, (const void *)&beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_gemm<std::complex<float>>(MAJOR, transa, transb, m, n, k, alpha,
+                                            accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                            ldb, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -82,11 +74,10 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zgemm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                          (const int)ldb, (const void *)&beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_gemm<std::complex<double>>(MAJOR, transa, transb, m, n, k, alpha,
+                                             accessor_a.get_pointer(), lda,
+                                             accessor_b.get_pointer(), ldb, beta,
+                                             accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -95,36 +86,45 @@ void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int
           int64_t k, sycl::half alpha, sycl::buffer<sycl::half, 1> &a, int64_t lda,
           sycl::buffer<sycl::half, 1> &b, int64_t ldb, sycl::half beta,
           sycl::buffer<sycl::half, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_hgemm>(cgh, [=]() {
+            native_gemm(MAJOR, transa, transb, m, n, k, float(alpha), accessor_a.get_pointer(), lda,
+                        accessor_b.get_pointer(), ldb, float(beta), accessor_c.get_pointer(), ldc);
+        });
+    });
 }
 
 void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
           int64_t k, float alpha, sycl::buffer<sycl::half, 1> &a, int64_t lda,
           sycl::buffer<sycl::half, 1> &b, int64_t ldb, float beta,
           sycl::buffer<float, 1> &c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_gemm_f16f16f32>(cgh, [=]() {
+            native_gemm(MAJOR, transa, transb, m, n, k, alpha, accessor_a.get_pointer(), lda,
+                        accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
+        });
+    });
 }
 
 void gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
           int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a, int64_t lda,
           sycl::buffer<bfloat16, 1> &b, int64_t ldb, float beta, sycl::buffer<float, 1> &c,
           int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler &cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_gemm_bf16bf16f32>(cgh, [=]() {
+            native_gemm(MAJOR, transa, transb, m, n, k, alpha, accessor_a.get_pointer(), lda,
+                        accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
+        });
+    });
 }
 
 void hemm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
@@ -306,10 +306,8 @@ void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int6
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ssyrk>(cgh, [=]() {
-            ::cblas_ssyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, accessor_a.get_pointer(),
-                          (const int)lda, (const float)beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_syrk<float>(MAJOR, upper_lower, trans, n, k, alpha, accessor_a.get_pointer(), lda,
+                              beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -321,10 +319,8 @@ void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int6
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dsyrk>(cgh, [=]() {
-            ::cblas_dsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, accessor_a.get_pointer(),
-                          (const int)lda, (const double)beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_syrk<double>(MAJOR, upper_lower, trans, n, k, alpha, accessor_a.get_pointer(),
+                               lda, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -336,10 +332,9 @@ void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int6
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_csyrk>(cgh, [=]() {
-            ::cblas_csyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.get_pointer(), (const int)lda, (const void *)&beta,
-                          accessor_c.get_pointer(), (const int)ldc);
+            tiled_syrk<std::complex<float>>(MAJOR, upper_lower, trans, n, k, alpha,
+                                            accessor_a.get_pointer(), lda, beta,
+                                            accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -351,10 +346,9 @@ void syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int6
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zsyrk>(cgh, [=]() {
-            ::cblas_zsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.get_pointer(), (const int)lda, (const void *)&beta,
-                          accessor_c.get_pointer(), (const int)ldc);
+            tiled_syrk<std::complex<double>>(MAJOR, upper_lower, trans, n, k, alpha,
+                                             accessor_a.get_pointer(), lda, beta,
+                                             accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -502,11 +496,8 @@ void trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_strsm>(cgh, [=]() {
-            ::cblas_strsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trsm<float>(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha,
+                              accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -518,11 +509,8 @@ void trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dtrsm>(cgh, [=]() {
-            ::cblas_dtrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trsm<double>(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha,
+                               accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -535,11 +523,9 @@ void trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ctrsm>(cgh, [=]() {
-            ::cblas_ctrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trsm<std::complex<float>>(MAJOR, left_right, upper_lower, transa, unit_diag, m, n,
+                                            alpha, accessor_a.get_pointer(), lda,
+                                            accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -552,11 +538,9 @@ void trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpose trans
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ztrsm>(cgh, [=]() {
-            ::cblas_ztrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trsm<std::complex<double>>(MAJOR, left_right, upper_lower, transa, unit_diag, m,
+                                             n, alpha, accessor_a.get_pointer(), lda,
+                                             accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -573,9 +557,7 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sgemm_usm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const float)beta, c, (const int)ldc);
+            tiled_gemm<float>(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -591,9 +573,7 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dgemm_usm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const double)beta, c, (const int)ldc);
+            tiled_gemm<double>(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -610,10 +590,8 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cgemm_usm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void *)&beta, c,
-                          (const int)ldc);
+            tiled_gemm<std::complex<float>>(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                            beta, c, ldc);
         });
     });
     return done;
@@ -630,10 +608,8 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zgemm_usm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void *)&beta, c,
-                          (const int)ldc);
+            tiled_gemm<std::complex<double>>(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                             beta, c, ldc);
         });
     });
     return done;
@@ -643,36 +619,49 @@ sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t
                      int64_t n, int64_t k, sycl::half alpha, const sycl::half *a, int64_t lda,
                      const sycl::half *b, int64_t ldb, sycl::half beta, sycl::half *c, int64_t ldc,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_hgemm_usm>(cgh, [=]() {
+            native_gemm(MAJOR, transa, transb, m, n, k, float(alpha), a, lda, b, ldb, float(beta), c,
+                        ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
                      int64_t n, int64_t k, float alpha, const sycl::half *a, int64_t lda,
                      const sycl::half *b, int64_t ldb, float beta, float *c, int64_t ldc,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_f16f16f32_usm>(cgh, [=]() {
+            native_gemm(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm(sycl::queue &queue, transpose transa, transpose transb, int64_t m,
                      int64_t n, int64_t k, float alpha, const bfloat16 *a, int64_t lda,
                      const bfloat16 *b, int64_t ldb, float beta, float *c, int64_t ldc,
                      const std::vector<sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bf16bf16f32_usm>(cgh, [=]() {
+            native_gemm(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event hemm(sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
@@ -876,9 +865,7 @@ sycl::event syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ssyrk_usm>(cgh, [=]() {
-            ::cblas_ssyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, a, (const int)lda,
-                          (const float)beta, c, (const int)ldc);
+            tiled_syrk<float>(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -893,9 +880,7 @@ sycl::event syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dsyrk_usm>(cgh, [=]() {
-            ::cblas_dsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, a, (const int)lda,
-                          (const double)beta, c, (const int)ldc);
+            tiled_syrk<double>(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -911,9 +896,8 @@ sycl::event syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_csyrk_usm>(cgh, [=]() {
-            ::cblas_csyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda,
-                          (const void *)&beta, c, (const int)ldc);
+            tiled_syrk<std::complex<float>>(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                                            ldc);
         });
     });
     return done;
@@ -929,9 +913,8 @@ sycl::event syrk(sycl::queue &queue, uplo upper_lower, transpose trans, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zsyrk_usm>(cgh, [=]() {
-            ::cblas_zsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda,
-                          (const void *)&beta, c, (const int)ldc);
+            tiled_syrk<std::complex<double>>(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta,
+                                             c, ldc);
         });
     });
     return done;
@@ -1095,10 +1078,8 @@ sycl::event trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_strsm_usm>(cgh, [=]() {
-            ::cblas_strsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trsm<float>(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                              lda, b, ldb);
         });
     });
     return done;
@@ -1114,10 +1095,8 @@ sycl::event trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dtrsm_usm>(cgh, [=]() {
-            ::cblas_dtrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trsm<double>(MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                               lda, b, ldb);
         });
     });
     return done;
@@ -1133,10 +1112,8 @@ sycl::event trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ctrsm_usm>(cgh, [=]() {
-            ::cblas_ctrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trsm<std::complex<float>>(MAJOR, left_right, upper_lower, transa, unit_diag, m, n,
+                                            alpha, a, lda, b, ldb);
         });
     });
     return done;
@@ -1152,10 +1129,8 @@ sycl::event trsm(sycl::queue &queue, side left_right, uplo upper_lower, transpos
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ztrsm_usm>(cgh, [=]() {
-            ::cblas_ztrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trsm<std::complex<double>>(MAJOR, left_right, upper_lower, transa, unit_diag, m,
+                                             n, alpha, a, lda, b, ldb);
         });
     });
     return done;
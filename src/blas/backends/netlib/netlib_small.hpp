@@ -0,0 +1,268 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_SMALL_HPP_
+#define _NETLIB_SMALL_HPP_
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <utility>
+
+#include "netlib_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Host kernels for the small matrices of trsm_batch and syrk_batch.
+ *
+ * Matrices are handled in column-major form; row-major calls are mapped to the
+ * equivalent column-major problem. op(A) is copied into a local dense array
+ * and the reciprocals of its diagonal are computed once per matrix. The
+ * triangle dimension of trsm and the order of C of syrk are compile-time
+ * constants for 4, 8, 16 and 32, so the loops over them are fully unrolled
+ * and vectorized; other sizes up to small_kernel_max_size use the same code
+ * with run-time bounds. Larger matrices are handed to CBLAS.
+ */
+
+// Largest trsm triangle and syrk order handled by the small kernels.
+constexpr int64_t small_kernel_max_size = 32;
+
+// Number of right-hand sides solved together by the left-side trsm kernel:
+//  32 bytes of elements.
+template <typename T>
+constexpr int64_t small_trsm_rhs_block = std::max<int64_t>(32 / sizeof(T), 2);
+
+// Number of floating point operations of a trsm with the given dimensions.
+template <typename T>
+inline int64_t trsm_flops(side left_right, int64_t m, int64_t n) {
+    return (is_complex<T>::value ? 4 : 1) * m * n * ((left_right == side::left) ? m : n);
+}
+
+// Number of floating point operations of a syrk of order n and rank k.
+template <typename T>
+inline int64_t syrk_flops(int64_t n, int64_t k) {
+    return (is_complex<T>::value ? 4 : 1) * n * (n + 1) * k;
+}
+
+// Solves op(A) X = alpha B (left) or X op(A) = alpha B (right) in place in B,
+//  op(A) being a dim x dim triangle (dim = N when N != 0) and B having rhs
+//  columns (left) or rows (right).
+template <typename T, int N>
+inline void small_trsm_kernel(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                              int64_t dim_runtime, int64_t rhs, T alpha, const T *a, int64_t lda,
+                              T *b, int64_t ldb) {
+    constexpr int64_t max_dim = N ? N : small_kernel_max_size;
+    const int64_t dim = N ? N : dim_runtime;
+    const bool trans_a = trans != transpose::nontrans;
+    const bool conj = trans == transpose::conjtrans;
+    const bool lower = (upper_lower == uplo::lower) != trans_a;
+
+    // t(i, j) = op(A)(i, j) on the referenced triangle.
+    T t[max_dim * max_dim];
+    T inv_diag[max_dim];
+    for (int64_t j = 0; j < dim; j++) {
+        const int64_t i_begin = lower ? j : 0;
+        const int64_t i_end = lower ? dim : j + 1;
+        for (int64_t i = i_begin; i < i_end; i++)
+            t[i + j * dim] = trans_a ? conj_if(a[j + i * lda], conj) : a[i + j * lda];
+        inv_diag[j] = (unit_diag == diag::unit) ? T(1) : T(1) / t[j + j * dim];
+    }
+
+    if (left_right == side::left) {
+        // x(i, c) holds row i of small_trsm_rhs_block columns of X, so every
+        //  step of the substitution is a vector operation across columns.
+        constexpr int64_t nb = small_trsm_rhs_block<T>;
+        for (int64_t c_begin = 0; c_begin < rhs; c_begin += nb) {
+            const int64_t cols = std::min(nb, rhs - c_begin);
+            T *b_c = b + c_begin * ldb;
+            T x[max_dim][nb];
+            for (int64_t c = 0; c < nb; c++) {
+                for (int64_t i = 0; i < dim; i++)
+                    x[i][c] = (c < cols) ? alpha * b_c[i + c * ldb] : T(0);
+            }
+            for (int64_t step = 0; step < dim; step++) {
+                const int64_t i = lower ? step : dim - 1 - step;
+                const int64_t r_begin = lower ? i + 1 : 0;
+                const int64_t r_end = lower ? dim : i;
+                for (int64_t c = 0; c < nb; c++)
+                    x[i][c] *= inv_diag[i];
+                for (int64_t r = r_begin; r < r_end; r++) {
+                    const T t_ri = t[r + i * dim];
+                    for (int64_t c = 0; c < nb; c++)
+                        x[r][c] -= t_ri * x[i][c];
+                }
+            }
+            for (int64_t c = 0; c < cols; c++) {
+                for (int64_t i = 0; i < dim; i++)
+                    b_c[i + c * ldb] = x[i][c];
+            }
+        }
+        return;
+    }
+
+    // Right side: column j of X only depends on the columns already solved,
+    //  which come before it for an upper op(A) and after it for a lower one.
+    for (int64_t step = 0; step < dim; step++) {
+        const int64_t j = lower ? dim - 1 - step : step;
+        const int64_t k_begin = lower ? j + 1 : 0;
+        const int64_t k_end = lower ? dim : j;
+        T *b_j = b + j * ldb;
+        for (int64_t r = 0; r < rhs; r++)
+            b_j[r] *= alpha;
+        for (int64_t k = k_begin; k < k_end; k++) {
+            const T t_kj = t[k + j * dim];
+            const T *b_k = b + k * ldb;
+            for (int64_t r = 0; r < rhs; r++)
+                b_j[r] -= t_kj * b_k[r];
+        }
+        for (int64_t r = 0; r < rhs; r++)
+            b_j[r] *= inv_diag[j];
+    }
+}
+
+// trsm for the small matrices of a batch.
+template <typename T>
+inline void small_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                       diag unit_diag, int64_t m, int64_t n, T alpha, const T *a, int64_t lda,
+                       T *b, int64_t ldb) {
+    if (layout == CBLAS_LAYOUT::CblasRowMajor) {
+        // A row-major B is the column-major B^T, which solves the transposed
+        //  equation with A on the other side.
+        left_right = (left_right == side::left) ? side::right : side::left;
+        upper_lower = (upper_lower == uplo::upper) ? uplo::lower : uplo::upper;
+        std::swap(m, n);
+    }
+    if (m <= 0 || n <= 0)
+        return;
+    if (alpha == T(0)) {
+        for (int64_t j = 0; j < n; j++)
+            std::fill(b + j * ldb, b + j * ldb + m, T(0));
+        return;
+    }
+    const bool left = left_right == side::left;
+    const int64_t dim = left ? m : n;
+    const int64_t rhs = left ? n : m;
+    switch (dim) {
+        case 4:
+            small_trsm_kernel<T, 4>(left_right, upper_lower, trans, unit_diag, dim, rhs, alpha, a,
+                                    lda, b, ldb);
+            break;
+        case 8:
+            small_trsm_kernel<T, 8>(left_right, upper_lower, trans, unit_diag, dim, rhs, alpha, a,
+                                    lda, b, ldb);
+            break;
+        case 16:
+            small_trsm_kernel<T, 16>(left_right, upper_lower, trans, unit_diag, dim, rhs, alpha,
+                                     a, lda, b, ldb);
+            break;
+        case 32:
+            small_trsm_kernel<T, 32>(left_right, upper_lower, trans, unit_diag, dim, rhs, alpha,
+                                     a, lda, b, ldb);
+            break;
+        default:
+            if (dim <= small_kernel_max_size)
+                small_trsm_kernel<T, 0>(left_right, upper_lower, trans, unit_diag, dim, rhs,
+                                        alpha, a, lda, b, ldb);
+            else
+                cblas_trsm(CBLAS_LAYOUT::CblasColMajor, left_right, upper_lower, trans,
+                           unit_diag, m, n, alpha, a, lda, b, ldb);
+            break;
+    }
+}
+
+// C = alpha * op(A) * op(A)^T + beta * C on the referenced triangle of C,
+//  C being n x n (n = N when N != 0).
+template <typename T, int N>
+inline void small_syrk_kernel(uplo upper_lower, transpose trans, int64_t n_runtime, int64_t k,
+                              T alpha, const T *a, int64_t lda, T beta, T *c, int64_t ldc) {
+    constexpr int64_t max_n = N ? N : small_kernel_max_size;
+    const int64_t n = N ? N : n_runtime;
+    const bool upper = upper_lower == uplo::upper;
+    const bool trans_a = trans != transpose::nontrans;
+
+    T acc[max_n * max_n];
+    for (int64_t i = 0; i < n * n; i++)
+        acc[i] = T(0);
+    for (int64_t l = 0; l < k; l++) {
+        // Column l of op(A).
+        T a_l[max_n];
+        for (int64_t i = 0; i < n; i++)
+            a_l[i] = trans_a ? a[l + i * lda] : a[i + l * lda];
+        for (int64_t j = 0; j < n; j++) {
+            const T a_jl = a_l[j];
+            const int64_t i_begin = upper ? 0 : j;
+            const int64_t i_end = upper ? j + 1 : n;
+            for (int64_t i = i_begin; i < i_end; i++)
+                acc[i + j * n] += a_l[i] * a_jl;
+        }
+    }
+    for (int64_t j = 0; j < n; j++) {
+        const int64_t i_begin = upper ? 0 : j;
+        const int64_t i_end = upper ? j + 1 : n;
+        T *c_j = c + j * ldc;
+        for (int64_t i = i_begin; i < i_end; i++)
+            c_j[i] = alpha * acc[i + j * n] + ((beta == T(0)) ? T(0) : beta * c_j[i]);
+    }
+}
+
+// syrk for the small matrices of a batch.
+template <typename T>
+inline void small_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n,
+                       int64_t k, T alpha, const T *a, int64_t lda, T beta, T *c, int64_t ldc) {
+    if (layout == CBLAS_LAYOUT::CblasRowMajor) {
+        // Row-major storage holds the transposes: C is symmetric, so only the
+        //  referenced triangle changes, and op(A) becomes its transpose.
+        upper_lower = (upper_lower == uplo::upper) ? uplo::lower : uplo::upper;
+        trans = (trans == transpose::nontrans) ? transpose::trans : transpose::nontrans;
+    }
+    if (n <= 0)
+        return;
+    switch (n) {
+        case 4:
+            small_syrk_kernel<T, 4>(upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+            break;
+        case 8:
+            small_syrk_kernel<T, 8>(upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+            break;
+        case 16:
+            small_syrk_kernel<T, 16>(upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+            break;
+        case 32:
+            small_syrk_kernel<T, 32>(upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+            break;
+        default:
+            if (n <= small_kernel_max_size)
+                small_syrk_kernel<T, 0>(upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+            else
+                cblas_syrk(CBLAS_LAYOUT::CblasColMajor, upper_lower, trans, n, k, alpha, a, lda,
+                           beta, c, ldc);
+            break;
+    }
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_SMALL_HPP_
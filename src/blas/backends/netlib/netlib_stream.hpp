@@ -0,0 +1,206 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_STREAM_HPP_
+#define _NETLIB_STREAM_HPP_
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "netlib_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Host kernels for the memory-bound batch routines copy_batch, axpy_batch and
+ * dgmm_batch.
+ *
+ * Every batch entry is processed in a single pass over its operands, and the
+ * entries are split into contiguous ranges sized in bytes rather than flops,
+ * so each host thread streams through adjacent memory. gemv_batch uses the
+ * same scheduling around CBLAS gemv. When the dgmm outputs of a call are
+ * larger than the streaming threshold, their columns are written with
+ * non-temporal stores: they would not fit in the caches anyway, and bypassing
+ * them avoids reading every output line before it is overwritten. The
+ * threshold defaults to 8 MiB and can be set with the
+ * ONEMKL_NETLIB_STREAMING_THRESHOLD environment variable (bytes).
+ */
+
+// Smallest amount of memory traffic, in bytes, worth handing to an additional
+//  thread.
+constexpr int64_t min_bytes_per_thread = int64_t(1) << 18;
+
+// Number of consecutive items a thread should at least process so that each
+//  thread moves min_bytes_per_thread bytes.
+inline int64_t get_streaming_grain_size(int64_t bytes_per_item) {
+    return std::max<int64_t>(1, min_bytes_per_thread / std::max<int64_t>(bytes_per_item, 1));
+}
+
+// Whether outputs totalling output_bytes bytes are written with non-temporal
+//  stores.
+inline bool use_streaming_stores(int64_t output_bytes) {
+    static const int64_t threshold = []() {
+        int64_t bytes = int64_t(8) << 20;
+        if (const char *env = std::getenv("ONEMKL_NETLIB_STREAMING_THRESHOLD"))
+            bytes = std::atoll(env);
+        return bytes;
+    }();
+    return threshold > 0 && output_bytes >= threshold;
+}
+
+// Copies n elements from src to dst with non-temporal stores when available.
+template <typename T>
+inline void stream_copy(T *dst, const T *src, int64_t n) {
+#if defined(__SSE2__)
+    // Element sizes are multiples of 4 bytes: 4-byte stores reach the 16-byte
+    //  alignment of the vector stores and write the tail.
+    const char *s = reinterpret_cast<const char *>(src);
+    char *d = reinterpret_cast<char *>(dst);
+    int64_t bytes = n * static_cast<int64_t>(sizeof(T));
+    for (; bytes >= 4 && (reinterpret_cast<std::uintptr_t>(d) & 15); bytes -= 4, s += 4, d += 4) {
+        int value;
+        std::memcpy(&value, s, 4);
+        _mm_stream_si32(reinterpret_cast<int *>(d), value);
+    }
+    for (; bytes >= 16; bytes -= 16, s += 16, d += 16)
+        _mm_stream_si128(reinterpret_cast<__m128i *>(d),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(s)));
+    for (; bytes >= 4; bytes -= 4, s += 4, d += 4) {
+        int value;
+        std::memcpy(&value, s, 4);
+        _mm_stream_si32(reinterpret_cast<int *>(d), value);
+    }
+#else
+    std::memcpy(dst, src, n * sizeof(T));
+#endif
+}
+
+// Orders the non-temporal stores of the calling thread before its later
+//  stores, so the results are visible once the host_task completes.
+inline void stream_fence() {
+#if defined(__SSE2__)
+    _mm_sfence();
+#endif
+}
+
+// Elements computed on the stack before being streamed to a unit stride
+//  output.
+template <typename T>
+constexpr int64_t stream_chunk = 1024 / sizeof(T);
+
+// Pointer to the first element accessed by a BLAS vector of n elements with
+//  increment inc.
+template <typename T>
+inline T *vector_start(T *x, int64_t n, int64_t inc) {
+    return (inc < 0) ? x + (1 - n) * inc : x;
+}
+
+// Unit stride copies use memcpy, which already switches to non-temporal
+//  stores for copies larger than the caches.
+template <typename T>
+inline void copy_kernel(int64_t n, const T *x, int64_t incx, T *y, int64_t incy) {
+    if (n <= 0)
+        return;
+    x = vector_start(x, n, incx);
+    y = vector_start(y, n, incy);
+    if (incx == 1 && incy == 1) {
+        std::memcpy(y, x, n * sizeof(T));
+        return;
+    }
+    for (int64_t i = 0; i < n; i++)
+        y[i * incy] = x[i * incx];
+}
+
+template <typename T>
+inline void axpy_kernel(int64_t n, T alpha, const T *x, int64_t incx, T *y, int64_t incy) {
+    if (n <= 0)
+        return;
+    x = vector_start(x, n, incx);
+    y = vector_start(y, n, incy);
+    if (incx == 1 && incy == 1) {
+        for (int64_t i = 0; i < n; i++)
+            y[i] += alpha * x[i];
+        return;
+    }
+    for (int64_t i = 0; i < n; i++)
+        y[i * incy] += alpha * x[i * incx];
+}
+
+// c = diag(x) * a (left) or a * diag(x) (right), c and a being m x n.
+template <typename T>
+inline void dgmm_kernel(CBLAS_LAYOUT layout, side left_right, int64_t m, int64_t n, const T *a,
+                        int64_t lda, const T *x, int64_t incx, T *c, int64_t ldc, bool stream) {
+    if (layout == CBLAS_LAYOUT::CblasRowMajor) {
+        // The row-major a is the column-major a^T, scaled from the other side.
+        left_right = (left_right == side::left) ? side::right : side::left;
+        std::swap(m, n);
+    }
+    if (m <= 0 || n <= 0)
+        return;
+    const bool left = left_right == side::left;
+    x = vector_start(x, left ? m : n, incx);
+    for (int64_t j = 0; j < n; j++) {
+        const T *a_j = a + j * lda;
+        T *c_j = c + j * ldc;
+        if (!stream) {
+            if (left) {
+                for (int64_t i = 0; i < m; i++)
+                    c_j[i] = x[i * incx] * a_j[i];
+            }
+            else {
+                const T x_j = x[j * incx];
+                for (int64_t i = 0; i < m; i++)
+                    c_j[i] = x_j * a_j[i];
+            }
+            continue;
+        }
+        T chunk[stream_chunk<T>];
+        for (int64_t i_begin = 0; i_begin < m; i_begin += stream_chunk<T>) {
+            const int64_t rows = std::min(stream_chunk<T>, m - i_begin);
+            if (left) {
+                for (int64_t i = 0; i < rows; i++)
+                    chunk[i] = x[(i_begin + i) * incx] * a_j[i_begin + i];
+            }
+            else {
+                const T x_j = x[j * incx];
+                for (int64_t i = 0; i < rows; i++)
+                    chunk[i] = x_j * a_j[i_begin + i];
+            }
+            stream_copy(c_j + i_begin, chunk, rows);
+        }
+    }
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_STREAM_HPP_
@@ -0,0 +1,277 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_TILING_HPP_
+#define _NETLIB_TILING_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "netlib_common.hpp"
+#include "netlib_gemm.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Tiled execution of level-3 routines.
+ *
+ * When the linked CBLAS is single-threaded, a level-3 call only uses one core.
+ * In tiled mode the output of gemm, syrk and trsm is split into independent
+ * tiles (or panels for trsm), each computed by a separate CBLAS call on one of
+ * the host threads used by parallel_for. gemmt has no CBLAS counterpart and is
+ * always computed on tiles of its triangle.
+ *
+ * The mode is off by default and is controlled by environment variables:
+ *   ONEMKL_NETLIB_TILING=1         enables tiled execution,
+ *   ONEMKL_NETLIB_TILE_SIZE=<n>    sets the largest tile dimension (default 256).
+ */
+
+struct tiling_config {
+    bool enabled = false;
+    int64_t tile_size = 256;
+};
+
+inline const tiling_config &get_tiling_config() {
+    static const tiling_config config = []() {
+        tiling_config result;
+        if (const char *env = std::getenv("ONEMKL_NETLIB_TILING"))
+            result.enabled = std::strcmp(env, "0") != 0 && std::strcmp(env, "") != 0;
+        if (const char *env = std::getenv("ONEMKL_NETLIB_TILE_SIZE")) {
+            int64_t tile_size = std::atoll(env);
+            if (tile_size > 0)
+                result.tile_size = tile_size;
+        }
+        return result;
+    }();
+    return config;
+}
+
+// Smallest tile dimension the tile size is reduced to in order to produce at
+//  least one tile per thread.
+constexpr int64_t min_tile_size = 64;
+
+// Returns the tile size to use for an output of rows x cols elements that costs
+//  the given number of flops, or 0 if the call should not be tiled.
+inline int64_t get_tile_size(int64_t rows, int64_t cols, int64_t flops) {
+    const auto &config = get_tiling_config();
+    const int64_t num_threads = get_max_threads();
+    if (!config.enabled || num_threads <= 1 || flops < 2 * min_flops_per_thread)
+        return 0;
+    int64_t tile = config.tile_size;
+    auto num_tiles = [&](int64_t t) { return ((rows + t - 1) / t) * ((cols + t - 1) / t); };
+    while (tile > min_tile_size && num_tiles(tile) < num_threads)
+        tile = std::max(min_tile_size, tile / 2);
+    return num_tiles(tile) > 1 ? tile : 0;
+}
+
+template <typename T>
+inline void tiled_gemm(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, T alpha, const T *a, int64_t lda, const T *b,
+                       int64_t ldb, T beta, T *c, int64_t ldc) {
+#ifdef NETLIB_NATIVE_GEMM
+    // The native engine is blocked and threaded on its own.
+    native_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+#else
+    const int64_t tile = get_tile_size(m, n, gemm_flops<T>(m, n, k));
+    if (tile == 0) {
+        cblas_gemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        return;
+    }
+    const int64_t tiles_m = (m + tile - 1) / tile;
+    const int64_t tiles_n = (n + tile - 1) / tile;
+    // Consecutive tiles share the same panel of op(B), so threads get
+    //  contiguous ranges of tiles in column order.
+    parallel_for(tiles_m * tiles_n, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t t = begin; t < end; t++) {
+            const int64_t i = (t % tiles_m) * tile;
+            const int64_t j = (t / tiles_m) * tile;
+            cblas_gemm(layout, transa, transb, std::min(tile, m - i), std::min(tile, n - j), k,
+                       alpha, a + op_row_offset(layout, transa, lda, i), lda,
+                       b + op_col_offset(layout, transb, ldb, j), ldb, beta,
+                       c + matrix_offset(layout, ldc, i, j), ldc);
+        }
+    });
+#endif
+}
+
+template <typename T>
+inline void tiled_syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n,
+                       int64_t k, T alpha, const T *a, int64_t lda, T beta, T *c, int64_t ldc) {
+    const int64_t tile = get_tile_size(n, n, gemm_flops<T>(n, n, k) / 2);
+    if (tile == 0) {
+        cblas_syrk(layout, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        return;
+    }
+    // Only the tiles intersecting the referenced triangle are computed: syrk
+    //  on the diagonal tiles and gemm on the off-diagonal ones.
+    const int64_t num_tiles = (n + tile - 1) / tile;
+    std::vector<std::pair<int64_t, int64_t>> tiles;
+    tiles.reserve(num_tiles * (num_tiles + 1) / 2);
+    for (int64_t tj = 0; tj < num_tiles; tj++) {
+        for (int64_t ti = 0; ti < num_tiles; ti++) {
+            if (ti == tj || (upper_lower == uplo::lower) == (ti > tj))
+                tiles.emplace_back(ti * tile, tj * tile);
+        }
+    }
+    const transpose trans_t =
+        (trans == transpose::nontrans) ? transpose::trans : transpose::nontrans;
+    parallel_for(tiles.size(), 1, [&](int64_t begin, int64_t end) {
+        for (int64_t t = begin; t < end; t++) {
+            const int64_t i = tiles[t].first;
+            const int64_t j = tiles[t].second;
+            const T *a_i = a + op_row_offset(layout, trans, lda, i);
+            if (i == j) {
+                cblas_syrk(layout, upper_lower, trans, std::min(tile, n - i), k, alpha, a_i, lda,
+                           beta, c + matrix_offset(layout, ldc, i, i), ldc);
+            }
+            else {
+                cblas_gemm(layout, trans, trans_t, std::min(tile, n - i), std::min(tile, n - j), k,
+                           alpha, a_i, lda, a + op_row_offset(layout, trans, lda, j), lda, beta,
+                           c + matrix_offset(layout, ldc, i, j), ldc);
+            }
+        }
+    });
+}
+
+template <typename T>
+inline void tiled_trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose transa,
+                       diag unit_diag, int64_t m, int64_t n, T alpha, const T *a, int64_t lda,
+                       T *b, int64_t ldb) {
+    // The columns of B are independent for a left-side solve, its rows for a
+    //  right-side one, so B is split into panels along that dimension.
+    const bool left = left_right == side::left;
+    const int64_t order = left ? m : n;
+    const int64_t extent = left ? n : m;
+    const int64_t tile = get_tile_size(1, extent, gemm_flops<T>(m, n, order) / 2);
+    if (tile == 0) {
+        cblas_trsm(layout, left_right, upper_lower, transa, unit_diag, m, n, alpha, a, lda, b,
+                   ldb);
+        return;
+    }
+    const int64_t num_panels = (extent + tile - 1) / tile;
+    parallel_for(num_panels, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t p = begin; p < end; p++) {
+            const int64_t start = p * tile;
+            const int64_t size = std::min(tile, extent - start);
+            if (left) {
+                cblas_trsm(layout, left_right, upper_lower, transa, unit_diag, m, size, alpha, a,
+                           lda, b + matrix_offset(layout, ldb, 0, start), ldb);
+            }
+            else {
+                cblas_trsm(layout, left_right, upper_lower, transa, unit_diag, size, n, alpha, a,
+                           lda, b + matrix_offset(layout, ldb, start, 0), ldb);
+            }
+        }
+    });
+}
+
+// Largest tile dimension used by gemmt; smaller tiles waste less work on the
+//  diagonal.
+constexpr int64_t gemmt_tile_size = 128;
+
+template <typename T>
+inline void tiled_gemmt(CBLAS_LAYOUT layout, uplo upper_lower, transpose transa,
+                        transpose transb, int64_t n, int64_t k, T alpha, const T *a, int64_t lda,
+                        const T *b, int64_t ldb, T beta, T *c, int64_t ldc) {
+    if (n <= 0)
+        return;
+    // gemmt always works on tiles of C: the tiles outside the referenced
+    //  triangle are skipped, the off-diagonal ones are computed by gemm and
+    //  the diagonal ones into a temporary tile of which only the triangle is
+    //  written back.
+    const int64_t num_threads = std::max<int64_t>(
+        1, std::min(get_max_threads(), gemm_flops<T>(n, n, k) / 2 / min_flops_per_thread));
+    auto triangle_tiles = [&](int64_t t) {
+        const int64_t tiles = (n + t - 1) / t;
+        return tiles * (tiles + 1) / 2;
+    };
+    int64_t tile = gemmt_tile_size;
+    while (tile > min_tile_size && triangle_tiles(tile) < 2 * num_threads)
+        tile = std::max(min_tile_size, tile / 2);
+
+    struct gemmt_tile {
+        int64_t i, j, cost;
+    };
+    const int64_t num_tiles = (n + tile - 1) / tile;
+    std::vector<gemmt_tile> tiles;
+    tiles.reserve(triangle_tiles(tile));
+    for (int64_t tj = 0; tj < num_tiles; tj++) {
+        for (int64_t ti = 0; ti < num_tiles; ti++) {
+            if (ti == tj || (upper_lower == uplo::lower) == (ti > tj)) {
+                const int64_t i = ti * tile, j = tj * tile;
+                tiles.push_back({ i, j, std::min(tile, n - i) * std::min(tile, n - j) });
+            }
+        }
+    }
+
+    // The triangle has ragged edges, so tiles are given largest first to the
+    //  least loaded thread.
+    std::stable_sort(tiles.begin(), tiles.end(),
+                     [](const gemmt_tile &x, const gemmt_tile &y) { return x.cost > y.cost; });
+    std::vector<std::vector<gemmt_tile>> work(num_threads);
+    std::vector<int64_t> load(num_threads, 0);
+    for (const auto &t : tiles) {
+        const int64_t thread = std::min_element(load.begin(), load.end()) - load.begin();
+        work[thread].push_back(t);
+        load[thread] += t.cost;
+    }
+
+    parallel_for(num_threads, 1, [&](int64_t begin, int64_t end) {
+        std::vector<T> diag_tile;
+        for (int64_t thread = begin; thread < end; thread++) {
+            for (const auto &t : work[thread]) {
+                const int64_t rows = std::min(tile, n - t.i);
+                const int64_t cols = std::min(tile, n - t.j);
+                const T *a_i = a + op_row_offset(layout, transa, lda, t.i);
+                const T *b_j = b + op_col_offset(layout, transb, ldb, t.j);
+                if (t.i != t.j) {
+                    cblas_gemm(layout, transa, transb, rows, cols, k, alpha, a_i, lda, b_j, ldb,
+                               beta, c + matrix_offset(layout, ldc, t.i, t.j), ldc);
+                    continue;
+                }
+                diag_tile.resize(rows * rows);
+                cblas_gemm(layout, transa, transb, rows, rows, k, alpha, a_i, lda, b_j, ldb, T(0),
+                           diag_tile.data(), rows);
+                T *c_ii = c + matrix_offset(layout, ldc, t.i, t.i);
+                for (int64_t q = 0; q < rows; q++) {
+                    const int64_t r_begin = (upper_lower == uplo::lower) ? q : 0;
+                    const int64_t r_end = (upper_lower == uplo::lower) ? rows : q + 1;
+                    for (int64_t r = r_begin; r < r_end; r++) {
+                        T &c_rq = c_ii[matrix_offset(layout, ldc, r, q)];
+                        const T ab = diag_tile[matrix_offset(layout, rows, r, q)];
+                        c_rq = (beta == T(0)) ? ab : ab + beta * c_rq;
+                    }
+                }
+            }
+        }
+    });
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_TILING_HPP_
@@ -0,0 +1,354 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_TRANSPOSE_HPP_
+#define _NETLIB_TRANSPOSE_HPP_
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "netlib_common.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+/**
+ * Host kernels for omatcopy, imatcopy and omatadd.
+ *
+ * Matrices are handled in column-major form; row-major calls swap m and n.
+ * Transposition works on cache blocks split into fixed-size micro-tiles, which
+ * are loaded into vector registers and transposed with shuffles. Large
+ * matrices are processed in parallel on the netlib host threads.
+ *
+ * imatcopy transposes non-square matrices in place by following the cycles of
+ * the transposition permutation, which only needs O(1) extra memory.
+ */
+
+// Edge of the cache blocks, in elements.
+constexpr int64_t transpose_block_size = 64;
+
+// Edge of the micro-tiles: 32 bytes of elements per micro-tile column.
+template <typename T>
+constexpr int transpose_micro_tile = sizeof(T) >= 16 ? 2 : 32 / sizeof(T);
+
+// Vector of N lanes of type L, as GCC and Clang vector extensions.
+template <typename L, int N>
+struct transpose_vector {
+    typedef L type __attribute__((vector_size(N * sizeof(L))));
+};
+
+// Unsigned lane type holding one element of T, for elements of 4 or 8 bytes.
+template <typename T>
+using transpose_lane =
+    typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+
+// Shuffle indices exchanging bit `bit` of the row and column indices of the
+//  rows r (bit clear) and r | bit of an N x N tile.
+constexpr int transpose_low_index(int n, int bit, int c) {
+    return (c & bit) ? n + (c ^ bit) : c;
+}
+constexpr int transpose_high_index(int n, int bit, int c) {
+    return (c & bit) ? n + c : (c | bit);
+}
+
+template <int N, int Bit, typename V, std::size_t... I>
+inline void transpose_stage(V *v, std::index_sequence<I...>) {
+#pragma GCC unroll 16
+    for (int r = 0; r < N; r++) {
+        if (r & Bit)
+            continue;
+        const V x = v[r], y = v[r | Bit];
+        v[r] = __builtin_shufflevector(x, y, transpose_low_index(N, Bit, I)...);
+        v[r | Bit] = __builtin_shufflevector(x, y, transpose_high_index(N, Bit, I)...);
+    }
+}
+
+// Transposes the N x N tile held in v[0..N) with log2(N) shuffle stages.
+template <int N, int Bit = 1, typename V>
+inline void transpose_in_registers(V *v) {
+    if constexpr (Bit < N) {
+        transpose_stage<N, Bit>(v, std::make_index_sequence<N>{});
+        transpose_in_registers<N, 2 * Bit>(v);
+    }
+}
+
+// b(j, i) = alpha * op(a(i, j)) (+ b(j, i) when accumulating) for a full
+//  micro-tile.
+template <typename T, bool conj, bool accumulate>
+inline void transpose_micro_tile_kernel(const T *a, int64_t lda, T alpha, T *b, int64_t ldb) {
+    constexpr int mt = transpose_micro_tile<T>;
+    if constexpr (sizeof(T) == 4 || sizeof(T) == 8) {
+        using V = typename transpose_vector<transpose_lane<T>, mt>::type;
+        V v[mt];
+#pragma GCC unroll 16
+        for (int j = 0; j < mt; j++)
+            std::memcpy(&v[j], a + j * lda, sizeof(V));
+        transpose_in_registers<mt>(v);
+        const bool scale = conj || accumulate || alpha != T(1);
+#pragma GCC unroll 16
+        for (int i = 0; i < mt; i++) {
+            if (!scale) {
+                std::memcpy(b + i * ldb, &v[i], sizeof(V));
+                continue;
+            }
+            T column[mt];
+            std::memcpy(column, &v[i], sizeof(V));
+            for (int j = 0; j < mt; j++) {
+                const T value = alpha * conj_if(column[j], conj);
+                b[j + i * ldb] = accumulate ? b[j + i * ldb] + value : value;
+            }
+        }
+    }
+    else {
+        for (int i = 0; i < mt; i++) {
+            for (int j = 0; j < mt; j++) {
+                const T value = alpha * conj_if(a[i + j * lda], conj);
+                b[j + i * ldb] = accumulate ? b[j + i * ldb] + value : value;
+            }
+        }
+    }
+}
+
+// b(i, j) = alpha * op(a)(i, j) (+ b(i, j) when accumulating) for one cache
+//  block of b of rows x cols elements.
+template <typename T, bool conj, bool accumulate>
+inline void op_copy_block(transpose trans, int64_t rows, int64_t cols, T alpha, const T *a,
+                          int64_t lda, T *b, int64_t ldb) {
+    if (trans == transpose::nontrans) {
+        for (int64_t j = 0; j < cols; j++) {
+            for (int64_t i = 0; i < rows; i++) {
+                const T value = alpha * a[i + j * lda];
+                b[i + j * ldb] = accumulate ? b[i + j * ldb] + value : value;
+            }
+        }
+        return;
+    }
+    constexpr int mt = transpose_micro_tile<T>;
+    const int64_t full_rows = rows / mt * mt;
+    const int64_t full_cols = cols / mt * mt;
+    for (int64_t j = 0; j < full_cols; j += mt) {
+        for (int64_t i = 0; i < full_rows; i += mt)
+            transpose_micro_tile_kernel<T, conj, accumulate>(a + j + i * lda, lda, alpha,
+                                                             b + i + j * ldb, ldb);
+    }
+    auto edge = [&](int64_t i_begin, int64_t i_end, int64_t j_begin, int64_t j_end) {
+        for (int64_t j = j_begin; j < j_end; j++) {
+            for (int64_t i = i_begin; i < i_end; i++) {
+                const T value = alpha * conj_if(a[j + i * lda], conj);
+                b[i + j * ldb] = accumulate ? b[i + j * ldb] + value : value;
+            }
+        }
+    };
+    edge(full_rows, rows, 0, cols);
+    edge(0, full_rows, full_cols, cols);
+}
+
+// b = alpha * op(a) (+ b when accumulating), b being rows x cols.
+template <typename T, bool accumulate>
+inline void op_copy(transpose trans, int64_t rows, int64_t cols, T alpha, const T *a, int64_t lda,
+                    T *b, int64_t ldb) {
+    const int64_t block = transpose_block_size;
+    const int64_t blocks_n = (cols + block - 1) / block;
+    const bool conj = trans == transpose::conjtrans;
+    parallel_for(blocks_n, get_grain_size(rows * block), [&](int64_t begin, int64_t end) {
+        for (int64_t bj = begin; bj < end; bj++) {
+            const int64_t j = bj * block;
+            const int64_t block_cols = std::min(block, cols - j);
+            for (int64_t i = 0; i < rows; i += block) {
+                const int64_t block_rows = std::min(block, rows - i);
+                const T *a_ij = a + ((trans == transpose::nontrans) ? i + j * lda : j + i * lda);
+                if (conj)
+                    op_copy_block<T, true, accumulate>(trans, block_rows, block_cols, alpha,
+                                                       a_ij, lda, b + i + j * ldb, ldb);
+                else
+                    op_copy_block<T, false, accumulate>(trans, block_rows, block_cols, alpha,
+                                                        a_ij, lda, b + i + j * ldb, ldb);
+            }
+        }
+    });
+}
+
+template <typename T>
+inline void omatcopy_kernel(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n, T alpha,
+                            const T *a, int64_t lda, T *b, int64_t ldb) {
+    if (layout == CBLAS_LAYOUT::CblasRowMajor)
+        std::swap(m, n);
+    if (m <= 0 || n <= 0)
+        return;
+    if (trans == transpose::nontrans)
+        op_copy<T, false>(trans, m, n, alpha, a, lda, b, ldb);
+    else
+        op_copy<T, false>(trans, n, m, alpha, a, lda, b, ldb);
+}
+
+template <typename T>
+inline void omatadd_kernel(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                           int64_t n, T alpha, const T *a, int64_t lda, T beta, const T *b,
+                           int64_t ldb, T *c, int64_t ldc) {
+    if (layout == CBLAS_LAYOUT::CblasRowMajor)
+        std::swap(m, n);
+    if (m <= 0 || n <= 0)
+        return;
+    op_copy<T, false>(transa, m, n, alpha, a, lda, c, ldc);
+    op_copy<T, true>(transb, m, n, beta, b, ldb, c, ldc);
+}
+
+// Moves the columns of an m x n matrix from leading dimension ld_src to ld_dst
+//  within the same storage, scaling them by alpha.
+template <typename T>
+inline void restride_in_place(int64_t m, int64_t n, T alpha, T *ab, int64_t ld_src,
+                              int64_t ld_dst) {
+    if (ld_src == ld_dst) {
+        if (alpha != T(1))
+            op_copy<T, false>(transpose::nontrans, m, n, alpha, ab, ld_src, ab, ld_dst);
+        return;
+    }
+    // Columns overlap: move them front to back when they move down in memory,
+    //  back to front otherwise.
+    if (ld_dst < ld_src) {
+        for (int64_t j = 0; j < n; j++)
+            for (int64_t i = 0; i < m; i++)
+                ab[i + j * ld_dst] = alpha * ab[i + j * ld_src];
+    }
+    else {
+        for (int64_t j = n - 1; j >= 0; j--)
+            for (int64_t i = m - 1; i >= 0; i--)
+                ab[i + j * ld_dst] = alpha * ab[i + j * ld_src];
+    }
+}
+
+// In-place ab = alpha * op(ab) for a square n x n matrix: pairs of micro-tiles
+//  mirrored across the diagonal are swapped.
+template <typename T, bool conj>
+inline void square_transpose_in_place(int64_t n, T alpha, T *ab, int64_t ld) {
+    constexpr int mt = transpose_micro_tile<T>;
+    const int64_t tiles = n / mt;
+    auto swap_tiles = [&](int64_t ti, int64_t tj) {
+        T *x = ab + ti * mt + tj * mt * ld;
+        T *y = ab + tj * mt + ti * mt * ld;
+        T tile_x[mt][mt], tile_y[mt][mt];
+        for (int j = 0; j < mt; j++) {
+            for (int i = 0; i < mt; i++) {
+                tile_x[i][j] = x[i + j * ld];
+                tile_y[i][j] = y[i + j * ld];
+            }
+        }
+        for (int j = 0; j < mt; j++) {
+            for (int i = 0; i < mt; i++) {
+                x[i + j * ld] = alpha * conj_if(tile_y[j][i], conj);
+                y[i + j * ld] = alpha * conj_if(tile_x[j][i], conj);
+            }
+        }
+    };
+    // Column tj has tj + 1 tiles to swap, so columns are paired from both
+    //  ends to give every work item the same amount of work.
+    parallel_for((tiles + 1) / 2, get_grain_size(2 * mt * mt * tiles),
+                 [&](int64_t begin, int64_t end) {
+                     for (int64_t t = begin; t < end; t++) {
+                         for (int64_t ti = 0; ti <= t; ti++)
+                             swap_tiles(ti, t);
+                         const int64_t mirror = tiles - 1 - t;
+                         if (mirror != t) {
+                             for (int64_t ti = 0; ti <= mirror; ti++)
+                                 swap_tiles(ti, mirror);
+                         }
+                     }
+                 });
+    for (int64_t j = tiles * mt; j < n; j++) {
+        for (int64_t i = 0; i < j; i++) {
+            const T x = ab[i + j * ld];
+            ab[i + j * ld] = alpha * conj_if(ab[j + i * ld], conj);
+            ab[j + i * ld] = alpha * conj_if(x, conj);
+        }
+        ab[j + j * ld] = alpha * conj_if(ab[j + j * ld], conj);
+    }
+}
+
+// In-place transposition of a compact m x n matrix into a compact n x m one.
+//  Element p = i + j * m moves to j + i * n = p * n mod (m * n - 1). Each
+//  cycle of this permutation is rotated once, by the thread owning its
+//  smallest element, which is found by walking the cycle.
+template <typename T>
+inline void cycle_transpose_in_place(int64_t m, int64_t n, T *ab) {
+    const int64_t size = m * n;
+    if (size <= 2)
+        return;
+    const int64_t modulus = size - 1;
+    auto next = [&](int64_t p) {
+        return static_cast<int64_t>((static_cast<unsigned __int128>(p) * n) % modulus);
+    };
+    parallel_for(modulus - 1, get_grain_size(4 * 64), [&](int64_t begin, int64_t end) {
+        for (int64_t start = begin + 1; start <= end; start++) {
+            int64_t p = next(start);
+            while (p > start)
+                p = next(p);
+            if (p != start)
+                continue;
+            T value = ab[start];
+            p = start;
+            do {
+                p = next(p);
+                std::swap(value, ab[p]);
+            } while (p != start);
+        }
+    });
+}
+
+template <typename T>
+inline void imatcopy_kernel(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n, T alpha,
+                            T *ab, int64_t lda, int64_t ldb) {
+    if (layout == CBLAS_LAYOUT::CblasRowMajor)
+        std::swap(m, n);
+    if (m <= 0 || n <= 0)
+        return;
+    if (trans == transpose::nontrans) {
+        restride_in_place(m, n, alpha, ab, lda, ldb);
+        return;
+    }
+    const bool conj = trans == transpose::conjtrans;
+    if (m == n && lda == ldb) {
+        if (conj)
+            square_transpose_in_place<T, true>(n, alpha, ab, lda);
+        else
+            square_transpose_in_place<T, false>(n, alpha, ab, lda);
+        return;
+    }
+    // Compact the m x n input, transpose it, then spread the n x m result to
+    //  leading dimension ldb, scaling it on the way.
+    restride_in_place(m, n, T(1), ab, lda, m);
+    cycle_transpose_in_place(m, n, ab);
+    if (conj) {
+        for (int64_t i = 0; i < m * n; i++)
+            ab[i] = conj_if(ab[i], true);
+    }
+    restride_in_place(n, m, alpha, ab, n, ldb);
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_NETLIB_TRANSPOSE_HPP_
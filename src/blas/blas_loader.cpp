@@ -35,413 +35,471 @@ static oneapi::mkl::detail::table_initializer<domain::blas, blas_function_table_
 void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_scasum_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_scasum_sycl, queue, n, x,
+                         incx, result);
 }
 
 void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_dzasum_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dzasum_sycl, queue, n, x,
+                         incx, result);
 }
 
 void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
           std::int64_t incx, sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_sasum_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sasum_sycl, queue, n, x, incx,
+                         result);
 }
 
 void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_dasum_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dasum_sycl, queue, n, x, incx,
+                         result);
 }
 
 void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
           sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_saxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_saxpy_sycl, queue, n, alpha,
+                         x, incx, y, incy);
 }
 
 void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_daxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_daxpy_sycl, queue, n, alpha,
+                         x, incx, y, incy);
 }
 
 void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_caxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_caxpy_sycl, queue, n, alpha,
+                         x, incx, y, incy);
 }
 
 void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zaxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zaxpy_sycl, queue, n, alpha,
+                         x, incx, y, incy);
 }
 
 void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                 sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_saxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex,
-                                                                  y, incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_saxpy_batch_strided_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                 sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_daxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex,
-                                                                  y, incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_daxpy_batch_strided_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<float>, 1> &y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].column_major_caxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex,
-                                                                  y, incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_caxpy_batch_strided_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<double>, 1> &y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].column_major_zaxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex,
-                                                                  y, incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zaxpy_batch_strided_sycl,
+                         queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
            sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
            std::int64_t incy) {
-    function_tables[libkey].column_major_saxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_saxpby_sycl, queue, n, alpha,
+                         x, incx, beta, y, incy);
 }
 
 void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
            sycl::buffer<double, 1> &x, std::int64_t incx, double beta, sycl::buffer<double, 1> &y,
            std::int64_t incy) {
-    function_tables[libkey].column_major_daxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_daxpby_sycl, queue, n, alpha,
+                         x, incx, beta, y, incy);
 }
 
 void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_caxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_caxpby_sycl, queue, n, alpha,
+                         x, incx, beta, y, incy);
 }
 
 void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zaxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zaxpby_sycl, queue, n, alpha,
+                         x, incx, beta, y, incy);
 }
 
 void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
           std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_scopy_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_scopy_sycl, queue, n, x, incx,
+                         y, incy);
 }
 
 void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_dcopy_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dcopy_sycl, queue, n, x, incx,
+                         y, incy);
 }
 
 void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_ccopy_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ccopy_sycl, queue, n, x, incx,
+                         y, incy);
 }
 
 void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zcopy_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zcopy_sycl, queue, n, x, incx,
+                         y, incy);
 }
 
 void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_scopy_batch_strided_sycl(queue, n, x, incx, stridex, y,
-                                                                  incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_scopy_batch_strided_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_dcopy_batch_strided_sycl(queue, n, x, incx, stridex, y,
-                                                                  incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dcopy_batch_strided_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_ccopy_batch_strided_sycl(queue, n, x, incx, stridex, y,
-                                                                  incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ccopy_batch_strided_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_zcopy_batch_strided_sycl(queue, n, x, incx, stridex, y,
-                                                                  incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zcopy_batch_strided_sycl,
+                         queue, n, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
          sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_sdot_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sdot_sycl, queue, n, x, incx,
+                         y, incy, result);
 }
 
 void dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
          std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
          sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_ddot_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ddot_sycl, queue, n, x, incx,
+                         y, incy, result);
 }
 
 void dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
          sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_dsdot_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dsdot_sycl, queue, n, x, incx,
+                         y, incy, result);
 }
 
 void dotc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &result) {
-    function_tables[libkey].column_major_cdotc_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cdotc_sycl, queue, n, x, incx,
+                         y, incy, result);
 }
 
 void dotc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &result) {
-    function_tables[libkey].column_major_zdotc_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zdotc_sycl, queue, n, x, incx,
+                         y, incy, result);
 }
 
 void dotu(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &result) {
-    function_tables[libkey].column_major_cdotu_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cdotu_sycl, queue, n, x, incx,
+                         y, incy, result);
 }
 
 void dotu(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &result) {
-    function_tables[libkey].column_major_zdotu_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zdotu_sycl, queue, n, x, incx,
+                         y, incy, result);
 }
 
 void iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_isamin_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_isamin_sycl, queue, n, x,
+                         incx, result);
 }
 
 void iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_idamin_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_idamin_sycl, queue, n, x,
+                         incx, result);
 }
 
 void iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_icamin_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_icamin_sycl, queue, n, x,
+                         incx, result);
 }
 
 void iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_izamin_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_izamin_sycl, queue, n, x,
+                         incx, result);
 }
 
 void iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_isamax_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_isamax_sycl, queue, n, x,
+                         incx, result);
 }
 
 void iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_idamax_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_idamax_sycl, queue, n, x,
+                         incx, result);
 }
 
 void iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_icamax_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_icamax_sycl, queue, n, x,
+                         incx, result);
 }
 
 void iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].column_major_izamax_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_izamax_sycl, queue, n, x,
+                         incx, result);
 }
 
 void nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_scnrm2_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_scnrm2_sycl, queue, n, x,
+                         incx, result);
 }
 
 void nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_dznrm2_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dznrm2_sycl, queue, n, x,
+                         incx, result);
 }
 
 void nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
           std::int64_t incx, sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_snrm2_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_snrm2_sycl, queue, n, x, incx,
+                         result);
 }
 
 void nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &result) {
-    function_tables[libkey].column_major_dnrm2_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dnrm2_sycl, queue, n, x, incx,
+                         result);
 }
 
 void rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
          sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, float c, float s) {
-    function_tables[libkey].column_major_srot_sycl(queue, n, x, incx, y, incy, c, s);
+    function_tables.call(libkey, &blas_function_table_t::column_major_srot_sycl, queue, n, x, incx,
+                         y, incy, c, s);
 }
 
 void rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
          sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, double c, double s) {
-    function_tables[libkey].column_major_drot_sycl(queue, n, x, incx, y, incy, c, s);
+    function_tables.call(libkey, &blas_function_table_t::column_major_drot_sycl, queue, n, x, incx,
+                         y, incy, c, s);
 }
 
 void rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy, float c, float s) {
-    function_tables[libkey].column_major_csrot_sycl(queue, n, x, incx, y, incy, c, s);
+    function_tables.call(libkey, &blas_function_table_t::column_major_csrot_sycl, queue, n, x, incx,
+                         y, incy, c, s);
 }
 
 void rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
          std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy, double c, double s) {
-    function_tables[libkey].column_major_zdrot_sycl(queue, n, x, incx, y, incy, c, s);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zdrot_sycl, queue, n, x, incx,
+                         y, incy, c, s);
 }
 
 void rotg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<float, 1> &a,
           sycl::buffer<float, 1> &b, sycl::buffer<float, 1> &c, sycl::buffer<float, 1> &s) {
-    function_tables[libkey].column_major_srotg_sycl(queue, a, b, c, s);
+    function_tables.call(libkey, &blas_function_table_t::column_major_srotg_sycl, queue, a, b, c,
+                         s);
 }
 
 void rotg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<double, 1> &a,
           sycl::buffer<double, 1> &b, sycl::buffer<double, 1> &c, sycl::buffer<double, 1> &s) {
-    function_tables[libkey].column_major_drotg_sycl(queue, a, b, c, s);
+    function_tables.call(libkey, &blas_function_table_t::column_major_drotg_sycl, queue, a, b, c,
+                         s);
 }
 
 void rotg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<std::complex<float>, 1> &a,
           sycl::buffer<std::complex<float>, 1> &b, sycl::buffer<float, 1> &c,
           sycl::buffer<std::complex<float>, 1> &s) {
-    function_tables[libkey].column_major_crotg_sycl(queue, a, b, c, s);
+    function_tables.call(libkey, &blas_function_table_t::column_major_crotg_sycl, queue, a, b, c,
+                         s);
 }
 
 void rotg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<std::complex<double>, 1> &a,
           sycl::buffer<std::complex<double>, 1> &b, sycl::buffer<double, 1> &c,
           sycl::buffer<std::complex<double>, 1> &s) {
-    function_tables[libkey].column_major_zrotg_sycl(queue, a, b, c, s);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zrotg_sycl, queue, a, b, c,
+                         s);
 }
 
 void rotm(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
           std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
           sycl::buffer<float, 1> &param) {
-    function_tables[libkey].column_major_srotm_sycl(queue, n, x, incx, y, incy, param);
+    function_tables.call(libkey, &blas_function_table_t::column_major_srotm_sycl, queue, n, x, incx,
+                         y, incy, param);
 }
 
 void rotm(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy, sycl::buffer<double, 1> &param) {
-    function_tables[libkey].column_major_drotm_sycl(queue, n, x, incx, y, incy, param);
+    function_tables.call(libkey, &blas_function_table_t::column_major_drotm_sycl, queue, n, x, incx,
+                         y, incy, param);
 }
 
 void rotmg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<float, 1> &d1,
            sycl::buffer<float, 1> &d2, sycl::buffer<float, 1> &x1, float y1,
            sycl::buffer<float, 1> &param) {
-    function_tables[libkey].column_major_srotmg_sycl(queue, d1, d2, x1, y1, param);
+    function_tables.call(libkey, &blas_function_table_t::column_major_srotmg_sycl, queue, d1, d2,
+                         x1, y1, param);
 }
 
 void rotmg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<double, 1> &d1,
            sycl::buffer<double, 1> &d2, sycl::buffer<double, 1> &x1, double y1,
            sycl::buffer<double, 1> &param) {
-    function_tables[libkey].column_major_drotmg_sycl(queue, d1, d2, x1, y1, param);
+    function_tables.call(libkey, &blas_function_table_t::column_major_drotmg_sycl, queue, d1, d2,
+                         x1, y1, param);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
           sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_sscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sscal_sycl, queue, n, alpha,
+                         x, incx);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
           sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dscal_sycl, queue, n, alpha,
+                         x, incx);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_cscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cscal_sycl, queue, n, alpha,
+                         x, incx);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_csscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_csscal_sycl, queue, n, alpha,
+                         x, incx);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_zscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zscal_sycl, queue, n, alpha,
+                         x, incx);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_zdscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zdscal_sycl, queue, n, alpha,
+                         x, incx);
 }
 
 void sdsdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float sb,
             sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
             std::int64_t incy, sycl::buffer<float, 1> &result) {
-    function_tables[libkey].column_major_sdsdot_sycl(queue, n, sb, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sdsdot_sycl, queue, n, sb, x,
+                         incx, y, incy, result);
 }
 
 void swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
           std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_sswap_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sswap_sycl, queue, n, x, incx,
+                         y, incy);
 }
 
 void swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_dswap_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dswap_sycl, queue, n, x, incx,
+                         y, incy);
 }
 
 void swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_cswap_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cswap_sycl, queue, n, x, incx,
+                         y, incy);
 }
 
 void swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zswap_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zswap_sycl, queue, n, x, incx,
+                         y, incy);
 }
 
 void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha, sycl::buffer<float, 1> &a,
           std::int64_t lda, sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_sgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sgbmv_sycl, queue, trans, m,
+                         n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha,
           sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &x,
           std::int64_t incx, double beta, sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_dgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dgbmv_sycl, queue, trans, m,
+                         n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -449,8 +507,8 @@ void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_cgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cgbmv_sycl, queue, trans, m,
+                         n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -458,40 +516,40 @@ void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zgbmv_sycl, queue, trans, m,
+                         n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
           sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_sgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sgemv_sycl, queue, trans, m,
+                         n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
           sycl::buffer<double, 1> &x, std::int64_t incx, double beta, sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_dgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dgemv_sycl, queue, trans, m,
+                         n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_cgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cgemv_sycl, queue, trans, m,
+                         n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zgemv_sycl, queue, trans, m,
+                         n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -499,9 +557,9 @@ void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                 std::int64_t stridea, sycl::buffer<float, 1> &x, std::int64_t incx,
                 std::int64_t stridex, float beta, sycl::buffer<float, 1> &y, std::int64_t incy,
                 std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].column_major_sgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                  stridea, x, incx, stridex, beta,
-                                                                  y, incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sgemv_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size);
 }
 
 void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -509,9 +567,9 @@ void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                 std::int64_t stridea, sycl::buffer<double, 1> &x, std::int64_t incx,
                 std::int64_t stridex, double beta, sycl::buffer<double, 1> &y, std::int64_t incy,
                 std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].column_major_dgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                  stridea, x, incx, stridex, beta,
-                                                                  y, incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dgemv_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size);
 }
 
 void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -520,9 +578,9 @@ void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                 std::int64_t incx, std::int64_t stridex, std::complex<float> beta,
                 sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_cgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                  stridea, x, incx, stridex, beta,
-                                                                  y, incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cgemv_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size);
 }
 
 void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -531,9 +589,9 @@ void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                 sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].column_major_zgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                  stridea, x, incx, stridex, beta,
-                                                                  y, incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zgemv_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y,
+                         incy, stridey, batch_size);
 }
 
 void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, std::int64_t m,
@@ -541,8 +599,9 @@ void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_sdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sdgmm_batch_strided_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size);
 }
 
 void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, std::int64_t m,
@@ -550,8 +609,9 @@ void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_ddgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ddgmm_batch_strided_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size);
 }
 
 void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, std::int64_t m,
@@ -559,8 +619,9 @@ void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 std::int64_t stridea, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                 std::int64_t stridex, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                 std::int64_t stridec, std::int64_t batch_size) {
-    function_tables[libkey].column_major_cdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cdgmm_batch_strided_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size);
 }
 
 void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, std::int64_t m,
@@ -568,430 +629,445 @@ void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 std::int64_t stridea, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                 std::int64_t stridex, sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
                 std::int64_t stridec, std::int64_t batch_size) {
-    function_tables[libkey].column_major_zdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zdgmm_batch_strided_sycl,
+                         queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                         stridec, batch_size);
 }
 
 void ger(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
          float alpha, sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
          std::int64_t incy, sycl::buffer<float, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_sger_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sger_sycl, queue, m, n, alpha,
+                         x, incx, y, incy, a, lda);
 }
 
 void ger(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
          double alpha, sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
          std::int64_t incy, sycl::buffer<double, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_dger_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dger_sycl, queue, m, n, alpha,
+                         x, incx, y, incy, a, lda);
 }
 
 void gerc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_cgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cgerc_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda);
 }
 
 void gerc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_zgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zgerc_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda);
 }
 
 void geru(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_cgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cgeru_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda);
 }
 
 void geru(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_zgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zgeru_sycl, queue, m, n,
+                         alpha, x, incx, y, incy, a, lda);
 }
 
 void hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_chbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_chbmv_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zhbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zhbmv_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_chemv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_chemv_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zhemv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zhemv_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void her(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_cher_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cher_sycl, queue, upper_lower,
+                         n, alpha, x, incx, a, lda);
 }
 
 void her(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_zher_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zher_sycl, queue, upper_lower,
+                         n, alpha, x, incx, a, lda);
 }
 
 void her2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_cher2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cher2_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
 void her2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_zher2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zher2_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
 void hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_chpmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta,
-                                                    y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_chpmv_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
 void hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_zhpmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta,
-                                                    y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zhpmv_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
 void hpr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1> &a) {
-    function_tables[libkey].column_major_chpr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    function_tables.call(libkey, &blas_function_table_t::column_major_chpr_sycl, queue, upper_lower,
+                         n, alpha, x, incx, a);
 }
 
 void hpr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1> &a) {
-    function_tables[libkey].column_major_zhpr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zhpr_sycl, queue, upper_lower,
+                         n, alpha, x, incx, a);
 }
 
 void hpr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a) {
-    function_tables[libkey].column_major_chpr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a);
+    function_tables.call(libkey, &blas_function_table_t::column_major_chpr2_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
 void hpr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a) {
-    function_tables[libkey].column_major_zhpr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zhpr2_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
 void sbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
           sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_ssbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ssbmv_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void sbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
           sycl::buffer<double, 1> &x, std::int64_t incx, double beta, sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].column_major_dsbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x,
-                                                    incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dsbmv_sycl, queue,
+                         upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void spmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1> &a, sycl::buffer<float, 1> &x, std::int64_t incx,
           float beta, sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_sspmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta,
-                                                    y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sspmv_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
 void spmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1> &a, sycl::buffer<double, 1> &x, std::int64_t incx,
           double beta, sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_dspmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta,
-                                                    y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dspmv_sycl, queue,
+                         upper_lower, n, alpha, a, x, incx, beta, y, incy);
 }
 
 void spr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &a) {
-    function_tables[libkey].column_major_sspr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sspr_sycl, queue, upper_lower,
+                         n, alpha, x, incx, a);
 }
 
 void spr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &a) {
-    function_tables[libkey].column_major_dspr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dspr_sycl, queue, upper_lower,
+                         n, alpha, x, incx, a);
 }
 
 void spr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
           std::int64_t incy, sycl::buffer<float, 1> &a) {
-    function_tables[libkey].column_major_sspr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sspr2_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
 void spr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy, sycl::buffer<double, 1> &a) {
-    function_tables[libkey].column_major_dspr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dspr2_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a);
 }
 
 void symv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &x,
           std::int64_t incx, float beta, sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_ssymv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ssymv_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void symv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &x,
           std::int64_t incx, double beta, sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].column_major_dsymv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                    beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dsymv_sycl, queue,
+                         upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void syr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &a,
          std::int64_t lda) {
-    function_tables[libkey].column_major_ssyr_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ssyr_sycl, queue, upper_lower,
+                         n, alpha, x, incx, a, lda);
 }
 
 void syr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &a,
          std::int64_t lda) {
-    function_tables[libkey].column_major_dsyr_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dsyr_sycl, queue, upper_lower,
+                         n, alpha, x, incx, a, lda);
 }
 
 void syr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
           std::int64_t incy, sycl::buffer<float, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_ssyr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ssyr2_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
 void syr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy, sycl::buffer<double, 1> &a, std::int64_t lda) {
-    function_tables[libkey].column_major_dsyr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy,
-                                                    a, lda);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dsyr2_sycl, queue,
+                         upper_lower, n, alpha, x, incx, y, incy, a, lda);
 }
 
 void tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<float, 1> &a,
           std::int64_t lda, sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_stbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_stbmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<double, 1> &a,
           std::int64_t lda, sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dtbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dtbmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ctbmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ztbmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<float, 1> &a,
           std::int64_t lda, sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_stbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_stbsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<double, 1> &a,
           std::int64_t lda, sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dtbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dtbsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ctbsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a,
-                                                    lda, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ztbsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1> &a, sycl::buffer<float, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].column_major_stpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_stpmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1> &a, sycl::buffer<double, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].column_major_dtpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dtpmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1> &a,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ctpmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1> &a,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ztpmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1> &a, sycl::buffer<float, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].column_major_stpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_stpsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1> &a, sycl::buffer<double, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].column_major_dtpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dtpsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1> &a,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ctpsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1> &a,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                    incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ztpsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1> &a, std::int64_t lda,
           sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_strmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_strmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1> &a, std::int64_t lda,
           sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dtrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dtrmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ctrmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ztrmv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1> &a, std::int64_t lda,
           sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_strsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_strsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1> &a, std::int64_t lda,
           sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_dtrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dtrsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ctrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ctrsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].column_major_ztrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda,
-                                                    x, incx);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ztrsv_sycl, queue,
+                         upper_lower, trans, unit_diag, n, a, lda, x, incx);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
           std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
           sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_sgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
-                                                    b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sgemm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
           std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
           sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_dgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
-                                                    b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dgemm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -999,8 +1075,8 @@ void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, tran
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_cgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
-                                                    b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cgemm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1008,32 +1084,32 @@ void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, tran
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
-                                                    b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zgemm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, sycl::half alpha,
           sycl::buffer<sycl::half, 1> &a, std::int64_t lda, sycl::buffer<sycl::half, 1> &b,
           std::int64_t ldb, sycl::half beta, sycl::buffer<sycl::half, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_hgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda,
-                                                    b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_hgemm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
           sycl::buffer<sycl::half, 1> &a, std::int64_t lda, sycl::buffer<sycl::half, 1> &b,
           std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_gemm_f16f16f32_sycl(queue, transa, transb, m, n, k, alpha,
-                                                             a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_gemm_f16f16f32_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
           std::int64_t lda, sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
           sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_gemm_bf16bf16f32_sycl(queue, transa, transb, m, n, k,
-                                                               alpha, a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_gemm_bf16bf16f32_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1041,8 +1117,8 @@ void hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_chemm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_chemm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1050,23 +1126,23 @@ void hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zhemm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zhemm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void herk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, float beta, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_cherk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cherk_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void herk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, double beta, sycl::buffer<std::complex<double>, 1> &c,
           std::int64_t ldc) {
-    function_tables[libkey].column_major_zherk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zherk_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -1074,8 +1150,8 @@ void her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, float beta,
            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_cher2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cher2k_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -1083,24 +1159,24 @@ void her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, double beta,
            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zher2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zher2k_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
           sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
           std::int64_t ldc) {
-    function_tables[libkey].column_major_ssymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ssymm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1> &a,
           std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
           sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_dsymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dsymm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1108,8 +1184,8 @@ void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_csymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_csymm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1117,56 +1193,56 @@ void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zsymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                    lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zsymm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
           float beta, sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_ssyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ssyrk_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
           std::int64_t lda, double beta, sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_dsyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dsyrk_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_csyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_csyrk_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zsyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                    beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zsyrk_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                 std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
                 std::int64_t lda, std::int64_t stride_a, float beta, sycl::buffer<float, 1> &c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_ssyrk_batch_strided_sycl(queue, upper_lower, trans, n, k,
-                                                                  alpha, a, lda, stride_a, beta, c,
-                                                                  ldc, stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ssyrk_batch_strided_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size);
 }
 
 void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                 std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
                 std::int64_t lda, std::int64_t stride_a, double beta, sycl::buffer<double, 1> &c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_dsyrk_batch_strided_sycl(queue, upper_lower, trans, n, k,
-                                                                  alpha, a, lda, stride_a, beta, c,
-                                                                  ldc, stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dsyrk_batch_strided_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size);
 }
 
 void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -1174,9 +1250,9 @@ void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower
                 sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_csyrk_batch_strided_sycl(queue, upper_lower, trans, n, k,
-                                                                  alpha, a, lda, stride_a, beta, c,
-                                                                  ldc, stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_csyrk_batch_strided_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size);
 }
 
 void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -1184,25 +1260,25 @@ void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower
                 sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_zsyrk_batch_strided_sycl(queue, upper_lower, trans, n, k,
-                                                                  alpha, a, lda, stride_a, beta, c,
-                                                                  ldc, stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zsyrk_batch_strided_sycl,
+                         queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc,
+                         stride_c, batch_size);
 }
 
 void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
            sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
            std::int64_t ldc) {
-    function_tables[libkey].column_major_ssyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ssyr2k_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
            std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
            sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_dsyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dsyr2k_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -1210,8 +1286,8 @@ void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_csyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_csyr2k_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -1219,72 +1295,72 @@ void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zsyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                     b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zsyr2k_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].column_major_strmm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_strmm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].column_major_dtrmm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dtrmm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_ctrmm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ctrmm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_ztrmm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ztrmm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].column_major_strsm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_strsm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].column_major_dtrsm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dtrsm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_ctrsm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ctrsm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_ztrsm_sycl(queue, left_right, upper_lower, trans,
-                                                    unit_diag, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ztrsm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1293,9 +1369,9 @@ void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa
                 sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_sgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sgemm_batch_strided_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1304,9 +1380,9 @@ void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa
                 sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b, double beta,
                 sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_dgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dgemm_batch_strided_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1315,9 +1391,9 @@ void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa
                 sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_cgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cgemm_batch_strided_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1326,9 +1402,9 @@ void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa
                 sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_zgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zgemm_batch_strided_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1337,9 +1413,9 @@ void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa
                 sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 sycl::half beta, sycl::buffer<sycl::half, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_hgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_hgemm_batch_strided_sycl,
+                         queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, batch_size);
 }
 
 void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1347,9 +1423,9 @@ void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_strsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_strsm_batch_strided_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1357,9 +1433,9 @@ void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
-    function_tables[libkey].column_major_dtrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dtrsm_batch_strided_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1367,9 +1443,9 @@ void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<float>, 1> &b,
                 std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].column_major_ctrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ctrsm_batch_strided_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -1377,25 +1453,25 @@ void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<double>, 1> &b,
                 std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].column_major_ztrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_ztrsm_batch_strided_sycl,
+                         queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                         stride_a, b, ldb, stride_b, batch_size);
 }
 
 void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
            std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
            sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_sgemmt_sycl(queue, upper_lower, transa, transb, n, k,
-                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_sgemmt_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, double alpha,
            sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
            std::int64_t ldb, double beta, sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_dgemmt_sycl(queue, upper_lower, transa, transb, n, k,
-                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dgemmt_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose transa,
@@ -1403,8 +1479,8 @@ void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_cgemmt_sycl(queue, upper_lower, transa, transb, n, k,
-                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cgemmt_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose transa,
@@ -1412,8 +1488,8 @@ void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zgemmt_sycl(queue, upper_lower, transa, transb, n, k,
-                                                     alpha, a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zgemmt_sycl, queue,
+                         upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1421,8 +1497,9 @@ void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao, sycl::buffer<uint8_t, 1> &b,
                std::int64_t ldb, uint8_t bo, float beta, sycl::buffer<int32_t, 1> &c,
                std::int64_t ldc, sycl::buffer<int32_t, 1> &co) {
-    function_tables[libkey].column_major_gemm_s8u8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    function_tables.call(libkey, &blas_function_table_t::column_major_gemm_s8u8s32_bias_sycl, queue,
+                         transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c,
+                         ldc, co);
 }
 
 void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1430,8 +1507,9 @@ void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao, sycl::buffer<int8_t, 1> &b,
                std::int64_t ldb, int8_t bo, float beta, sycl::buffer<int32_t, 1> &c,
                std::int64_t ldc, sycl::buffer<int32_t, 1> &co) {
-    function_tables[libkey].column_major_gemm_s8s8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    function_tables.call(libkey, &blas_function_table_t::column_major_gemm_s8s8s32_bias_sycl, queue,
+                         transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c,
+                         ldc, co);
 }
 
 void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1439,8 +1517,9 @@ void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
                sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
                sycl::buffer<int32_t, 1> &c, std::int64_t ldc, sycl::buffer<int32_t, 1> &co) {
-    function_tables[libkey].column_major_gemm_u8s8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    function_tables.call(libkey, &blas_function_table_t::column_major_gemm_u8s8s32_bias_sycl, queue,
+                         transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c,
+                         ldc, co);
 }
 
 void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1448,24 +1527,25 @@ void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
                sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
                sycl::buffer<int32_t, 1> &c, std::int64_t ldc, sycl::buffer<int32_t, 1> &co) {
-    function_tables[libkey].column_major_gemm_u8u8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    function_tables.call(libkey, &blas_function_table_t::column_major_gemm_u8u8s32_bias_sycl, queue,
+                         transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c,
+                         ldc, co);
 }
 
 void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<float, 1> &b, std::int64_t ldb,
                     std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].column_major_somatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_somatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<double, 1> &b, std::int64_t ldb,
                     std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].column_major_domatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_domatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -1473,8 +1553,8 @@ void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tr
                     sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<std::complex<float>, 1> &b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].column_major_comatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_comatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -1482,38 +1562,38 @@ void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tr
                     sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<std::complex<double>, 1> &b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].column_major_zomatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zomatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, float alpha, sycl::buffer<float, 1> &ab, std::int64_t lda,
                     std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
-    function_tables[libkey].column_major_simatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab,
-                                                                      lda, ldb, stride, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_simatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, double alpha, sycl::buffer<double, 1> &ab, std::int64_t lda,
                     std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
-    function_tables[libkey].column_major_dimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab,
-                                                                      lda, ldb, stride, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dimatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, std::complex<float> alpha,
                     sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda, std::int64_t ldb,
                     std::int64_t stride, std::int64_t batch_size) {
-    function_tables[libkey].column_major_cimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab,
-                                                                      lda, ldb, stride, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cimatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, std::complex<double> alpha,
                     sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda, std::int64_t ldb,
                     std::int64_t stride, std::int64_t batch_size) {
-    function_tables[libkey].column_major_zimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab,
-                                                                      lda, ldb, stride, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zimatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -1522,9 +1602,9 @@ void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tra
                    sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                    sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                    std::int64_t batch_size) {
-    function_tables[libkey].column_major_somatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_somatadd_batch_strided_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -1533,9 +1613,9 @@ void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tra
                    sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                    sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                    std::int64_t batch_size) {
-    function_tables[libkey].column_major_domatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_domatadd_batch_strided_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -1544,9 +1624,9 @@ void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tra
                    std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &b,
                    std::int64_t ldb, std::int64_t stride_b, sycl::buffer<std::complex<float>, 1> &c,
                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_comatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_comatadd_batch_strided_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -1556,73 +1636,81 @@ void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tra
                    sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                    std::int64_t stride_b, sycl::buffer<std::complex<double>, 1> &c,
                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].column_major_zomatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zomatadd_batch_strided_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size);
 }
 
 void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
               sycl::buffer<float, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_somatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_somatcopy_sycl, queue, trans,
+                         m, n, alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
               sycl::buffer<double, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_domatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_domatcopy_sycl, queue, trans,
+                         m, n, alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
               std::int64_t lda, sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_comatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_comatcopy_sycl, queue, trans,
+                         m, n, alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
               std::int64_t lda, sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].column_major_zomatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zomatcopy_sycl, queue, trans,
+                         m, n, alpha, a, lda, b, ldb);
 }
 
 void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, float alpha, sycl::buffer<float, 1> &ab, std::int64_t lda,
               std::int64_t ldb) {
-    function_tables[libkey].column_major_simatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_simatcopy_sycl, queue, trans,
+                         m, n, alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, double alpha, sycl::buffer<double, 1> &ab, std::int64_t lda,
               std::int64_t ldb) {
-    function_tables[libkey].column_major_dimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_dimatcopy_sycl, queue, trans,
+                         m, n, alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &ab,
               std::int64_t lda, std::int64_t ldb) {
-    function_tables[libkey].column_major_cimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_cimatcopy_sycl, queue, trans,
+                         m, n, alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &ab,
               std::int64_t lda, std::int64_t ldb) {
-    function_tables[libkey].column_major_zimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zimatcopy_sycl, queue, trans,
+                         m, n, alpha, ab, lda, ldb);
 }
 
 void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
              std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1> &a,
              std::int64_t lda, float beta, sycl::buffer<float, 1> &b, std::int64_t ldb,
              sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_somatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                       beta, b, ldb, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_somatadd_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
              std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1> &a,
              std::int64_t lda, double beta, sycl::buffer<double, 1> &b, std::int64_t ldb,
              sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_domatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                       beta, b, ldb, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_domatadd_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1630,8 +1718,8 @@ void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, t
              sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::complex<float> beta,
              sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
              sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_comatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                       beta, b, ldb, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_comatadd_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -1639,8 +1727,8 @@ void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, t
              sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::complex<double> beta,
              sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
              sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].column_major_zomatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                       beta, b, ldb, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::column_major_zomatadd_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 // USM APIs
@@ -1648,73 +1736,77 @@ void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, t
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<float> *x, std::int64_t incx, float *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_scasum_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_scasum_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<double> *x, std::int64_t incx, double *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dzasum_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dzasum_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                  std::int64_t incx, float *result, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sasum_usm_sycl(queue, n, x, incx, result,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sasum_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                  std::int64_t incx, double *result, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dasum_usm_sycl(queue, n, x, incx, result,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dasum_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                  const float *x, std::int64_t incx, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_saxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_saxpy_usm_sycl, queue,
+                                n, alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                  const double *x, std::int64_t incx, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_daxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_daxpy_usm_sycl, queue,
+                                n, alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                  std::complex<float> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_caxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_caxpy_usm_sycl, queue,
+                                n, alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                  std::complex<double> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zaxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zaxpy_usm_sycl, queue,
+                                n, alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        float *alpha, const float **x, std::int64_t *incx, float **y,
                        std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_saxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_saxpy_batch_group_usm_sycl,
+                                queue, n, alpha, x, incx, y, incy, group_count, group_size,
+                                dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        double *alpha, const double **x, std::int64_t *incx, double **y,
                        std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_daxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_daxpy_batch_group_usm_sycl,
+                                queue, n, alpha, x, incx, y, incy, group_count, group_size,
+                                dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
@@ -1722,8 +1814,10 @@ sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int6
                        std::int64_t *incx, std::complex<float> **y, std::int64_t *incy,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_caxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_caxpy_batch_group_usm_sycl,
+                                queue, n, alpha, x, incx, y, incy, group_count, group_size,
+                                dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
@@ -1731,24 +1825,30 @@ sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int6
                        std::int64_t *incx, std::complex<double> **y, std::int64_t *incy,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zaxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zaxpy_batch_group_usm_sycl,
+                                queue, n, alpha, x, incx, y, incy, group_count, group_size,
+                                dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                        const float *x, std::int64_t incx, std::int64_t stridex, float *y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_saxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_saxpy_batch_strided_usm_sycl,
+                                queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                        const double *x, std::int64_t incx, std::int64_t stridex, double *y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_daxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_daxpy_batch_strided_usm_sycl,
+                                queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
@@ -1756,8 +1856,10 @@ sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int6
                        std::int64_t stridex, std::complex<float> *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_caxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_caxpy_batch_strided_usm_sycl,
+                                queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
@@ -1765,434 +1867,454 @@ sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int6
                        std::int64_t stridex, std::complex<double> *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zaxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zaxpy_batch_strided_usm_sycl,
+                                queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                   const float *x, std::int64_t incx, const float beta, float *y, std::int64_t incy,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_saxpby_usm_sycl(queue, n, alpha, x, incx, beta, y,
-                                                                incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_saxpby_usm_sycl, queue,
+                                n, alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                   const double *x, std::int64_t incx, const double beta, double *y,
                   std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_daxpby_usm_sycl(queue, n, alpha, x, incx, beta, y,
-                                                                incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_daxpby_usm_sycl, queue,
+                                n, alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                   const std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_caxpby_usm_sycl(queue, n, alpha, x, incx, beta, y,
-                                                                incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_caxpby_usm_sycl, queue,
+                                n, alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                   const std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zaxpby_usm_sycl(queue, n, alpha, x, incx, beta, y,
-                                                                incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zaxpby_usm_sycl, queue,
+                                n, alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                  std::int64_t incx, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_scopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_scopy_usm_sycl, queue,
+                                n, x, incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                  std::int64_t incx, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dcopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dcopy_usm_sycl, queue,
+                                n, x, incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ccopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ccopy_usm_sycl, queue,
+                                n, x, incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zcopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zcopy_usm_sycl, queue,
+                                n, x, incx, y, incy, dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        const float **x, std::int64_t *incx, float **y, std::int64_t *incy,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_scopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_scopy_batch_group_usm_sycl,
+                                queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        const double **x, std::int64_t *incx, double **y, std::int64_t *incy,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dcopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dcopy_batch_group_usm_sycl,
+                                queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        const std::complex<float> **x, std::int64_t *incx, std::complex<float> **y,
                        std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ccopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_ccopy_batch_group_usm_sycl,
+                                queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        const std::complex<double> **x, std::int64_t *incx, std::complex<double> **y,
                        std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zcopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zcopy_batch_group_usm_sycl,
+                                queue, n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                        const float *x, std::int64_t incx, std::int64_t stridex, float *y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_scopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_scopy_batch_strided_usm_sycl,
+                                queue, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                        const double *x, std::int64_t incx, std::int64_t stridex, double *y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dcopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dcopy_batch_strided_usm_sycl,
+                                queue, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                        const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
                        std::complex<float> *y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ccopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_ccopy_batch_strided_usm_sycl,
+                                queue, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                        const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
                        std::complex<double> *y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zcopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zcopy_batch_strided_usm_sycl,
+                                queue, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                 std::int64_t incx, const float *y, std::int64_t incy, float *result,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sdot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                              dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sdot_usm_sycl, queue,
+                                n, x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                 std::int64_t incx, const double *y, std::int64_t incy, double *result,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ddot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                              dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ddot_usm_sycl, queue,
+                                n, x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                 std::int64_t incx, const float *y, std::int64_t incy, double *result,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsdot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dsdot_usm_sycl, queue,
+                                n, x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dotc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
                  std::int64_t incy, std::complex<float> *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cdotc_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cdotc_usm_sycl, queue,
+                                n, x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dotc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<double> *x, std::int64_t incx, const std::complex<double> *y,
                  std::int64_t incy, std::complex<double> *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zdotc_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zdotc_usm_sycl, queue,
+                                n, x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dotu(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
                  std::int64_t incy, std::complex<float> *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cdotu_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cdotu_usm_sycl, queue,
+                                n, x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dotu(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<double> *x, std::int64_t incx, const std::complex<double> *y,
                  std::int64_t incy, std::complex<double> *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zdotu_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zdotu_usm_sycl, queue,
+                                n, x, incx, y, incy, result, dependencies);
 }
 
 sycl::event iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                   std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_isamin_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_isamin_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                   std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_idamin_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_idamin_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   const std::complex<float> *x, std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_icamin_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_icamin_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   const std::complex<double> *x, std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_izamin_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_izamin_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                   std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_isamax_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_isamax_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                   std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_idamax_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_idamax_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   const std::complex<float> *x, std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_icamax_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_icamax_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   const std::complex<double> *x, std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_izamax_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_izamax_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<float> *x, std::int64_t incx, float *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_scnrm2_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_scnrm2_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<double> *x, std::int64_t incx, double *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dznrm2_usm_sycl(queue, n, x, incx, result,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dznrm2_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                  std::int64_t incx, float *result, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_snrm2_usm_sycl(queue, n, x, incx, result,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_snrm2_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                  std::int64_t incx, double *result, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dnrm2_usm_sycl(queue, n, x, incx, result,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dnrm2_usm_sycl, queue,
+                                n, x, incx, result, dependencies);
 }
 
 sycl::event rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                 std::int64_t incy, float c, float s, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_srot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                              dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_srot_usm_sycl, queue,
+                                n, x, incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                 std::int64_t incy, double c, double s,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_drot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                              dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_drot_usm_sycl, queue,
+                                n, x, incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float *x,
                 std::int64_t incx, float *y, std::int64_t incy, float c, float s,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csrot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_csrot_usm_sycl, queue,
+                                n, x, incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double *x,
                 std::int64_t incx, double *y, std::int64_t incy, double c, double s,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zdrot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zdrot_usm_sycl, queue,
+                                n, x, incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::mkl::device libkey, sycl::queue &queue, float *a, float *b, float *c,
                  float *s, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_srotg_usm_sycl(queue, a, b, c, s, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_srotg_usm_sycl, queue,
+                                a, b, c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::mkl::device libkey, sycl::queue &queue, double *a, double *b, double *c,
                  double *s, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_drotg_usm_sycl(queue, a, b, c, s, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_drotg_usm_sycl, queue,
+                                a, b, c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::mkl::device libkey, sycl::queue &queue, std::complex<float> *a,
                  std::complex<float> *b, float *c, std::complex<float> *s,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_crotg_usm_sycl(queue, a, b, c, s, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_crotg_usm_sycl, queue,
+                                a, b, c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::mkl::device libkey, sycl::queue &queue, std::complex<double> *a,
                  std::complex<double> *b, double *c, std::complex<double> *s,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zrotg_usm_sycl(queue, a, b, c, s, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zrotg_usm_sycl, queue,
+                                a, b, c, s, dependencies);
 }
 
 sycl::event rotm(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float *x,
                  std::int64_t incx, float *y, std::int64_t incy, float *param,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_srotm_usm_sycl(queue, n, x, incx, y, incy, param,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_srotm_usm_sycl, queue,
+                                n, x, incx, y, incy, param, dependencies);
 }
 
 sycl::event rotm(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double *x,
                  std::int64_t incx, double *y, std::int64_t incy, double *param,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_drotm_usm_sycl(queue, n, x, incx, y, incy, param,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_drotm_usm_sycl, queue,
+                                n, x, incx, y, incy, param, dependencies);
 }
 
 sycl::event rotmg(oneapi::mkl::device libkey, sycl::queue &queue, float *d1, float *d2, float *x1,
                   float y1, float *param, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_srotmg_usm_sycl(queue, d1, d2, x1, y1, param,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_srotmg_usm_sycl, queue,
+                                d1, d2, x1, y1, param, dependencies);
 }
 
 sycl::event rotmg(oneapi::mkl::device libkey, sycl::queue &queue, double *d1, double *d2,
                   double *x1, double y1, double *param,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_drotmg_usm_sycl(queue, d1, d2, x1, y1, param,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_drotmg_usm_sycl, queue,
+                                d1, d2, x1, y1, param, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                  float *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sscal_usm_sycl(queue, n, alpha, x, incx,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sscal_usm_sycl, queue,
+                                n, alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                  double *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dscal_usm_sycl(queue, n, alpha, x, incx,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dscal_usm_sycl, queue,
+                                n, alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<float> alpha, std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cscal_usm_sycl(queue, n, alpha, x, incx,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cscal_usm_sycl, queue,
+                                n, alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<double> alpha, std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_csscal_usm_sycl, queue,
+                                n, alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                  std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zscal_usm_sycl(queue, n, alpha, x, incx,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zscal_usm_sycl, queue,
+                                n, alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                  std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zdscal_usm_sycl(queue, n, alpha, x, incx,
-                                                                dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zdscal_usm_sycl, queue,
+                                n, alpha, x, incx, dependencies);
 }
 
 sycl::event sdsdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float sb,
                    const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                    float *result, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sdsdot_usm_sycl(queue, n, sb, x, incx, y, incy,
-                                                                result, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sdsdot_usm_sycl, queue,
+                                n, sb, x, incx, y, incy, result, dependencies);
 }
 
 sycl::event swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float *x,
                  std::int64_t incx, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sswap_usm_sycl, queue,
+                                n, x, incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double *x,
                  std::int64_t incx, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dswap_usm_sycl, queue,
+                                n, x, incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cswap_usm_sycl, queue,
+                                n, x, incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                               dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zswap_usm_sycl, queue,
+                                n, x, incx, y, incy, dependencies);
 }
 
 sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                  std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha, const float *a,
                  std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sgbmv_usm_sycl, queue,
+                                trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                  std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha, const double *a,
                  std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dgbmv_usm_sycl, queue,
+                                trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -2200,8 +2322,9 @@ sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  const std::complex<float> *a, std::int64_t lda, const std::complex<float> *x,
                  std::int64_t incx, std::complex<float> beta, std::complex<float> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cgbmv_usm_sycl, queue,
+                                trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -2209,24 +2332,25 @@ sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  const std::complex<double> *a, std::int64_t lda, const std::complex<double> *x,
                  std::int64_t incx, std::complex<double> beta, std::complex<double> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zgbmv_usm_sycl, queue,
+                                trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                  std::int64_t n, float alpha, const float *a, std::int64_t lda, const float *x,
                  std::int64_t incx, float beta, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sgemv_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                  std::int64_t n, double alpha, const double *a, std::int64_t lda, const double *x,
                  std::int64_t incx, double beta, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dgemv_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -2234,8 +2358,8 @@ sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
                  std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cgemv_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -2243,8 +2367,8 @@ sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
                  std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                               incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zgemv_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -2253,9 +2377,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t stridex, float beta, float *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_sgemv_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -2264,9 +2389,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t stridex, double beta, double *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dgemv_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -2276,9 +2402,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_cgemv_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -2288,9 +2415,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zgemv_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *trans,
@@ -2298,9 +2426,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t *lda, const float **x, std::int64_t *incx, float *beta,
                        float **y, std::int64_t *incy, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_sgemv_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *trans,
@@ -2308,9 +2437,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t *lda, const double **x, std::int64_t *incx, double *beta,
                        double **y, std::int64_t *incy, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dgemv_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *trans,
@@ -2319,9 +2449,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        const std::complex<float> **x, std::int64_t *incx, std::complex<float> *beta,
                        std::complex<float> **y, std::int64_t *incy, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_cgemv_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *trans,
@@ -2331,9 +2462,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::complex<double> *beta, std::complex<double> **y, std::int64_t *incy,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zgemv_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -2341,9 +2473,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t stridea, const float *x, std::int64_t incx,
                        std::int64_t stridex, float *c, std::int64_t ldc, std::int64_t stridec,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_sdgmm_batch_strided_usm_sycl,
+                                queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -2351,9 +2484,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t stridea, const double *x, std::int64_t incx,
                        std::int64_t stridex, double *c, std::int64_t ldc, std::int64_t stridec,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ddgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_ddgmm_batch_strided_usm_sycl,
+                                queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -2362,9 +2496,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t incx, std::int64_t stridex, std::complex<float> *c,
                        std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_cdgmm_batch_strided_usm_sycl,
+                                queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -2373,9 +2508,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t incx, std::int64_t stridex, std::complex<double> *c,
                        std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zdgmm_batch_strided_usm_sycl,
+                                queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -2383,8 +2519,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        const float **x, std::int64_t *incx, float **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_sdgmm_batch_group_usm_sycl,
+                                queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -2392,8 +2530,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        const double **x, std::int64_t *incx, double **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ddgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_ddgmm_batch_group_usm_sycl,
+                                queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -2401,8 +2541,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *lda, const std::complex<float> **x, std::int64_t *incx,
                        std::complex<float> **c, std::int64_t *ldc, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_cdgmm_batch_group_usm_sycl,
+                                queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -2410,55 +2552,57 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *lda, const std::complex<double> **x, std::int64_t *incx,
                        std::complex<double> **c, std::int64_t *ldc, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zdgmm_batch_group_usm_sycl,
+                                queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event ger(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                 float alpha, const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                 float *a, std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sger_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                              a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sger_usm_sycl, queue,
+                                m, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event ger(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                 double alpha, const double *x, std::int64_t incx, const double *y,
                 std::int64_t incy, double *a, std::int64_t lda,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dger_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                              a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dger_usm_sycl, queue,
+                                m, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event gerc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                  const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgerc_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cgerc_usm_sycl, queue,
+                                m, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event gerc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                  const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgerc_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zgerc_usm_sycl, queue,
+                                m, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event geru(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                  const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgeru_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cgeru_usm_sycl, queue,
+                                m, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event geru(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                  const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgeru_usm_sycl(queue, m, n, alpha, x, incx, y, incy,
-                                                               a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zgeru_usm_sycl, queue,
+                                m, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -2466,8 +2610,9 @@ sycl::event hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
                  std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_chbmv_usm_sycl, queue,
+                                upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -2475,8 +2620,9 @@ sycl::event hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
                  std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zhbmv_usm_sycl, queue,
+                                upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -2484,8 +2630,9 @@ sycl::event hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
                  std::complex<float> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chemv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_chemv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -2493,40 +2640,41 @@ sycl::event hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
                  std::complex<double> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhemv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zhemv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event her(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 float alpha, const std::complex<float> *x, std::int64_t incx,
                 std::complex<float> *a, std::int64_t lda,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cher_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cher_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event her(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 double alpha, const std::complex<double> *x, std::int64_t incx,
                 std::complex<double> *a, std::int64_t lda,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zher_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zher_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event her2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                  const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cher2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cher2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event her2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                  const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zher2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zher2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -2534,8 +2682,8 @@ sycl::event hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
                  std::complex<float> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chpmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_chpmv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -2543,337 +2691,343 @@ sycl::event hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
                  std::complex<double> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhpmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zhpmv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hpr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 float alpha, const std::complex<float> *x, std::int64_t incx,
                 std::complex<float> *a, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chpr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_chpr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event hpr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 double alpha, const std::complex<double> *x, std::int64_t incx,
                 std::complex<double> *a, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhpr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zhpr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event hpr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                  const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chpr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_chpr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event hpr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                  const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhpr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zhpr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event sbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *x,
                  std::int64_t incx, float beta, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ssbmv_usm_sycl, queue,
+                                upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event sbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::int64_t k, double alpha, const double *a, std::int64_t lda, const double *x,
                  std::int64_t incx, double beta, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsbmv_usm_sycl(
-        queue, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dsbmv_usm_sycl, queue,
+                                upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event spmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float *a, const float *x, std::int64_t incx, float beta,
                  float *y, std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sspmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sspmv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event spmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double *a, const double *x, std::int64_t incx, double beta,
                  double *y, std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dspmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                               incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dspmv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event spr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 float alpha, const float *x, std::int64_t incx, float *a,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sspr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sspr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event spr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 double alpha, const double *x, std::int64_t incx, double *a,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dspr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dspr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event spr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                  float *a, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sspr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sspr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event spr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double *x, std::int64_t incx, const double *y,
                  std::int64_t incy, double *a, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dspr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dspr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event symv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float *a, std::int64_t lda, const float *x, std::int64_t incx,
                  float beta, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssymv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ssymv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event symv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double *a, std::int64_t lda, const double *x,
                  std::int64_t incx, double beta, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsymv_usm_sycl(
-        queue, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dsymv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event syr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 float alpha, const float *x, std::int64_t incx, float *a, std::int64_t lda,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssyr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ssyr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event syr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 double alpha, const double *x, std::int64_t incx, double *a, std::int64_t lda,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsyr_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                              a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dsyr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event syr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                  float *a, std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssyr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ssyr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event syr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double *x, std::int64_t incx, const double *y,
                  std::int64_t incy, double *a, std::int64_t lda,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsyr2_usm_sycl(queue, upper_lower, n, alpha, x,
-                                                               incx, y, incy, a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dsyr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const float *a, std::int64_t lda,
                  float *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_stbmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_stbmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const double *a, std::int64_t lda,
                  double *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtbmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dtbmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<float> *a,
                  std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctbmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ctbmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<double> *a,
                  std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztbmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ztbmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const float *a, std::int64_t lda,
                  float *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_stbsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_stbsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const double *a, std::int64_t lda,
                  double *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtbsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dtbsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<float> *a,
                  std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctbsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ctbsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<double> *a,
                  std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztbsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ztbsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float *a, float *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_stpmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_stpmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double *a, double *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtpmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dtpmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float> *a,
                  std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctpmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ctpmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double> *a,
                  std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztpmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ztpmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float *a, float *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_stpsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_stpsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double *a, double *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtpsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dtpsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float> *a,
                  std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctpsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ctpsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double> *a,
                  std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztpsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ztpsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float *a, std::int64_t lda, float *x,
                  std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_strmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_strmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double *a, std::int64_t lda, double *x,
                  std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtrmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dtrmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float> *a, std::int64_t lda,
                  std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctrmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ctrmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double> *a, std::int64_t lda,
                  std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztrmv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ztrmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float *a, std::int64_t lda, float *x,
                  std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_strsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_strsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double *a, std::int64_t lda, double *x,
                  std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtrsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dtrsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float> *a, std::int64_t lda,
                  std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctrsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ctrsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double> *a, std::int64_t lda,
                  std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztrsv_usm_sycl(queue, upper_lower, trans, unit_diag,
-                                                               n, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ztrsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
                  std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sgemm_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
                  std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dgemm_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -2881,8 +3035,9 @@ sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cgemm_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -2890,8 +3045,9 @@ sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zgemm_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -2899,24 +3055,29 @@ sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  const sycl::half *a, std::int64_t lda, const sycl::half *b, std::int64_t ldb,
                  sycl::half beta, sycl::half *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_hgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_hgemm_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const sycl::half *a,
                  std::int64_t lda, const sycl::half *b, std::int64_t ldb, float beta, float *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_gemm_f16f16f32_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_gemm_f16f16f32_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const bfloat16 *a,
                  std::int64_t lda, const bfloat16 *b, std::int64_t ldb, float beta, float *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_gemm_bf16bf16f32_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_gemm_bf16bf16f32_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -2924,8 +3085,9 @@ sycl::event hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_chemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_chemm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -2933,24 +3095,27 @@ sycl::event hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zhemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zhemm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event herk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, float alpha, const std::complex<float> *a,
                  std::int64_t lda, float beta, std::complex<float> *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cherk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cherk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event herk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, double alpha, const std::complex<double> *a,
                  std::int64_t lda, double beta, std::complex<double> *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zherk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zherk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -2958,8 +3123,9 @@ sycl::event her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                   std::int64_t ldb, float beta, std::complex<float> *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cher2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -2967,24 +3133,27 @@ sycl::event her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
                   std::int64_t ldb, double beta, std::complex<double> *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zher2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
                  const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ssymm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
                  const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dsymm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -2992,8 +3161,9 @@ sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_csymm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -3001,24 +3171,27 @@ sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zsymm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
                  float beta, float *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ssyrk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
                  double beta, double *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dsyrk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -3026,8 +3199,9 @@ sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<float> *a, std::int64_t lda, std::complex<float> beta,
                  std::complex<float> *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_csyrk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -3035,8 +3209,9 @@ sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<double> *a, std::int64_t lda, std::complex<double> beta,
                  std::complex<double> *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zsyrk_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zsyrk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upper_lower,
@@ -3044,9 +3219,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upp
                        const float **a, std::int64_t *lda, float *beta, float **c,
                        std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_ssyrk_batch_group_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upper_lower,
@@ -3054,9 +3230,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upp
                        const double **a, std::int64_t *lda, double *beta, double **c,
                        std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dsyrk_batch_group_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upper_lower,
@@ -3065,9 +3242,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upp
                        std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_csyrk_batch_group_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upper_lower,
@@ -3076,9 +3254,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upp
                        std::int64_t *lda, std::complex<double> *beta, std::complex<double> **c,
                        std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zsyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zsyrk_batch_group_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -3086,9 +3265,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo uppe
                        std::int64_t lda, std::int64_t stride_a, float beta, float *c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_ssyrk_batch_strided_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -3096,9 +3276,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo uppe
                        const double *a, std::int64_t lda, std::int64_t stride_a, double beta,
                        double *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dsyrk_batch_strided_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -3107,9 +3288,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo uppe
                        std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_csyrk_batch_strided_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -3118,25 +3300,28 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo uppe
                        std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zsyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zsyrk_batch_strided_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                   std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
                   const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ssyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ssyr2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                   std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
                   const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dsyr2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -3144,8 +3329,9 @@ sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                   std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                   std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_csyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_csyr2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -3153,26 +3339,27 @@ sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
                   std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                   std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zsyr2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                  const float *a, std::int64_t lda, float *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_strmm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_strmm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
                  const double *a, std::int64_t lda, double *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtrmm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dtrmm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -3180,9 +3367,9 @@ sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
                  std::complex<float> *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctrmm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ctrmm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -3190,27 +3377,27 @@ sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
                  std::complex<double> *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztrmm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ztrmm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                  const float *a, std::int64_t lda, float *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_strsm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_strsm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
                  const double *a, std::int64_t lda, double *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtrsm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dtrsm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -3218,9 +3405,9 @@ sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
                  std::complex<float> *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctrsm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ctrsm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -3228,9 +3415,9 @@ sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
                  std::complex<double> *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztrsm_usm_sycl(queue, left_right, upper_lower,
-                                                               trans, unit_diag, m, n, alpha, a,
-                                                               lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_ztrsm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -3238,9 +3425,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t n, float alpha, const float *a, std::int64_t lda,
                        std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_strsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_strsm_batch_strided_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -3248,9 +3436,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t n, double alpha, const double *a, std::int64_t lda,
                        std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dtrsm_batch_strided_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -3259,9 +3448,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t lda, std::int64_t stride_a, std::complex<float> *b,
                        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_ctrsm_batch_strided_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -3270,9 +3460,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t lda, std::int64_t stride_a, std::complex<double> *b,
                        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_ztrsm_batch_strided_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -3280,9 +3471,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *n, float *alpha, const float **a, std::int64_t *lda, float **b,
                        std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_strsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_strsm_batch_group_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, b, ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -3290,9 +3482,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *n, double *alpha, const double **a, std::int64_t *lda,
                        double **b, std::int64_t *ldb, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dtrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dtrsm_batch_group_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, b, ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -3301,9 +3494,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ctrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_ctrsm_batch_group_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, b, ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -3312,9 +3506,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_ztrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_ztrsm_batch_group_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, b, ldb, group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *transa,
@@ -3323,9 +3518,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t *ldb, float *beta, float **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_sgemm_batch_group_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *transa,
@@ -3334,9 +3530,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t *ldb, double *beta, double **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dgemm_batch_group_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *transa,
@@ -3345,9 +3542,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        const std::complex<float> **b, std::int64_t *ldb, std::complex<float> *beta,
                        std::complex<float> **c, std::int64_t *ldc, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_cgemm_batch_group_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *transa,
@@ -3357,9 +3555,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::complex<double> *beta, std::complex<double> **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zgemm_batch_group_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *transa,
@@ -3368,9 +3567,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        const sycl::half **b, std::int64_t *ldb, sycl::half *beta, sycl::half **c,
                        std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_hgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_hgemm_batch_group_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3379,9 +3579,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        const float *b, std::int64_t ldb, std::int64_t stride_b, float beta,
                        float *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_sgemm_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3390,9 +3591,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        const double *b, std::int64_t ldb, std::int64_t stride_b, double beta,
                        double *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dgemm_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3402,9 +3604,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t stride_b, std::complex<float> beta, std::complex<float> *c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_cgemm_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3414,9 +3617,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t stride_b, std::complex<double> beta, std::complex<double> *c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zgemm_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3426,27 +3630,28 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t stride_b, sycl::half beta, sycl::half *c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_hgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_hgemm_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
                   transpose transa, transpose transb, std::int64_t n, std::int64_t k, float alpha,
                   const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta,
                   float *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_sgemmt_usm_sycl(queue, upper_lower, transa, transb,
-                                                                n, k, alpha, a, lda, b, ldb, beta,
-                                                                c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_sgemmt_usm_sycl, queue,
+                                upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, dependencies);
 }
 
 sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
                   transpose transa, transpose transb, std::int64_t n, std::int64_t k, double alpha,
                   const double *a, std::int64_t lda, const double *b, std::int64_t ldb, double beta,
                   double *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dgemmt_usm_sycl(queue, upper_lower, transa, transb,
-                                                                n, k, alpha, a, lda, b, ldb, beta,
-                                                                c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dgemmt_usm_sycl, queue,
+                                upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, dependencies);
 }
 
 sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -3455,9 +3660,9 @@ sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
                   std::complex<float> *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cgemmt_usm_sycl(queue, upper_lower, transa, transb,
-                                                                n, k, alpha, a, lda, b, ldb, beta,
-                                                                c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cgemmt_usm_sycl, queue,
+                                upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, dependencies);
 }
 
 sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -3466,9 +3671,9 @@ sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                   std::complex<double> *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zgemmt_usm_sycl(queue, upper_lower, transa, transb,
-                                                                n, k, alpha, a, lda, b, ldb, beta,
-                                                                c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zgemmt_usm_sycl, queue,
+                                upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3477,9 +3682,10 @@ sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                       std::int8_t ao, const std::uint8_t *b, std::int64_t ldb, std::uint8_t bo,
                       float beta, std::int32_t *c, std::int64_t ldc, const std::int32_t *co,
                       const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_gemm_s8u8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_gemm_s8u8s32_bias_usm_sycl,
+                                queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3488,9 +3694,10 @@ sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                       std::int8_t ao, const std::int8_t *b, std::int64_t ldb, std::int8_t bo,
                       float beta, std::int32_t *c, std::int64_t ldc, const std::int32_t *co,
                       const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_gemm_s8s8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_gemm_s8s8s32_bias_usm_sycl,
+                                queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3499,9 +3706,10 @@ sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                       std::uint8_t ao, const std::int8_t *b, std::int64_t ldb, std::int8_t bo,
                       float beta, std::int32_t *c, std::int64_t ldc, const std::int32_t *co,
                       const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_gemm_u8s8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_gemm_u8s8s32_bias_usm_sycl,
+                                queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3510,9 +3718,10 @@ sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                       std::uint8_t ao, const std::uint8_t *b, std::int64_t ldb, std::uint8_t bo,
                       float beta, std::int32_t *c, std::int64_t ldc, const std::int32_t *co,
                       const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_gemm_u8u8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_gemm_u8u8s32_bias_usm_sycl,
+                                queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -3520,8 +3729,9 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            std::int64_t lda, std::int64_t stride_a, float *b, std::int64_t ldb,
                            std::int64_t stride_b, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_somatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_somatcopy_batch_strided_usm_sycl, queue, trans,
+        m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -3529,8 +3739,9 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb,
                            std::int64_t stride_b, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_domatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_domatcopy_batch_strided_usm_sycl, queue, trans,
+        m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -3538,8 +3749,9 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            const std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
                            std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
                            std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_comatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_comatcopy_batch_strided_usm_sycl, queue, trans,
+        m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -3547,24 +3759,27 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            const std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
                            std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
                            std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zomatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_zomatcopy_batch_strided_usm_sycl, queue, trans,
+        m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                            std::int64_t m, std::int64_t n, float alpha, float *ab, std::int64_t lda,
                            std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_simatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_simatcopy_batch_strided_usm_sycl, queue, trans,
+        m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                            std::int64_t m, std::int64_t n, double alpha, double *ab,
                            std::int64_t lda, std::int64_t ldb, std::int64_t stride,
                            std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_dimatcopy_batch_strided_usm_sycl, queue, trans,
+        m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -3572,8 +3787,9 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
                            std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_cimatcopy_batch_strided_usm_sycl, queue, trans,
+        m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -3581,8 +3797,9 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
                            std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_zimatcopy_batch_strided_usm_sycl, queue, trans,
+        m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3591,9 +3808,10 @@ sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transp
                           const float *b, std::int64_t ldb, std::int64_t stride_b, float *c,
                           std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                           const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_somatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_somatadd_batch_strided_usm_sycl, queue, transa,
+        transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size,
+        dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3602,9 +3820,10 @@ sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transp
                           const double *b, std::int64_t ldb, std::int64_t stride_b, double *c,
                           std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                           const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_domatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_domatadd_batch_strided_usm_sycl, queue, transa,
+        transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size,
+        dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3614,9 +3833,10 @@ sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transp
                           const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
                           std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
                           std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_comatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_comatadd_batch_strided_usm_sycl, queue, transa,
+        transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size,
+        dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3626,86 +3846,89 @@ sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transp
                           const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
                           std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
                           std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zomatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(
+        libkey, &blas_function_table_t::column_major_zomatadd_batch_strided_usm_sycl, queue, transa,
+        transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc, stride_c, batch_size,
+        dependencies);
 }
 
 sycl::event omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
                      float *b, std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_somatcopy_usm_sycl(queue, trans, m, n, alpha, a,
-                                                                   lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_somatcopy_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, double alpha, const double *a,
                      std::int64_t lda, double *b, std::int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_domatcopy_usm_sycl(queue, trans, m, n, alpha, a,
-                                                                   lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_domatcopy_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<float> alpha,
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
                      std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_comatcopy_usm_sycl(queue, trans, m, n, alpha, a,
-                                                                   lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_comatcopy_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<double> alpha,
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
                      std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zomatcopy_usm_sycl(queue, trans, m, n, alpha, a,
-                                                                   lda, b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zomatcopy_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, float alpha, float *ab, std::int64_t lda,
                      std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_simatcopy_usm_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_simatcopy_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, double alpha, double *ab, std::int64_t lda,
                      std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_dimatcopy_usm_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_dimatcopy_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<float> alpha,
                      std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_cimatcopy_usm_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_cimatcopy_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<double> alpha,
                      std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zimatcopy_usm_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zimatcopy_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                     transpose transb, std::int64_t m, std::int64_t n, float alpha, const float *a,
                     std::int64_t lda, float beta, const float *b, std::int64_t ldb, float *c,
                     std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_somatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_somatadd_usm_sycl,
+                                queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                                dependencies);
 }
 
 sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                     transpose transb, std::int64_t m, std::int64_t n, double alpha, const double *a,
                     std::int64_t lda, double beta, const double *b, std::int64_t ldb, double *c,
                     std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_domatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_domatadd_usm_sycl,
+                                queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                                dependencies);
 }
 
 sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3713,8 +3936,9 @@ sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose tr
                     const std::complex<float> *a, std::int64_t lda, std::complex<float> beta,
                     const std::complex<float> *b, std::int64_t ldb, std::complex<float> *c,
                     std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_comatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_comatadd_usm_sycl,
+                                queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                                dependencies);
 }
 
 sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -3722,8 +3946,9 @@ sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose tr
                     const std::complex<double> *a, std::int64_t lda, std::complex<double> beta,
                     const std::complex<double> *b, std::int64_t ldb, std::complex<double> *c,
                     std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].column_major_zomatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::column_major_zomatadd_usm_sycl,
+                                queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                                dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -3731,8 +3956,10 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            std::int64_t* lda, float** b, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].column_major_somatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_somatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -3740,8 +3967,10 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            std::int64_t* lda, double** b, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].column_major_domatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_domatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -3749,8 +3978,10 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            const std::complex<float>** a, std::int64_t* lda,
                            std::complex<float>** b, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].column_major_comatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_comatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -3758,24 +3989,30 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            const std::complex<double>** a, std::int64_t* lda,
                            std::complex<double>** b, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].column_major_zomatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zomatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
                            std::int64_t* m, std::int64_t* n, float* alpha, float** ab,
                            std::int64_t* lda, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].column_major_simatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_simatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
                            std::int64_t* m, std::int64_t* n, double* alpha, double** ab,
                            std::int64_t* lda, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].column_major_dimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_dimatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -3783,8 +4020,10 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            std::complex<float>** ab, std::int64_t* lda, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].column_major_cimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_cimatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -3792,8 +4031,10 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            std::complex<double>** ab, std::int64_t* lda, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].column_major_zimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::column_major_zimatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 } //namespace detail
@@ -3808,413 +4049,467 @@ static oneapi::mkl::detail::table_initializer<domain::blas, blas_function_table_
 void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_scasum_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_scasum_sycl, queue, n, x, incx,
+                         result);
 }
 
 void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dzasum_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dzasum_sycl, queue, n, x, incx,
+                         result);
 }
 
 void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
           std::int64_t incx, sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_sasum_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sasum_sycl, queue, n, x, incx,
+                         result);
 }
 
 void asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dasum_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dasum_sycl, queue, n, x, incx,
+                         result);
 }
 
 void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
           sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_saxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_saxpy_sycl, queue, n, alpha, x,
+                         incx, y, incy);
 }
 
 void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_daxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_daxpy_sycl, queue, n, alpha, x,
+                         incx, y, incy);
 }
 
 void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_caxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_caxpy_sycl, queue, n, alpha, x,
+                         incx, y, incy);
 }
 
 void axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zaxpy_sycl(queue, n, alpha, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zaxpy_sycl, queue, n, alpha, x,
+                         incx, y, incy);
 }
 
 void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                 sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_saxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
-                                                               incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_saxpy_batch_strided_sycl, queue,
+                         n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                 sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_daxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
-                                                               incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_daxpy_batch_strided_sycl, queue,
+                         n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<float>, 1> &y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].row_major_caxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
-                                                               incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_caxpy_batch_strided_sycl, queue,
+                         n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x,
                 std::int64_t incx, std::int64_t stridex, sycl::buffer<std::complex<double>, 1> &y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].row_major_zaxpy_batch_strided_sycl(queue, n, alpha, x, incx, stridex, y,
-                                                               incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zaxpy_batch_strided_sycl, queue,
+                         n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
            sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
            std::int64_t incy) {
-    function_tables[libkey].row_major_saxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_saxpby_sycl, queue, n, alpha, x,
+                         incx, beta, y, incy);
 }
 
 void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
            sycl::buffer<double, 1> &x, std::int64_t incx, double beta, sycl::buffer<double, 1> &y,
            std::int64_t incy) {
-    function_tables[libkey].row_major_daxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_daxpby_sycl, queue, n, alpha, x,
+                         incx, beta, y, incy);
 }
 
 void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_caxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_caxpby_sycl, queue, n, alpha, x,
+                         incx, beta, y, incy);
 }
 
 void axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zaxpby_sycl(queue, n, alpha, x, incx, beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zaxpby_sycl, queue, n, alpha, x,
+                         incx, beta, y, incy);
 }
 
 void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
           std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_scopy_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_scopy_sycl, queue, n, x, incx, y,
+                         incy);
 }
 
 void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_dcopy_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dcopy_sycl, queue, n, x, incx, y,
+                         incy);
 }
 
 void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_ccopy_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ccopy_sycl, queue, n, x, incx, y,
+                         incy);
 }
 
 void copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zcopy_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zcopy_sycl, queue, n, x, incx, y,
+                         incy);
 }
 
 void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_scopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
-                                                               stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_scopy_batch_strided_sycl, queue,
+                         n, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_dcopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
-                                                               stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dcopy_batch_strided_sycl, queue,
+                         n, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_ccopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
-                                                               stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ccopy_batch_strided_sycl, queue,
+                         n, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_zcopy_batch_strided_sycl(queue, n, x, incx, stridex, y, incy,
-                                                               stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zcopy_batch_strided_sycl, queue,
+                         n, x, incx, stridex, y, incy, stridey, batch_size);
 }
 
 void dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
          sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_sdot_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sdot_sycl, queue, n, x, incx, y,
+                         incy, result);
 }
 
 void dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
          std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy,
          sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_ddot_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ddot_sycl, queue, n, x, incx, y,
+                         incy, result);
 }
 
 void dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
          sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dsdot_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dsdot_sycl, queue, n, x, incx, y,
+                         incy, result);
 }
 
 void dotc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &result) {
-    function_tables[libkey].row_major_cdotc_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cdotc_sycl, queue, n, x, incx, y,
+                         incy, result);
 }
 
 void dotc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &result) {
-    function_tables[libkey].row_major_zdotc_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zdotc_sycl, queue, n, x, incx, y,
+                         incy, result);
 }
 
 void dotu(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &result) {
-    function_tables[libkey].row_major_cdotu_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cdotu_sycl, queue, n, x, incx, y,
+                         incy, result);
 }
 
 void dotu(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &result) {
-    function_tables[libkey].row_major_zdotu_sycl(queue, n, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zdotu_sycl, queue, n, x, incx, y,
+                         incy, result);
 }
 
 void iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_isamin_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_isamin_sycl, queue, n, x, incx,
+                         result);
 }
 
 void iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_idamin_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_idamin_sycl, queue, n, x, incx,
+                         result);
 }
 
 void iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_icamin_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_icamin_sycl, queue, n, x, incx,
+                         result);
 }
 
 void iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_izamin_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_izamin_sycl, queue, n, x, incx,
+                         result);
 }
 
 void iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_isamax_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_isamax_sycl, queue, n, x, incx,
+                         result);
 }
 
 void iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_idamax_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_idamax_sycl, queue, n, x, incx,
+                         result);
 }
 
 void iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_icamax_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_icamax_sycl, queue, n, x, incx,
+                         result);
 }
 
 void iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
            sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
            sycl::buffer<std::int64_t, 1> &result) {
-    function_tables[libkey].row_major_izamax_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_izamax_sycl, queue, n, x, incx,
+                         result);
 }
 
 void nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_scnrm2_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_scnrm2_sycl, queue, n, x, incx,
+                         result);
 }
 
 void nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dznrm2_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dznrm2_sycl, queue, n, x, incx,
+                         result);
 }
 
 void nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
           std::int64_t incx, sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_snrm2_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_snrm2_sycl, queue, n, x, incx,
+                         result);
 }
 
 void nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &result) {
-    function_tables[libkey].row_major_dnrm2_sycl(queue, n, x, incx, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dnrm2_sycl, queue, n, x, incx,
+                         result);
 }
 
 void rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
          sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, float c, float s) {
-    function_tables[libkey].row_major_srot_sycl(queue, n, x, incx, y, incy, c, s);
+    function_tables.call(libkey, &blas_function_table_t::row_major_srot_sycl, queue, n, x, incx, y,
+                         incy, c, s);
 }
 
 void rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
          sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, double c, double s) {
-    function_tables[libkey].row_major_drot_sycl(queue, n, x, incx, y, incy, c, s);
+    function_tables.call(libkey, &blas_function_table_t::row_major_drot_sycl, queue, n, x, incx, y,
+                         incy, c, s);
 }
 
 void rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
          std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy, float c, float s) {
-    function_tables[libkey].row_major_csrot_sycl(queue, n, x, incx, y, incy, c, s);
+    function_tables.call(libkey, &blas_function_table_t::row_major_csrot_sycl, queue, n, x, incx, y,
+                         incy, c, s);
 }
 
 void rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<double, 1> &x,
          std::int64_t incx, sycl::buffer<double, 1> &y, std::int64_t incy, double c, double s) {
-    function_tables[libkey].row_major_zdrot_sycl(queue, n, x, incx, y, incy, c, s);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zdrot_sycl, queue, n, x, incx, y,
+                         incy, c, s);
 }
 
 void rotg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<float, 1> &a,
           sycl::buffer<float, 1> &b, sycl::buffer<float, 1> &c, sycl::buffer<float, 1> &s) {
-    function_tables[libkey].row_major_srotg_sycl(queue, a, b, c, s);
+    function_tables.call(libkey, &blas_function_table_t::row_major_srotg_sycl, queue, a, b, c, s);
 }
 
 void rotg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<double, 1> &a,
           sycl::buffer<double, 1> &b, sycl::buffer<double, 1> &c, sycl::buffer<double, 1> &s) {
-    function_tables[libkey].row_major_drotg_sycl(queue, a, b, c, s);
+    function_tables.call(libkey, &blas_function_table_t::row_major_drotg_sycl, queue, a, b, c, s);
 }
 
 void rotg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<std::complex<float>, 1> &a,
           sycl::buffer<std::complex<float>, 1> &b, sycl::buffer<float, 1> &c,
           sycl::buffer<std::complex<float>, 1> &s) {
-    function_tables[libkey].row_major_crotg_sycl(queue, a, b, c, s);
+    function_tables.call(libkey, &blas_function_table_t::row_major_crotg_sycl, queue, a, b, c, s);
 }
 
 void rotg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<std::complex<double>, 1> &a,
           sycl::buffer<std::complex<double>, 1> &b, sycl::buffer<double, 1> &c,
           sycl::buffer<std::complex<double>, 1> &s) {
-    function_tables[libkey].row_major_zrotg_sycl(queue, a, b, c, s);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zrotg_sycl, queue, a, b, c, s);
 }
 
 void rotm(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
           std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy,
           sycl::buffer<float, 1> &param) {
-    function_tables[libkey].row_major_srotm_sycl(queue, n, x, incx, y, incy, param);
+    function_tables.call(libkey, &blas_function_table_t::row_major_srotm_sycl, queue, n, x, incx, y,
+                         incy, param);
 }
 
 void rotm(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy, sycl::buffer<double, 1> &param) {
-    function_tables[libkey].row_major_drotm_sycl(queue, n, x, incx, y, incy, param);
+    function_tables.call(libkey, &blas_function_table_t::row_major_drotm_sycl, queue, n, x, incx, y,
+                         incy, param);
 }
 
 void rotmg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<float, 1> &d1,
            sycl::buffer<float, 1> &d2, sycl::buffer<float, 1> &x1, float y1,
            sycl::buffer<float, 1> &param) {
-    function_tables[libkey].row_major_srotmg_sycl(queue, d1, d2, x1, y1, param);
+    function_tables.call(libkey, &blas_function_table_t::row_major_srotmg_sycl, queue, d1, d2, x1,
+                         y1, param);
 }
 
 void rotmg(oneapi::mkl::device libkey, sycl::queue &queue, sycl::buffer<double, 1> &d1,
            sycl::buffer<double, 1> &d2, sycl::buffer<double, 1> &x1, double y1,
            sycl::buffer<double, 1> &param) {
-    function_tables[libkey].row_major_drotmg_sycl(queue, d1, d2, x1, y1, param);
+    function_tables.call(libkey, &blas_function_table_t::row_major_drotmg_sycl, queue, d1, d2, x1,
+                         y1, param);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
           sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_sscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sscal_sycl, queue, n, alpha, x,
+                         incx);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
           sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dscal_sycl, queue, n, alpha, x,
+                         incx);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_cscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cscal_sycl, queue, n, alpha, x,
+                         incx);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_csscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_csscal_sycl, queue, n, alpha, x,
+                         incx);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_zscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zscal_sycl, queue, n, alpha, x,
+                         incx);
 }
 
 void scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_zdscal_sycl(queue, n, alpha, x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zdscal_sycl, queue, n, alpha, x,
+                         incx);
 }
 
 void sdsdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float sb,
             sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
             std::int64_t incy, sycl::buffer<float, 1> &result) {
-    function_tables[libkey].row_major_sdsdot_sycl(queue, n, sb, x, incx, y, incy, result);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sdsdot_sycl, queue, n, sb, x,
+                         incx, y, incy, result);
 }
 
 void swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, sycl::buffer<float, 1> &x,
           std::int64_t incx, sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_sswap_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sswap_sycl, queue, n, x, incx, y,
+                         incy);
 }
 
 void swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_dswap_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dswap_sycl, queue, n, x, incx, y,
+                         incy);
 }
 
 void swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_cswap_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cswap_sycl, queue, n, x, incx, y,
+                         incy);
 }
 
 void swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zswap_sycl(queue, n, x, incx, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zswap_sycl, queue, n, x, incx, y,
+                         incy);
 }
 
 void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha, sycl::buffer<float, 1> &a,
           std::int64_t lda, sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
           sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_sgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sgbmv_sycl, queue, trans, m, n,
+                         kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha,
           sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &x,
           std::int64_t incx, double beta, sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_dgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dgbmv_sycl, queue, trans, m, n,
+                         kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -4222,8 +4517,8 @@ void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_cgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cgbmv_sycl, queue, trans, m, n,
+                         kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -4231,40 +4526,40 @@ void gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zgbmv_sycl(queue, trans, m, n, kl, ku, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zgbmv_sycl, queue, trans, m, n,
+                         kl, ku, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
           sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_sgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
-                                                 y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sgemv_sycl, queue, trans, m, n,
+                         alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
           sycl::buffer<double, 1> &x, std::int64_t incx, double beta, sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_dgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
-                                                 y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dgemv_sycl, queue, trans, m, n,
+                         alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_cgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
-                                                 y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cgemv_sycl, queue, trans, m, n,
+                         alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
           std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zgemv_sycl(queue, trans, m, n, alpha, a, lda, x, incx, beta,
-                                                 y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zgemv_sycl, queue, trans, m, n,
+                         alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -4272,9 +4567,9 @@ void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                 std::int64_t stridea, sycl::buffer<float, 1> &x, std::int64_t incx,
                 std::int64_t stridex, float beta, sycl::buffer<float, 1> &y, std::int64_t incy,
                 std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].row_major_sgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
-                                                               stridea, x, incx, stridex, beta, y,
-                                                               incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sgemv_batch_strided_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy,
+                         stridey, batch_size);
 }
 
 void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -4282,9 +4577,9 @@ void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                 std::int64_t stridea, sycl::buffer<double, 1> &x, std::int64_t incx,
                 std::int64_t stridex, double beta, sycl::buffer<double, 1> &y, std::int64_t incy,
                 std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].row_major_dgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
-                                                               stridea, x, incx, stridex, beta, y,
-                                                               incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dgemv_batch_strided_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy,
+                         stridey, batch_size);
 }
 
 void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -4293,9 +4588,9 @@ void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                 std::int64_t incx, std::int64_t stridex, std::complex<float> beta,
                 sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, std::int64_t stridey,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_cgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
-                                                               stridea, x, incx, stridex, beta, y,
-                                                               incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cgemv_batch_strided_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy,
+                         stridey, batch_size);
 }
 
 void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -4304,9 +4599,9 @@ void gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                 sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::int64_t stridex,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y,
                 std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
-    function_tables[libkey].row_major_zgemv_batch_strided_sycl(queue, trans, m, n, alpha, a, lda,
-                                                               stridea, x, incx, stridex, beta, y,
-                                                               incy, stridey, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zgemv_batch_strided_sycl, queue,
+                         trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy,
+                         stridey, batch_size);
 }
 
 void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, std::int64_t m,
@@ -4314,8 +4609,9 @@ void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_sdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sdgmm_batch_strided_sycl, queue,
+                         left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec,
+                         batch_size);
 }
 
 void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, std::int64_t m,
@@ -4323,8 +4619,9 @@ void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
                 sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stridec,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_ddgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ddgmm_batch_strided_sycl, queue,
+                         left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec,
+                         batch_size);
 }
 
 void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, std::int64_t m,
@@ -4332,8 +4629,9 @@ void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 std::int64_t stridea, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                 std::int64_t stridex, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                 std::int64_t stridec, std::int64_t batch_size) {
-    function_tables[libkey].row_major_cdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cdgmm_batch_strided_sycl, queue,
+                         left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec,
+                         batch_size);
 }
 
 void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, std::int64_t m,
@@ -4341,426 +4639,445 @@ void dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 std::int64_t stridea, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                 std::int64_t stridex, sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
                 std::int64_t stridec, std::int64_t batch_size) {
-    function_tables[libkey].row_major_zdgmm_batch_strided_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zdgmm_batch_strided_sycl, queue,
+                         left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec,
+                         batch_size);
 }
 
 void ger(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
          float alpha, sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
          std::int64_t incy, sycl::buffer<float, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_sger_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sger_sycl, queue, m, n, alpha, x,
+                         incx, y, incy, a, lda);
 }
 
 void ger(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
          double alpha, sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
          std::int64_t incy, sycl::buffer<double, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_dger_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dger_sycl, queue, m, n, alpha, x,
+                         incx, y, incy, a, lda);
 }
 
 void gerc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_cgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cgerc_sycl, queue, m, n, alpha,
+                         x, incx, y, incy, a, lda);
 }
 
 void gerc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_zgerc_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zgerc_sycl, queue, m, n, alpha,
+                         x, incx, y, incy, a, lda);
 }
 
 void geru(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_cgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cgeru_sycl, queue, m, n, alpha,
+                         x, incx, y, incy, a, lda);
 }
 
 void geru(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_zgeru_sycl(queue, m, n, alpha, x, incx, y, incy, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zgeru_sycl, queue, m, n, alpha,
+                         x, incx, y, incy, a, lda);
 }
 
 void hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_chbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_chbmv_sycl, queue, upper_lower,
+                         n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zhbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zhbmv_sycl, queue, upper_lower,
+                         n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_chemv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_chemv_sycl, queue, upper_lower,
+                         n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zhemv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zhemv_sycl, queue, upper_lower,
+                         n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void her(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_cher_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cher_sycl, queue, upper_lower, n,
+                         alpha, x, incx, a, lda);
 }
 
 void her(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_zher_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zher_sycl, queue, upper_lower, n,
+                         alpha, x, incx, a, lda);
 }
 
 void her2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_cher2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
-                                                 lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cher2_sycl, queue, upper_lower,
+                         n, alpha, x, incx, y, incy, a, lda);
 }
 
 void her2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_zher2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
-                                                 lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zher2_sycl, queue, upper_lower,
+                         n, alpha, x, incx, y, incy, a, lda);
 }
 
 void hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_chpmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
-                                                 incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_chpmv_sycl, queue, upper_lower,
+                         n, alpha, a, x, incx, beta, y, incy);
 }
 
 void hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_zhpmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
-                                                 incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zhpmv_sycl, queue, upper_lower,
+                         n, alpha, a, x, incx, beta, y, incy);
 }
 
 void hpr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<float>, 1> &a) {
-    function_tables[libkey].row_major_chpr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    function_tables.call(libkey, &blas_function_table_t::row_major_chpr_sycl, queue, upper_lower, n,
+                         alpha, x, incx, a);
 }
 
 void hpr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
          sycl::buffer<std::complex<double>, 1> &a) {
-    function_tables[libkey].row_major_zhpr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zhpr_sycl, queue, upper_lower, n,
+                         alpha, x, incx, a);
 }
 
 void hpr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<float>, 1> &a) {
-    function_tables[libkey].row_major_chpr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    function_tables.call(libkey, &blas_function_table_t::row_major_chpr2_sycl, queue, upper_lower,
+                         n, alpha, x, incx, y, incy, a);
 }
 
 void hpr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
           sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
           sycl::buffer<std::complex<double>, 1> &a) {
-    function_tables[libkey].row_major_zhpr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zhpr2_sycl, queue, upper_lower,
+                         n, alpha, x, incx, y, incy, a);
 }
 
 void sbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
           sycl::buffer<float, 1> &x, std::int64_t incx, float beta, sycl::buffer<float, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_ssbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ssbmv_sycl, queue, upper_lower,
+                         n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void sbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           std::int64_t k, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
           sycl::buffer<double, 1> &x, std::int64_t incx, double beta, sycl::buffer<double, 1> &y,
           std::int64_t incy) {
-    function_tables[libkey].row_major_dsbmv_sycl(queue, upper_lower, n, k, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dsbmv_sycl, queue, upper_lower,
+                         n, k, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void spmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1> &a, sycl::buffer<float, 1> &x, std::int64_t incx,
           float beta, sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_sspmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
-                                                 incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sspmv_sycl, queue, upper_lower,
+                         n, alpha, a, x, incx, beta, y, incy);
 }
 
 void spmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1> &a, sycl::buffer<double, 1> &x, std::int64_t incx,
           double beta, sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_dspmv_sycl(queue, upper_lower, n, alpha, a, x, incx, beta, y,
-                                                 incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dspmv_sycl, queue, upper_lower,
+                         n, alpha, a, x, incx, beta, y, incy);
 }
 
 void spr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &a) {
-    function_tables[libkey].row_major_sspr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sspr_sycl, queue, upper_lower, n,
+                         alpha, x, incx, a);
 }
 
 void spr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &a) {
-    function_tables[libkey].row_major_dspr_sycl(queue, upper_lower, n, alpha, x, incx, a);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dspr_sycl, queue, upper_lower, n,
+                         alpha, x, incx, a);
 }
 
 void spr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
           std::int64_t incy, sycl::buffer<float, 1> &a) {
-    function_tables[libkey].row_major_sspr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sspr2_sycl, queue, upper_lower,
+                         n, alpha, x, incx, y, incy, a);
 }
 
 void spr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy, sycl::buffer<double, 1> &a) {
-    function_tables[libkey].row_major_dspr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dspr2_sycl, queue, upper_lower,
+                         n, alpha, x, incx, y, incy, a);
 }
 
 void symv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &x,
           std::int64_t incx, float beta, sycl::buffer<float, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_ssymv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ssymv_sycl, queue, upper_lower,
+                         n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void symv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &x,
           std::int64_t incx, double beta, sycl::buffer<double, 1> &y, std::int64_t incy) {
-    function_tables[libkey].row_major_dsymv_sycl(queue, upper_lower, n, alpha, a, lda, x, incx,
-                                                 beta, y, incy);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dsymv_sycl, queue, upper_lower,
+                         n, alpha, a, lda, x, incx, beta, y, incy);
 }
 
 void syr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          float alpha, sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &a,
          std::int64_t lda) {
-    function_tables[libkey].row_major_ssyr_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ssyr_sycl, queue, upper_lower, n,
+                         alpha, x, incx, a, lda);
 }
 
 void syr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
          double alpha, sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &a,
          std::int64_t lda) {
-    function_tables[libkey].row_major_dsyr_sycl(queue, upper_lower, n, alpha, x, incx, a, lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dsyr_sycl, queue, upper_lower, n,
+                         alpha, x, incx, a, lda);
 }
 
 void syr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           float alpha, sycl::buffer<float, 1> &x, std::int64_t incx, sycl::buffer<float, 1> &y,
           std::int64_t incy, sycl::buffer<float, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_ssyr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
-                                                 lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ssyr2_sycl, queue, upper_lower,
+                         n, alpha, x, incx, y, incy, a, lda);
 }
 
 void syr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
           double alpha, sycl::buffer<double, 1> &x, std::int64_t incx, sycl::buffer<double, 1> &y,
           std::int64_t incy, sycl::buffer<double, 1> &a, std::int64_t lda) {
-    function_tables[libkey].row_major_dsyr2_sycl(queue, upper_lower, n, alpha, x, incx, y, incy, a,
-                                                 lda);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dsyr2_sycl, queue, upper_lower,
+                         n, alpha, x, incx, y, incy, a, lda);
 }
 
 void tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<float, 1> &a,
           std::int64_t lda, sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_stbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_stbmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<double, 1> &a,
           std::int64_t lda, sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dtbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dtbmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ctbmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztbmv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ztbmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<float, 1> &a,
           std::int64_t lda, sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_stbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_stbsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<double, 1> &a,
           std::int64_t lda, sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dtbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dtbsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ctbsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztbsv_sycl(queue, upper_lower, trans, unit_diag, n, k, a, lda,
-                                                 x, incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ztbsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, k, a, lda, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1> &a, sycl::buffer<float, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].row_major_stpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_stpmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1> &a, sycl::buffer<double, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].row_major_dtpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dtpmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1> &a,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ctpmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, x, incx);
 }
 
 void tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1> &a,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztpmv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ztpmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1> &a, sycl::buffer<float, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].row_major_stpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_stpsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1> &a, sycl::buffer<double, 1> &x,
           std::int64_t incx) {
-    function_tables[libkey].row_major_dtpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dtpsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1> &a,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ctpsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, x, incx);
 }
 
 void tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1> &a,
           sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztpsv_sycl(queue, upper_lower, trans, unit_diag, n, a, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ztpsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1> &a, std::int64_t lda,
           sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_strmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_strmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1> &a, std::int64_t lda,
           sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dtrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dtrmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ctrmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztrmv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ztrmv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<float, 1> &a, std::int64_t lda,
           sycl::buffer<float, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_strsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_strsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<double, 1> &a, std::int64_t lda,
           sycl::buffer<double, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_dtrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dtrsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ctrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ctrsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, lda, x, incx);
 }
 
 void trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           diag unit_diag, std::int64_t n, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
-    function_tables[libkey].row_major_ztrsv_sycl(queue, upper_lower, trans, unit_diag, n, a, lda, x,
-                                                 incx);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ztrsv_sycl, queue, upper_lower,
+                         trans, unit_diag, n, a, lda, x, incx);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
           std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
           sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_sgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
-                                                 ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sgemm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
           std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
           sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_dgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
-                                                 ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dgemm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -4768,8 +5085,8 @@ void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, tran
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_cgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
-                                                 ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cgemm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -4777,32 +5094,32 @@ void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, tran
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
-                                                 ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zgemm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, sycl::half alpha,
           sycl::buffer<sycl::half, 1> &a, std::int64_t lda, sycl::buffer<sycl::half, 1> &b,
           std::int64_t ldb, sycl::half beta, sycl::buffer<sycl::half, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_hgemm_sycl(queue, transa, transb, m, n, k, alpha, a, lda, b,
-                                                 ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_hgemm_sycl, queue, transa,
+                         transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
           sycl::buffer<sycl::half, 1> &a, std::int64_t lda, sycl::buffer<sycl::half, 1> &b,
           std::int64_t ldb, float beta, sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_gemm_f16f16f32_sycl(queue, transa, transb, m, n, k, alpha, a,
-                                                          lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_gemm_f16f16f32_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
           std::int64_t m, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<bfloat16, 1> &a,
           std::int64_t lda, sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
           sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_gemm_bf16bf16f32_sycl(queue, transa, transb, m, n, k, alpha,
-                                                            a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_gemm_bf16bf16f32_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -4810,8 +5127,8 @@ void hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_chemm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_chemm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -4819,23 +5136,23 @@ void hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zhemm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zhemm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void herk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, sycl::buffer<std::complex<float>, 1> &a,
           std::int64_t lda, float beta, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_cherk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cherk_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void herk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, sycl::buffer<std::complex<double>, 1> &a,
           std::int64_t lda, double beta, sycl::buffer<std::complex<double>, 1> &c,
           std::int64_t ldc) {
-    function_tables[libkey].row_major_zherk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zherk_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -4843,8 +5160,8 @@ void her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, float beta,
            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_cher2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cher2k_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -4852,24 +5169,24 @@ void her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, double beta,
            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zher2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zher2k_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
           sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
           std::int64_t ldc) {
-    function_tables[libkey].row_major_ssymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ssymm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1> &a,
           std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
           sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_dsymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dsymm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -4877,8 +5194,8 @@ void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_csymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_csymm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -4886,56 +5203,56 @@ void symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zsymm_sycl(queue, left_right, upper_lower, m, n, alpha, a,
-                                                 lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zsymm_sycl, queue, left_right,
+                         upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
           float beta, sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_ssyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ssyrk_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
           std::int64_t lda, double beta, sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_dsyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dsyrk_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_csyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_csyrk_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
           std::int64_t n, std::int64_t k, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zsyrk_sycl(queue, upper_lower, trans, n, k, alpha, a, lda,
-                                                 beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zsyrk_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, beta, c, ldc);
 }
 
 void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                 std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
                 std::int64_t lda, std::int64_t stride_a, float beta, sycl::buffer<float, 1> &c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_ssyrk_batch_strided_sycl(queue, upper_lower, trans, n, k,
-                                                               alpha, a, lda, stride_a, beta, c,
-                                                               ldc, stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ssyrk_batch_strided_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                         batch_size);
 }
 
 void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                 std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
                 std::int64_t lda, std::int64_t stride_a, double beta, sycl::buffer<double, 1> &c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_dsyrk_batch_strided_sycl(queue, upper_lower, trans, n, k,
-                                                               alpha, a, lda, stride_a, beta, c,
-                                                               ldc, stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dsyrk_batch_strided_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                         batch_size);
 }
 
 void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -4943,9 +5260,9 @@ void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower
                 sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_csyrk_batch_strided_sycl(queue, upper_lower, trans, n, k,
-                                                               alpha, a, lda, stride_a, beta, c,
-                                                               ldc, stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_csyrk_batch_strided_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                         batch_size);
 }
 
 void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -4953,25 +5270,25 @@ void syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower
                 sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_zsyrk_batch_strided_sycl(queue, upper_lower, trans, n, k,
-                                                               alpha, a, lda, stride_a, beta, c,
-                                                               ldc, stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zsyrk_batch_strided_sycl, queue,
+                         upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
+                         batch_size);
 }
 
 void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
            sycl::buffer<float, 1> &b, std::int64_t ldb, float beta, sycl::buffer<float, 1> &c,
            std::int64_t ldc) {
-    function_tables[libkey].row_major_ssyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ssyr2k_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
            std::int64_t n, std::int64_t k, double alpha, sycl::buffer<double, 1> &a,
            std::int64_t lda, sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
            sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_dsyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dsyr2k_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -4979,8 +5296,8 @@ void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_csyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_csyr2k_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -4988,72 +5305,72 @@ void syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zsyr2k_sycl(queue, upper_lower, trans, n, k, alpha, a, lda, b,
-                                                  ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zsyr2k_sycl, queue, upper_lower,
+                         trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].row_major_strmm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_strmm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].row_major_dtrmm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dtrmm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_ctrmm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ctrmm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_ztrmm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ztrmm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
           sycl::buffer<float, 1> &a, std::int64_t lda, sycl::buffer<float, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].row_major_strsm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_strsm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
           sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
           std::int64_t ldb) {
-    function_tables[libkey].row_major_dtrsm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dtrsm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_ctrsm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ctrsm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
           transpose trans, diag unit_diag, std::int64_t m, std::int64_t n,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
           sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_ztrsm_sycl(queue, left_right, upper_lower, trans, unit_diag,
-                                                 m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ztrsm_sycl, queue, left_right,
+                         upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb);
 }
 
 void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5062,9 +5379,9 @@ void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa
                 sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_sgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sgemm_batch_strided_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta,
+                         c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5073,9 +5390,9 @@ void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa
                 sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b, double beta,
                 sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_dgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dgemm_batch_strided_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta,
+                         c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5084,9 +5401,9 @@ void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa
                 sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_cgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cgemm_batch_strided_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta,
+                         c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5095,9 +5412,9 @@ void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa
                 sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1> &c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_zgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zgemm_batch_strided_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta,
+                         c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5106,9 +5423,9 @@ void gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa
                 sycl::buffer<sycl::half, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 sycl::half beta, sycl::buffer<sycl::half, 1> &c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_hgemm_batch_strided_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_hgemm_batch_strided_sycl, queue,
+                         transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta,
+                         c, ldc, stride_c, batch_size);
 }
 
 void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -5116,9 +5433,9 @@ void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_strsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_strsm_batch_strided_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a,
+                         b, ldb, stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -5126,9 +5443,9 @@ void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
                 sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                 std::int64_t batch_size) {
-    function_tables[libkey].row_major_dtrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dtrsm_batch_strided_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a,
+                         b, ldb, stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -5136,9 +5453,9 @@ void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<float>, 1> &b,
                 std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].row_major_ctrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ctrsm_batch_strided_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a,
+                         b, ldb, stride_b, batch_size);
 }
 
 void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -5146,25 +5463,25 @@ void trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
                 std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
                 std::int64_t lda, std::int64_t stride_a, sycl::buffer<std::complex<double>, 1> &b,
                 std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].row_major_ztrsm_batch_strided_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_ztrsm_batch_strided_sycl, queue,
+                         left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a,
+                         b, ldb, stride_b, batch_size);
 }
 
 void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, float alpha, sycl::buffer<float, 1> &a,
            std::int64_t lda, sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
            sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_sgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha,
-                                                  a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_sgemmt_sycl, queue, upper_lower,
+                         transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose transa,
            transpose transb, std::int64_t n, std::int64_t k, double alpha,
            sycl::buffer<double, 1> &a, std::int64_t lda, sycl::buffer<double, 1> &b,
            std::int64_t ldb, double beta, sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_dgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha,
-                                                  a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dgemmt_sycl, queue, upper_lower,
+                         transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose transa,
@@ -5172,8 +5489,8 @@ void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
            sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_cgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha,
-                                                  a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cgemmt_sycl, queue, upper_lower,
+                         transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose transa,
@@ -5181,8 +5498,8 @@ void gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, tra
            sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
            sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
            sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zgemmt_sycl(queue, upper_lower, transa, transb, n, k, alpha,
-                                                  a, lda, b, ldb, beta, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zgemmt_sycl, queue, upper_lower,
+                         transa, transb, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
 void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5190,8 +5507,9 @@ void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao, sycl::buffer<uint8_t, 1> &b,
                std::int64_t ldb, uint8_t bo, float beta, sycl::buffer<int32_t, 1> &c,
                std::int64_t ldc, sycl::buffer<int32_t, 1> &co) {
-    function_tables[libkey].row_major_gemm_s8u8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    function_tables.call(libkey, &blas_function_table_t::row_major_gemm_s8u8s32_bias_sycl, queue,
+                         transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c,
+                         ldc, co);
 }
 
 void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5199,8 +5517,9 @@ void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                sycl::buffer<int8_t, 1> &a, std::int64_t lda, int8_t ao, sycl::buffer<int8_t, 1> &b,
                std::int64_t ldb, int8_t bo, float beta, sycl::buffer<int32_t, 1> &c,
                std::int64_t ldc, sycl::buffer<int32_t, 1> &co) {
-    function_tables[libkey].row_major_gemm_s8s8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    function_tables.call(libkey, &blas_function_table_t::row_major_gemm_s8s8s32_bias_sycl, queue,
+                         transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c,
+                         ldc, co);
 }
 
 void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5208,8 +5527,9 @@ void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
                sycl::buffer<int8_t, 1> &b, std::int64_t ldb, int8_t bo, float beta,
                sycl::buffer<int32_t, 1> &c, std::int64_t ldc, sycl::buffer<int32_t, 1> &co) {
-    function_tables[libkey].row_major_gemm_u8s8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    function_tables.call(libkey, &blas_function_table_t::row_major_gemm_u8s8s32_bias_sycl, queue,
+                         transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c,
+                         ldc, co);
 }
 
 void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5217,24 +5537,25 @@ void gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
                sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
                sycl::buffer<int32_t, 1> &c, std::int64_t ldc, sycl::buffer<int32_t, 1> &co) {
-    function_tables[libkey].row_major_gemm_u8u8s32_bias_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co);
+    function_tables.call(libkey, &blas_function_table_t::row_major_gemm_u8u8s32_bias_sycl, queue,
+                         transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c,
+                         ldc, co);
 }
 
 void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<float, 1> &b, std::int64_t ldb,
                     std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].row_major_somatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_somatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<double, 1> &b, std::int64_t ldb,
                     std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].row_major_domatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_domatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -5242,8 +5563,8 @@ void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tr
                     sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<std::complex<float>, 1> &b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].row_major_comatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_comatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -5251,38 +5572,38 @@ void omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tr
                     sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                     std::int64_t stride_a, sycl::buffer<std::complex<double>, 1> &b,
                     std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
-    function_tables[libkey].row_major_zomatcopy_batch_strided_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zomatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size);
 }
 
 void imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, float alpha, sycl::buffer<float, 1> &ab, std::int64_t lda,
                     std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
-    function_tables[libkey].row_major_simatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb, stride, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_simatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, double alpha, sycl::buffer<double, 1> &ab, std::int64_t lda,
                     std::int64_t ldb, std::int64_t stride, std::int64_t batch_size) {
-    function_tables[libkey].row_major_dimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb, stride, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dimatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, std::complex<float> alpha,
                     sycl::buffer<std::complex<float>, 1> &ab, std::int64_t lda, std::int64_t ldb,
                     std::int64_t stride, std::int64_t batch_size) {
-    function_tables[libkey].row_major_cimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb, stride, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cimatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                     std::int64_t n, std::complex<double> alpha,
                     sycl::buffer<std::complex<double>, 1> &ab, std::int64_t lda, std::int64_t ldb,
                     std::int64_t stride, std::int64_t batch_size) {
-    function_tables[libkey].row_major_zimatcopy_batch_strided_sycl(queue, trans, m, n, alpha, ab,
-                                                                   lda, ldb, stride, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zimatcopy_batch_strided_sycl,
+                         queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size);
 }
 
 void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -5291,9 +5612,9 @@ void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tra
                    sycl::buffer<float, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                    sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                    std::int64_t batch_size) {
-    function_tables[libkey].row_major_somatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_somatadd_batch_strided_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -5302,9 +5623,9 @@ void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tra
                    sycl::buffer<double, 1> &b, std::int64_t ldb, std::int64_t stride_b,
                    sycl::buffer<double, 1> &c, std::int64_t ldc, std::int64_t stride_c,
                    std::int64_t batch_size) {
-    function_tables[libkey].row_major_domatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_domatadd_batch_strided_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -5313,9 +5634,9 @@ void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tra
                    std::complex<float> beta, sycl::buffer<std::complex<float>, 1> &b,
                    std::int64_t ldb, std::int64_t stride_b, sycl::buffer<std::complex<float>, 1> &c,
                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_comatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_comatadd_batch_strided_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size);
 }
 
 void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -5325,73 +5646,81 @@ void omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose tra
                    sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
                    std::int64_t stride_b, sycl::buffer<std::complex<double>, 1> &c,
                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    function_tables[libkey].row_major_zomatadd_batch_strided_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zomatadd_batch_strided_sycl,
+                         queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                         stride_b, c, ldc, stride_c, batch_size);
 }
 
 void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, float alpha, sycl::buffer<float, 1> &a, std::int64_t lda,
               sycl::buffer<float, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_somatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_somatcopy_sycl, queue, trans, m,
+                         n, alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, double alpha, sycl::buffer<double, 1> &a, std::int64_t lda,
               sycl::buffer<double, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_domatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_domatcopy_sycl, queue, trans, m,
+                         n, alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &a,
               std::int64_t lda, sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_comatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_comatcopy_sycl, queue, trans, m,
+                         n, alpha, a, lda, b, ldb);
 }
 
 void omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &a,
               std::int64_t lda, sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
-    function_tables[libkey].row_major_zomatcopy_sycl(queue, trans, m, n, alpha, a, lda, b, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zomatcopy_sycl, queue, trans, m,
+                         n, alpha, a, lda, b, ldb);
 }
 
 void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, float alpha, sycl::buffer<float, 1> &ab, std::int64_t lda,
               std::int64_t ldb) {
-    function_tables[libkey].row_major_simatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_simatcopy_sycl, queue, trans, m,
+                         n, alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, double alpha, sycl::buffer<double, 1> &ab, std::int64_t lda,
               std::int64_t ldb) {
-    function_tables[libkey].row_major_dimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_dimatcopy_sycl, queue, trans, m,
+                         n, alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1> &ab,
               std::int64_t lda, std::int64_t ldb) {
-    function_tables[libkey].row_major_cimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_cimatcopy_sycl, queue, trans, m,
+                         n, alpha, ab, lda, ldb);
 }
 
 void imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
               std::int64_t n, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1> &ab,
               std::int64_t lda, std::int64_t ldb) {
-    function_tables[libkey].row_major_zimatcopy_sycl(queue, trans, m, n, alpha, ab, lda, ldb);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zimatcopy_sycl, queue, trans, m,
+                         n, alpha, ab, lda, ldb);
 }
 
 void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
              std::int64_t m, std::int64_t n, float alpha, sycl::buffer<float, 1> &a,
              std::int64_t lda, float beta, sycl::buffer<float, 1> &b, std::int64_t ldb,
              sycl::buffer<float, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_somatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                    beta, b, ldb, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_somatadd_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
              std::int64_t m, std::int64_t n, double alpha, sycl::buffer<double, 1> &a,
              std::int64_t lda, double beta, sycl::buffer<double, 1> &b, std::int64_t ldb,
              sycl::buffer<double, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_domatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                    beta, b, ldb, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_domatadd_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5399,8 +5728,8 @@ void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, t
              sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, std::complex<float> beta,
              sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
              sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_comatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                    beta, b, ldb, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_comatadd_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -5408,8 +5737,8 @@ void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, t
              sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, std::complex<double> beta,
              sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
              sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
-    function_tables[libkey].row_major_zomatadd_sycl(queue, transa, transb, m, n, alpha, a, lda,
-                                                    beta, b, ldb, c, ldc);
+    function_tables.call(libkey, &blas_function_table_t::row_major_zomatadd_sycl, queue, transa,
+                         transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
 }
 
 // USM APIs
@@ -5417,73 +5746,75 @@ void omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, t
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<float> *x, std::int64_t incx, float *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_scasum_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_scasum_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<double> *x, std::int64_t incx, double *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dzasum_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dzasum_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                  std::int64_t incx, float *result, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sasum_usm_sycl(queue, n, x, incx, result,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sasum_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event asum(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                  std::int64_t incx, double *result, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dasum_usm_sycl(queue, n, x, incx, result,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dasum_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                  const float *x, std::int64_t incx, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_saxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_saxpy_usm_sycl, queue, n,
+                                alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                  const double *x, std::int64_t incx, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_daxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_daxpy_usm_sycl, queue, n,
+                                alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                  std::complex<float> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_caxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_caxpy_usm_sycl, queue, n,
+                                alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                  std::complex<double> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zaxpy_usm_sycl(queue, n, alpha, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zaxpy_usm_sycl, queue, n,
+                                alpha, x, incx, y, incy, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        float *alpha, const float **x, std::int64_t *incx, float **y,
                        std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_saxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_saxpy_batch_group_usm_sycl, queue,
+                                n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        double *alpha, const double **x, std::int64_t *incx, double **y,
                        std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_daxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_daxpy_batch_group_usm_sycl, queue,
+                                n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
@@ -5491,8 +5822,9 @@ sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int6
                        std::int64_t *incx, std::complex<float> **y, std::int64_t *incy,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_caxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_caxpy_batch_group_usm_sycl, queue,
+                                n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
@@ -5500,24 +5832,29 @@ sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int6
                        std::int64_t *incx, std::complex<double> **y, std::int64_t *incy,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zaxpy_batch_group_usm_sycl(
-        queue, n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zaxpy_batch_group_usm_sycl, queue,
+                                n, alpha, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                        const float *x, std::int64_t incx, std::int64_t stridex, float *y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_saxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_saxpy_batch_strided_usm_sycl,
+                                queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                        const double *x, std::int64_t incx, std::int64_t stridex, double *y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_daxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_daxpy_batch_strided_usm_sycl,
+                                queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
@@ -5525,8 +5862,10 @@ sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int6
                        std::int64_t stridex, std::complex<float> *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_caxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_caxpy_batch_strided_usm_sycl,
+                                queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
@@ -5534,430 +5873,454 @@ sycl::event axpy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int6
                        std::int64_t stridex, std::complex<double> *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zaxpy_batch_strided_usm_sycl(
-        queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zaxpy_batch_strided_usm_sycl,
+                                queue, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                   const float *x, std::int64_t incx, const float beta, float *y, std::int64_t incy,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_saxpby_usm_sycl(queue, n, alpha, x, incx, beta, y,
-                                                             incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_saxpby_usm_sycl, queue, n,
+                                alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                   const double *x, std::int64_t incx, const double beta, double *y,
                   std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_daxpby_usm_sycl(queue, n, alpha, x, incx, beta, y,
-                                                             incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_daxpby_usm_sycl, queue, n,
+                                alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                   const std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_caxpby_usm_sycl(queue, n, alpha, x, incx, beta, y,
-                                                             incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_caxpby_usm_sycl, queue, n,
+                                alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event axpby(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                   const std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zaxpby_usm_sycl(queue, n, alpha, x, incx, beta, y,
-                                                             incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zaxpby_usm_sycl, queue, n,
+                                alpha, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                  std::int64_t incx, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_scopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_scopy_usm_sycl, queue, n,
+                                x, incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                  std::int64_t incx, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dcopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dcopy_usm_sycl, queue, n,
+                                x, incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ccopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ccopy_usm_sycl, queue, n,
+                                x, incx, y, incy, dependencies);
 }
 
 sycl::event copy(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zcopy_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zcopy_usm_sycl, queue, n,
+                                x, incx, y, incy, dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        const float **x, std::int64_t *incx, float **y, std::int64_t *incy,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_scopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_scopy_batch_group_usm_sycl, queue,
+                                n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        const double **x, std::int64_t *incx, double **y, std::int64_t *incy,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dcopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dcopy_batch_group_usm_sycl, queue,
+                                n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        const std::complex<float> **x, std::int64_t *incx, std::complex<float> **y,
                        std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ccopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_ccopy_batch_group_usm_sycl, queue,
+                                n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *n,
                        const std::complex<double> **x, std::int64_t *incx, std::complex<double> **y,
                        std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zcopy_batch_group_usm_sycl(
-        queue, n, x, incx, y, incy, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zcopy_batch_group_usm_sycl, queue,
+                                n, x, incx, y, incy, group_count, group_size, dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                        const float *x, std::int64_t incx, std::int64_t stridex, float *y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_scopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_scopy_batch_strided_usm_sycl,
+                                queue, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                        const double *x, std::int64_t incx, std::int64_t stridex, double *y,
                        std::int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dcopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dcopy_batch_strided_usm_sycl,
+                                queue, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                        const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
                        std::complex<float> *y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ccopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_ccopy_batch_strided_usm_sycl,
+                                queue, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event copy_batch(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                        const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
                        std::complex<double> *y, std::int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zcopy_batch_strided_usm_sycl(
-        queue, n, x, incx, stridex, y, incy, stridey, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zcopy_batch_strided_usm_sycl,
+                                queue, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
 }
 
 sycl::event dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                 std::int64_t incx, const float *y, std::int64_t incy, float *result,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sdot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                           dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sdot_usm_sycl, queue, n,
+                                x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                 std::int64_t incx, const double *y, std::int64_t incy, double *result,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ddot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                           dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ddot_usm_sycl, queue, n,
+                                x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                 std::int64_t incx, const float *y, std::int64_t incy, double *result,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsdot_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dsdot_usm_sycl, queue, n,
+                                x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dotc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
                  std::int64_t incy, std::complex<float> *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cdotc_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cdotc_usm_sycl, queue, n,
+                                x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dotc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<double> *x, std::int64_t incx, const std::complex<double> *y,
                  std::int64_t incy, std::complex<double> *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zdotc_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zdotc_usm_sycl, queue, n,
+                                x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dotu(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<float> *x, std::int64_t incx, const std::complex<float> *y,
                  std::int64_t incy, std::complex<float> *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cdotu_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cdotu_usm_sycl, queue, n,
+                                x, incx, y, incy, result, dependencies);
 }
 
 sycl::event dotu(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<double> *x, std::int64_t incx, const std::complex<double> *y,
                  std::int64_t incy, std::complex<double> *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zdotu_usm_sycl(queue, n, x, incx, y, incy, result,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zdotu_usm_sycl, queue, n,
+                                x, incx, y, incy, result, dependencies);
 }
 
 sycl::event iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                   std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_isamin_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_isamin_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                   std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_idamin_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_idamin_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   const std::complex<float> *x, std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_icamin_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_icamin_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event iamin(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   const std::complex<double> *x, std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_izamin_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_izamin_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                   std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_isamax_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_isamax_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                   std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_idamax_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_idamax_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   const std::complex<float> *x, std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_icamax_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_icamax_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event iamax(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                   const std::complex<double> *x, std::int64_t incx, std::int64_t *result,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_izamax_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_izamax_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<float> *x, std::int64_t incx, float *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_scnrm2_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_scnrm2_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  const std::complex<double> *x, std::int64_t incx, double *result,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dznrm2_usm_sycl(queue, n, x, incx, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dznrm2_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const float *x,
                  std::int64_t incx, float *result, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_snrm2_usm_sycl(queue, n, x, incx, result,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_snrm2_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event nrm2(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, const double *x,
                  std::int64_t incx, double *result, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dnrm2_usm_sycl(queue, n, x, incx, result,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dnrm2_usm_sycl, queue, n,
+                                x, incx, result, dependencies);
 }
 
 sycl::event rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                 std::int64_t incy, float c, float s, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_srot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                           dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_srot_usm_sycl, queue, n,
+                                x, incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                 std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                 std::int64_t incy, double c, double s,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_drot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                           dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_drot_usm_sycl, queue, n,
+                                x, incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float *x,
                 std::int64_t incx, float *y, std::int64_t incy, float c, float s,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csrot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_csrot_usm_sycl, queue, n,
+                                x, incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double *x,
                 std::int64_t incx, double *y, std::int64_t incy, double c, double s,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zdrot_usm_sycl(queue, n, x, incx, y, incy, c, s,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zdrot_usm_sycl, queue, n,
+                                x, incx, y, incy, c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::mkl::device libkey, sycl::queue &queue, float *a, float *b, float *c,
                  float *s, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_srotg_usm_sycl(queue, a, b, c, s, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_srotg_usm_sycl, queue, a,
+                                b, c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::mkl::device libkey, sycl::queue &queue, double *a, double *b, double *c,
                  double *s, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_drotg_usm_sycl(queue, a, b, c, s, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_drotg_usm_sycl, queue, a,
+                                b, c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::mkl::device libkey, sycl::queue &queue, std::complex<float> *a,
                  std::complex<float> *b, float *c, std::complex<float> *s,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_crotg_usm_sycl(queue, a, b, c, s, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_crotg_usm_sycl, queue, a,
+                                b, c, s, dependencies);
 }
 
 sycl::event rotg(oneapi::mkl::device libkey, sycl::queue &queue, std::complex<double> *a,
                  std::complex<double> *b, double *c, std::complex<double> *s,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zrotg_usm_sycl(queue, a, b, c, s, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zrotg_usm_sycl, queue, a,
+                                b, c, s, dependencies);
 }
 
 sycl::event rotm(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float *x,
                  std::int64_t incx, float *y, std::int64_t incy, float *param,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_srotm_usm_sycl(queue, n, x, incx, y, incy, param,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_srotm_usm_sycl, queue, n,
+                                x, incx, y, incy, param, dependencies);
 }
 
 sycl::event rotm(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double *x,
                  std::int64_t incx, double *y, std::int64_t incy, double *param,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_drotm_usm_sycl(queue, n, x, incx, y, incy, param,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_drotm_usm_sycl, queue, n,
+                                x, incx, y, incy, param, dependencies);
 }
 
 sycl::event rotmg(oneapi::mkl::device libkey, sycl::queue &queue, float *d1, float *d2, float *x1,
                   float y1, float *param, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_srotmg_usm_sycl(queue, d1, d2, x1, y1, param,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_srotmg_usm_sycl, queue,
+                                d1, d2, x1, y1, param, dependencies);
 }
 
 sycl::event rotmg(oneapi::mkl::device libkey, sycl::queue &queue, double *d1, double *d2,
                   double *x1, double y1, double *param,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_drotmg_usm_sycl(queue, d1, d2, x1, y1, param,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_drotmg_usm_sycl, queue,
+                                d1, d2, x1, y1, param, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                  float *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sscal_usm_sycl, queue, n,
+                                alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                  double *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dscal_usm_sycl, queue, n,
+                                alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<float> alpha, std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cscal_usm_sycl, queue, n,
+                                alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<double> alpha, std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csscal_usm_sycl(queue, n, alpha, x, incx,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_csscal_usm_sycl, queue, n,
+                                alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float alpha,
                  std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zscal_usm_sycl(queue, n, alpha, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zscal_usm_sycl, queue, n,
+                                alpha, x, incx, dependencies);
 }
 
 sycl::event scal(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double alpha,
                  std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zdscal_usm_sycl(queue, n, alpha, x, incx,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zdscal_usm_sycl, queue, n,
+                                alpha, x, incx, dependencies);
 }
 
 sycl::event sdsdot(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float sb,
                    const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                    float *result, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sdsdot_usm_sycl(queue, n, sb, x, incx, y, incy, result,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sdsdot_usm_sycl, queue, n,
+                                sb, x, incx, y, incy, result, dependencies);
 }
 
 sycl::event swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, float *x,
                  std::int64_t incx, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sswap_usm_sycl, queue, n,
+                                x, incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n, double *x,
                  std::int64_t incx, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dswap_usm_sycl, queue, n,
+                                x, incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cswap_usm_sycl, queue, n,
+                                x, incx, y, incy, dependencies);
 }
 
 sycl::event swap(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t n,
                  std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zswap_usm_sycl(queue, n, x, incx, y, incy,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zswap_usm_sycl, queue, n,
+                                x, incx, y, incy, dependencies);
 }
 
 sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                  std::int64_t n, std::int64_t kl, std::int64_t ku, float alpha, const float *a,
                  std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sgbmv_usm_sycl, queue,
+                                trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                  std::int64_t n, std::int64_t kl, std::int64_t ku, double alpha, const double *a,
                  std::int64_t lda, const double *x, std::int64_t incx, double beta, double *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dgbmv_usm_sycl, queue,
+                                trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -5965,8 +6328,9 @@ sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  const std::complex<float> *a, std::int64_t lda, const std::complex<float> *x,
                  std::int64_t incx, std::complex<float> beta, std::complex<float> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cgbmv_usm_sycl, queue,
+                                trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -5974,24 +6338,25 @@ sycl::event gbmv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  const std::complex<double> *a, std::int64_t lda, const std::complex<double> *x,
                  std::int64_t incx, std::complex<double> beta, std::complex<double> *y,
                  std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgbmv_usm_sycl(
-        queue, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zgbmv_usm_sycl, queue,
+                                trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                  std::int64_t n, float alpha, const float *a, std::int64_t lda, const float *x,
                  std::int64_t incx, float beta, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sgemv_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
                  std::int64_t n, double alpha, const double *a, std::int64_t lda, const double *x,
                  std::int64_t incx, double beta, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dgemv_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -5999,8 +6364,8 @@ sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
                  std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cgemv_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans, std::int64_t m,
@@ -6008,8 +6373,8 @@ sycl::event gemv(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
                  std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemv_usm_sycl(queue, trans, m, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zgemv_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -6018,9 +6383,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t stridex, float beta, float *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_sgemv_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -6029,9 +6395,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t stridex, double beta, double *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dgemv_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -6041,9 +6408,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_cgemv_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -6053,9 +6421,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemv_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta, y, incy, stridey,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zgemv_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *trans,
@@ -6063,9 +6432,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t *lda, const float **x, std::int64_t *incx, float *beta,
                        float **y, std::int64_t *incy, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_sgemv_batch_group_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *trans,
@@ -6073,9 +6443,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t *lda, const double **x, std::int64_t *incx, double *beta,
                        double **y, std::int64_t *incy, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dgemv_batch_group_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *trans,
@@ -6084,9 +6455,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        const std::complex<float> **x, std::int64_t *incx, std::complex<float> *beta,
                        std::complex<float> **y, std::int64_t *incy, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_cgemv_batch_group_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *trans,
@@ -6096,9 +6468,10 @@ sycl::event gemv_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::complex<double> *beta, std::complex<double> **y, std::int64_t *incy,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemv_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zgemv_batch_group_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -6106,9 +6479,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t stridea, const float *x, std::int64_t incx,
                        std::int64_t stridex, float *c, std::int64_t ldc, std::int64_t stridec,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_sdgmm_batch_strided_usm_sycl,
+                                queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -6116,9 +6490,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t stridea, const double *x, std::int64_t incx,
                        std::int64_t stridex, double *c, std::int64_t ldc, std::int64_t stridec,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ddgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_ddgmm_batch_strided_usm_sycl,
+                                queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -6127,9 +6502,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t incx, std::int64_t stridex, std::complex<float> *c,
                        std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_cdgmm_batch_strided_usm_sycl,
+                                queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -6138,9 +6514,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t incx, std::int64_t stridex, std::complex<double> *c,
                        std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zdgmm_batch_strided_usm_sycl(
-        queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc, stridec, batch_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zdgmm_batch_strided_usm_sycl,
+                                queue, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -6148,8 +6525,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        const float **x, std::int64_t *incx, float **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_sdgmm_batch_group_usm_sycl, queue,
+                                left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                                dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -6157,8 +6536,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        const double **x, std::int64_t *incx, double **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ddgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_ddgmm_batch_group_usm_sycl, queue,
+                                left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                                dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -6166,8 +6547,10 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *lda, const std::complex<float> **x, std::int64_t *incx,
                        std::complex<float> **c, std::int64_t *ldc, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_cdgmm_batch_group_usm_sycl, queue,
+                                left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                                dependencies);
 }
 
 sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -6175,55 +6558,57 @@ sycl::event dgmm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *lda, const std::complex<double> **x, std::int64_t *incx,
                        std::complex<double> **c, std::int64_t *ldc, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zdgmm_batch_group_usm_sycl(
-        queue, left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zdgmm_batch_group_usm_sycl, queue,
+                                left_right, m, n, a, lda, x, incx, c, ldc, group_count, group_size,
+                                dependencies);
 }
 
 sycl::event ger(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                 float alpha, const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                 float *a, std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sger_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                           lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sger_usm_sycl, queue, m,
+                                n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event ger(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                 double alpha, const double *x, std::int64_t incx, const double *y,
                 std::int64_t incy, double *a, std::int64_t lda,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dger_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                           lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dger_usm_sycl, queue, m,
+                                n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event gerc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                  const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgerc_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cgerc_usm_sycl, queue, m,
+                                n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event gerc(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                  const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgerc_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zgerc_usm_sycl, queue, m,
+                                n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event geru(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                  const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgeru_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cgeru_usm_sycl, queue, m,
+                                n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event geru(oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t m, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                  const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgeru_usm_sycl(queue, m, n, alpha, x, incx, y, incy, a,
-                                                            lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zgeru_usm_sycl, queue, m,
+                                n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -6231,8 +6616,9 @@ sycl::event hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
                  std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_chbmv_usm_sycl, queue,
+                                upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -6240,8 +6626,9 @@ sycl::event hbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
                  std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zhbmv_usm_sycl, queue,
+                                upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -6249,8 +6636,9 @@ sycl::event hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
                  std::complex<float> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chemv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_chemv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -6258,40 +6646,41 @@ sycl::event hemv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
                  std::complex<double> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhemv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zhemv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event her(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 float alpha, const std::complex<float> *x, std::int64_t incx,
                 std::complex<float> *a, std::int64_t lda,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cher_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cher_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event her(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 double alpha, const std::complex<double> *x, std::int64_t incx,
                 std::complex<double> *a, std::int64_t lda,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zher_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zher_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event her2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                  const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cher2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cher2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event her2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                  const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
                  std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zher2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zher2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -6299,8 +6688,8 @@ sycl::event hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
                  std::complex<float> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chpmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_chpmv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
@@ -6308,337 +6697,343 @@ sycl::event hpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<double> *x, std::int64_t incx, std::complex<double> beta,
                  std::complex<double> *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhpmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zhpmv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event hpr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 float alpha, const std::complex<float> *x, std::int64_t incx,
                 std::complex<float> *a, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chpr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_chpr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event hpr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 double alpha, const std::complex<double> *x, std::int64_t incx,
                 std::complex<double> *a, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhpr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zhpr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event hpr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
                  const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chpr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_chpr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event hpr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::complex<double> alpha, const std::complex<double> *x, std::int64_t incx,
                  const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhpr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zhpr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event sbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::int64_t k, float alpha, const float *a, std::int64_t lda, const float *x,
                  std::int64_t incx, float beta, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ssbmv_usm_sycl, queue,
+                                upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event sbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  std::int64_t k, double alpha, const double *a, std::int64_t lda, const double *x,
                  std::int64_t incx, double beta, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsbmv_usm_sycl(queue, upper_lower, n, k, alpha, a, lda,
-                                                            x, incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dsbmv_usm_sycl, queue,
+                                upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event spmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float *a, const float *x, std::int64_t incx, float beta,
                  float *y, std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sspmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sspmv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event spmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double *a, const double *x, std::int64_t incx, double beta,
                  double *y, std::int64_t incy, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dspmv_usm_sycl(queue, upper_lower, n, alpha, a, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dspmv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
 }
 
 sycl::event spr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 float alpha, const float *x, std::int64_t incx, float *a,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sspr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sspr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event spr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 double alpha, const double *x, std::int64_t incx, double *a,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dspr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dspr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, dependencies);
 }
 
 sycl::event spr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                  float *a, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sspr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sspr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event spr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double *x, std::int64_t incx, const double *y,
                  std::int64_t incy, double *a, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dspr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dspr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
 }
 
 sycl::event symv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float *a, std::int64_t lda, const float *x, std::int64_t incx,
                  float beta, float *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssymv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ssymv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event symv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double *a, std::int64_t lda, const double *x,
                  std::int64_t incx, double beta, double *y, std::int64_t incy,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsymv_usm_sycl(queue, upper_lower, n, alpha, a, lda, x,
-                                                            incx, beta, y, incy, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dsymv_usm_sycl, queue,
+                                upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                                dependencies);
 }
 
 sycl::event syr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 float alpha, const float *x, std::int64_t incx, float *a, std::int64_t lda,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssyr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ssyr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event syr(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                 double alpha, const double *x, std::int64_t incx, double *a, std::int64_t lda,
                 const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsyr_usm_sycl(queue, upper_lower, n, alpha, x, incx, a,
-                                                           lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dsyr_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, a, lda, dependencies);
 }
 
 sycl::event syr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  float alpha, const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                  float *a, std::int64_t lda, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssyr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ssyr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event syr2(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, std::int64_t n,
                  double alpha, const double *x, std::int64_t incx, const double *y,
                  std::int64_t incy, double *a, std::int64_t lda,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsyr2_usm_sycl(queue, upper_lower, n, alpha, x, incx,
-                                                            y, incy, a, lda, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dsyr2_usm_sycl, queue,
+                                upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
 }
 
 sycl::event tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const float *a, std::int64_t lda,
                  float *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_stbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_stbmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const double *a, std::int64_t lda,
                  double *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dtbmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<float> *a,
                  std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ctbmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<double> *a,
                  std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztbmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ztbmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const float *a, std::int64_t lda,
                  float *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_stbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_stbsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const double *a, std::int64_t lda,
                  double *x, std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dtbsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<float> *a,
                  std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ctbsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tbsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, std::int64_t k, const std::complex<double> *a,
                  std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztbsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            k, a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ztbsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, k, a, lda, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float *a, float *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_stpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_stpmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double *a, double *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dtpmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float> *a,
                  std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ctpmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double> *a,
                  std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztpmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ztpmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float *a, float *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_stpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_stpsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double *a, double *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dtpsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float> *a,
                  std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ctpsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event tpsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double> *a,
                  std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztpsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ztpsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float *a, std::int64_t lda, float *x,
                  std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_strmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_strmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double *a, std::int64_t lda, double *x,
                  std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtrmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dtrmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float> *a, std::int64_t lda,
                  std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctrmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ctrmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trmv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double> *a, std::int64_t lda,
                  std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztrmv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ztrmv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const float *a, std::int64_t lda, float *x,
                  std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_strsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_strsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const double *a, std::int64_t lda, double *x,
                  std::int64_t incx, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtrsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dtrsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<float> *a, std::int64_t lda,
                  std::complex<float> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctrsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ctrsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event trsv(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  diag unit_diag, std::int64_t n, const std::complex<double> *a, std::int64_t lda,
                  std::complex<double> *x, std::int64_t incx,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztrsv_usm_sycl(queue, upper_lower, trans, unit_diag, n,
-                                                            a, lda, x, incx, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ztrsv_usm_sycl, queue,
+                                upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *a,
                  std::int64_t lda, const float *b, std::int64_t ldb, float beta, float *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sgemm_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *a,
                  std::int64_t lda, const double *b, std::int64_t ldb, double beta, double *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dgemm_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -6646,8 +7041,9 @@ sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cgemm_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -6655,8 +7051,9 @@ sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zgemm_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
@@ -6664,24 +7061,27 @@ sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans
                  const sycl::half *a, std::int64_t lda, const sycl::half *b, std::int64_t ldb,
                  sycl::half beta, sycl::half *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_hgemm_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_hgemm_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const sycl::half *a,
                  std::int64_t lda, const sycl::half *b, std::int64_t ldb, float beta, float *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_gemm_f16f16f32_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_gemm_f16f16f32_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event gemm(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa, transpose transb,
                  std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const bfloat16 *a,
                  std::int64_t lda, const bfloat16 *b, std::int64_t ldb, float beta, float *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_gemm_bf16bf16f32_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_gemm_bf16bf16f32_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -6689,8 +7089,9 @@ sycl::event hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_chemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_chemm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -6698,24 +7099,27 @@ sycl::event hemm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zhemm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zhemm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event herk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, float alpha, const std::complex<float> *a,
                  std::int64_t lda, float beta, std::complex<float> *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cherk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cherk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event herk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, double alpha, const std::complex<double> *a,
                  std::int64_t lda, double beta, std::complex<double> *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zherk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zherk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -6723,8 +7127,9 @@ sycl::event her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                   std::int64_t ldb, float beta, std::complex<float> *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cher2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -6732,24 +7137,27 @@ sycl::event her2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
                   std::int64_t ldb, double beta, std::complex<double> *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zher2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zher2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
                  const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ssymm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  std::int64_t m, std::int64_t n, double alpha, const double *a, std::int64_t lda,
                  const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dsymm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -6757,8 +7165,9 @@ sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_csymm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -6766,24 +7175,27 @@ sycl::event symm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                  std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zsymm_usm_sycl(
-        queue, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zsymm_usm_sycl, queue,
+                                left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
                  float beta, float *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ssyrk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                  std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
                  double beta, double *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dsyrk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -6791,8 +7203,9 @@ sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<float> *a, std::int64_t lda, std::complex<float> beta,
                  std::complex<float> *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_csyrk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -6800,8 +7213,9 @@ sycl::event syrk(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lowe
                  const std::complex<double> *a, std::int64_t lda, std::complex<double> beta,
                  std::complex<double> *c, std::int64_t ldc,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zsyrk_usm_sycl(queue, upper_lower, trans, n, k, alpha,
-                                                            a, lda, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zsyrk_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upper_lower,
@@ -6809,9 +7223,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upp
                        const float **a, std::int64_t *lda, float *beta, float **c,
                        std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_ssyrk_batch_group_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upper_lower,
@@ -6819,9 +7234,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upp
                        const double **a, std::int64_t *lda, double *beta, double **c,
                        std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dsyrk_batch_group_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upper_lower,
@@ -6830,9 +7246,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upp
                        std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_csyrk_batch_group_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upper_lower,
@@ -6841,9 +7258,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo *upp
                        std::int64_t *lda, std::complex<double> *beta, std::complex<double> **c,
                        std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zsyrk_batch_group_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count, group_size,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zsyrk_batch_group_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, group_count,
+                                group_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -6851,9 +7269,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo uppe
                        std::int64_t lda, std::int64_t stride_a, float beta, float *c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_ssyrk_batch_strided_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -6861,9 +7280,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo uppe
                        const double *a, std::int64_t lda, std::int64_t stride_a, double beta,
                        double *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dsyrk_batch_strided_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -6872,9 +7292,10 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo uppe
                        std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_csyrk_batch_strided_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -6883,25 +7304,28 @@ sycl::event syrk_batch(oneapi::mkl::device libkey, sycl::queue &queue, uplo uppe
                        std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zsyrk_batch_strided_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c, ldc, stride_c,
-        batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zsyrk_batch_strided_usm_sycl,
+                                queue, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                   std::int64_t n, std::int64_t k, float alpha, const float *a, std::int64_t lda,
                   const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ssyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ssyr2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
                   std::int64_t n, std::int64_t k, double alpha, const double *a, std::int64_t lda,
                   const double *b, std::int64_t ldb, double beta, double *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dsyr2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -6909,8 +7333,9 @@ sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
                   std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
                   std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_csyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_csyr2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower, transpose trans,
@@ -6918,26 +7343,27 @@ sycl::event syr2k(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
                   std::int64_t ldb, std::complex<double> beta, std::complex<double> *c,
                   std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zsyr2k_usm_sycl(
-        queue, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zsyr2k_usm_sycl, queue,
+                                upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                dependencies);
 }
 
 sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                  const float *a, std::int64_t lda, float *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_strmm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_strmm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
                  const double *a, std::int64_t lda, double *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtrmm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dtrmm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -6945,9 +7371,9 @@ sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
                  std::complex<float> *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctrmm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ctrmm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -6955,27 +7381,27 @@ sycl::event trmm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
                  std::complex<double> *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztrmm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ztrmm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                  const float *a, std::int64_t lda, float *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_strsm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_strsm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
                  transpose trans, diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
                  const double *a, std::int64_t lda, double *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtrsm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dtrsm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -6983,9 +7409,9 @@ sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
                  std::complex<float> *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctrsm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ctrsm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right, uplo upper_lower,
@@ -6993,9 +7419,9 @@ sycl::event trsm(oneapi::mkl::device libkey, sycl::queue &queue, side left_right
                  std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
                  std::complex<double> *b, std::int64_t ldb,
                  const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztrsm_usm_sycl(queue, left_right, upper_lower, trans,
-                                                            unit_diag, m, n, alpha, a, lda, b, ldb,
-                                                            dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_ztrsm_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -7003,9 +7429,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t n, float alpha, const float *a, std::int64_t lda,
                        std::int64_t stride_a, float *b, std::int64_t ldb, std::int64_t stride_b,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_strsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_strsm_batch_strided_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -7013,9 +7440,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t n, double alpha, const double *a, std::int64_t lda,
                        std::int64_t stride_a, double *b, std::int64_t ldb, std::int64_t stride_b,
                        std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dtrsm_batch_strided_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -7024,9 +7452,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t lda, std::int64_t stride_a, std::complex<float> *b,
                        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_ctrsm_batch_strided_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left_right,
@@ -7035,9 +7464,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side left
                        std::int64_t lda, std::int64_t stride_a, std::complex<double> *b,
                        std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztrsm_batch_strided_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, stride_a, b, ldb,
-        stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_ztrsm_batch_strided_usm_sycl,
+                                queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -7045,9 +7475,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *n, float *alpha, const float **a, std::int64_t *lda, float **b,
                        std::int64_t *ldb, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_strsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_strsm_batch_group_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -7055,9 +7486,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *n, double *alpha, const double **a, std::int64_t *lda,
                        double **b, std::int64_t *ldb, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dtrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dtrsm_batch_group_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -7066,9 +7498,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ctrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_ctrsm_batch_group_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, group_count, group_size, dependencies);
 }
 
 sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *left_right,
@@ -7077,9 +7510,10 @@ sycl::event trsm_batch(oneapi::mkl::device libkey, sycl::queue &queue, side *lef
                        std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_ztrsm_batch_group_usm_sycl(
-        queue, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b, ldb, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_ztrsm_batch_group_usm_sycl, queue,
+                                left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                                ldb, group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *transa,
@@ -7088,9 +7522,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t *ldb, float *beta, float **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_sgemm_batch_group_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *transa,
@@ -7099,9 +7534,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t *ldb, double *beta, double **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dgemm_batch_group_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *transa,
@@ -7110,9 +7546,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        const std::complex<float> **b, std::int64_t *ldb, std::complex<float> *beta,
                        std::complex<float> **c, std::int64_t *ldc, std::int64_t group_count,
                        std::int64_t *group_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_cgemm_batch_group_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *transa,
@@ -7122,9 +7559,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::complex<double> *beta, std::complex<double> **c, std::int64_t *ldc,
                        std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zgemm_batch_group_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose *transa,
@@ -7133,9 +7571,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        const sycl::half **b, std::int64_t *ldb, sycl::half *beta, sycl::half **c,
                        std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_hgemm_batch_group_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, group_count,
-        group_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_hgemm_batch_group_usm_sycl, queue,
+                                transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7144,9 +7583,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        const float *b, std::int64_t ldb, std::int64_t stride_b, float beta,
                        float *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_sgemm_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7155,9 +7595,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        const double *b, std::int64_t ldb, std::int64_t stride_b, double beta,
                        double *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dgemm_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7167,9 +7608,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t stride_b, std::complex<float> beta, std::complex<float> *c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_cgemm_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7179,9 +7621,10 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t stride_b, std::complex<double> beta, std::complex<double> *c,
                        std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zgemm_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7191,27 +7634,28 @@ sycl::event gemm_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                        std::int64_t stride_b, sycl::half beta, sycl::half *c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_hgemm_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_hgemm_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
                   transpose transa, transpose transb, std::int64_t n, std::int64_t k, float alpha,
                   const float *a, std::int64_t lda, const float *b, std::int64_t ldb, float beta,
                   float *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_sgemmt_usm_sycl(queue, upper_lower, transa, transb, n,
-                                                             k, alpha, a, lda, b, ldb, beta, c, ldc,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_sgemmt_usm_sycl, queue,
+                                upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, dependencies);
 }
 
 sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
                   transpose transa, transpose transb, std::int64_t n, std::int64_t k, double alpha,
                   const double *a, std::int64_t lda, const double *b, std::int64_t ldb, double beta,
                   double *c, std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dgemmt_usm_sycl(queue, upper_lower, transa, transb, n,
-                                                             k, alpha, a, lda, b, ldb, beta, c, ldc,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dgemmt_usm_sycl, queue,
+                                upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, dependencies);
 }
 
 sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -7220,9 +7664,9 @@ sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
                   std::complex<float> *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cgemmt_usm_sycl(queue, upper_lower, transa, transb, n,
-                                                             k, alpha, a, lda, b, ldb, beta, c, ldc,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cgemmt_usm_sycl, queue,
+                                upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, dependencies);
 }
 
 sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_lower,
@@ -7231,9 +7675,9 @@ sycl::event gemmt(oneapi::mkl::device libkey, sycl::queue &queue, uplo upper_low
                   const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
                   std::complex<double> *c, std::int64_t ldc,
                   const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zgemmt_usm_sycl(queue, upper_lower, transa, transb, n,
-                                                             k, alpha, a, lda, b, ldb, beta, c, ldc,
-                                                             dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zgemmt_usm_sycl, queue,
+                                upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7242,9 +7686,10 @@ sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                       std::int8_t ao, const std::uint8_t *b, std::int64_t ldb, std::uint8_t bo,
                       float beta, std::int32_t *c, std::int64_t ldc, const std::int32_t *co,
                       const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_gemm_s8u8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_gemm_s8u8s32_bias_usm_sycl, queue,
+                                transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                                beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7253,9 +7698,10 @@ sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                       std::int8_t ao, const std::int8_t *b, std::int64_t ldb, std::int8_t bo,
                       float beta, std::int32_t *c, std::int64_t ldc, const std::int32_t *co,
                       const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_gemm_s8s8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_gemm_s8s8s32_bias_usm_sycl, queue,
+                                transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                                beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7264,9 +7710,10 @@ sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                       std::uint8_t ao, const std::int8_t *b, std::int64_t ldb, std::int8_t bo,
                       float beta, std::int32_t *c, std::int64_t ldc, const std::int32_t *co,
                       const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_gemm_u8s8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_gemm_u8s8s32_bias_usm_sycl, queue,
+                                transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                                beta, c, ldc, co, dependencies);
 }
 
 sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7275,9 +7722,10 @@ sycl::event gemm_bias(oneapi::mkl::device libkey, sycl::queue &queue, transpose
                       std::uint8_t ao, const std::uint8_t *b, std::int64_t ldb, std::uint8_t bo,
                       float beta, std::int32_t *c, std::int64_t ldc, const std::int32_t *co,
                       const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_gemm_u8u8s32_bias_usm_sycl(
-        queue, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo, beta, c, ldc, co,
-        dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_gemm_u8u8s32_bias_usm_sycl, queue,
+                                transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                                beta, c, ldc, co, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -7285,8 +7733,10 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            std::int64_t lda, std::int64_t stride_a, float *b, std::int64_t ldb,
                            std::int64_t stride_b, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_somatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_somatcopy_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -7294,8 +7744,10 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb,
                            std::int64_t stride_b, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_domatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_domatcopy_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -7303,8 +7755,10 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            const std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
                            std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
                            std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_comatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_comatcopy_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -7312,24 +7766,30 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            const std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
                            std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
                            std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zomatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zomatcopy_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, stride_a, b, ldb, stride_b,
+                                batch_size, dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                            std::int64_t m, std::int64_t n, float alpha, float *ab, std::int64_t lda,
                            std::int64_t ldb, std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_simatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_simatcopy_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                            std::int64_t m, std::int64_t n, double alpha, double *ab,
                            std::int64_t lda, std::int64_t ldb, std::int64_t stride,
                            std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dimatcopy_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -7337,8 +7797,10 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
                            std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_cimatcopy_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
@@ -7346,8 +7808,10 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue &queue, trans
                            std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
                            std::int64_t stride, std::int64_t batch_size,
                            const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zimatcopy_batch_strided_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zimatcopy_batch_strided_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, stride, batch_size,
+                                dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7356,9 +7820,10 @@ sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transp
                           const float *b, std::int64_t ldb, std::int64_t stride_b, float *c,
                           std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                           const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_somatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_somatadd_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7367,9 +7832,10 @@ sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transp
                           const double *b, std::int64_t ldb, std::int64_t stride_b, double *c,
                           std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
                           const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_domatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_domatadd_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7379,9 +7845,10 @@ sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transp
                           const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
                           std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
                           std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_comatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_comatadd_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7391,86 +7858,89 @@ sycl::event omatadd_batch(oneapi::mkl::device libkey, sycl::queue &queue, transp
                           const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
                           std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
                           std::int64_t batch_size, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zomatadd_batch_strided_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb, stride_b, c, ldc,
-        stride_c, batch_size, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zomatadd_batch_strided_usm_sycl,
+                                queue, transa, transb, m, n, alpha, a, lda, stride_a, beta, b, ldb,
+                                stride_b, c, ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, float alpha, const float *a, std::int64_t lda,
                      float *b, std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_somatcopy_usm_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_somatcopy_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, double alpha, const double *a,
                      std::int64_t lda, double *b, std::int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_domatcopy_usm_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_domatcopy_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<float> alpha,
                      const std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
                      std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_comatcopy_usm_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_comatcopy_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event omatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<double> alpha,
                      const std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
                      std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zomatcopy_usm_sycl(queue, trans, m, n, alpha, a, lda,
-                                                                b, ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zomatcopy_usm_sycl, queue,
+                                trans, m, n, alpha, a, lda, b, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, float alpha, float *ab, std::int64_t lda,
                      std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_simatcopy_usm_sycl(queue, trans, m, n, alpha, ab, lda,
-                                                                ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_simatcopy_usm_sycl, queue,
+                                trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, double alpha, double *ab, std::int64_t lda,
                      std::int64_t ldb, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_dimatcopy_usm_sycl(queue, trans, m, n, alpha, ab, lda,
-                                                                ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_dimatcopy_usm_sycl, queue,
+                                trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<float> alpha,
                      std::complex<float> *ab, std::int64_t lda, std::int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_cimatcopy_usm_sycl(queue, trans, m, n, alpha, ab, lda,
-                                                                ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_cimatcopy_usm_sycl, queue,
+                                trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event imatcopy(oneapi::mkl::device libkey, sycl::queue &queue, transpose trans,
                      std::int64_t m, std::int64_t n, std::complex<double> alpha,
                      std::complex<double> *ab, std::int64_t lda, std::int64_t ldb,
                      const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zimatcopy_usm_sycl(queue, trans, m, n, alpha, ab, lda,
-                                                                ldb, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zimatcopy_usm_sycl, queue,
+                                trans, m, n, alpha, ab, lda, ldb, dependencies);
 }
 
 sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                     transpose transb, std::int64_t m, std::int64_t n, float alpha, const float *a,
                     std::int64_t lda, float beta, const float *b, std::int64_t ldb, float *c,
                     std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_somatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_somatadd_usm_sycl, queue,
+                                transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                                dependencies);
 }
 
 sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
                     transpose transb, std::int64_t m, std::int64_t n, double alpha, const double *a,
                     std::int64_t lda, double beta, const double *b, std::int64_t ldb, double *c,
                     std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_domatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_domatadd_usm_sycl, queue,
+                                transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                                dependencies);
 }
 
 sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7478,8 +7948,9 @@ sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose tr
                     const std::complex<float> *a, std::int64_t lda, std::complex<float> beta,
                     const std::complex<float> *b, std::int64_t ldb, std::complex<float> *c,
                     std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_comatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_comatadd_usm_sycl, queue,
+                                transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                                dependencies);
 }
 
 sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose transa,
@@ -7487,8 +7958,9 @@ sycl::event omatadd(oneapi::mkl::device libkey, sycl::queue &queue, transpose tr
                     const std::complex<double> *a, std::int64_t lda, std::complex<double> beta,
                     const std::complex<double> *b, std::int64_t ldb, std::complex<double> *c,
                     std::int64_t ldc, const std::vector<sycl::event> &dependencies) {
-    return function_tables[libkey].row_major_zomatadd_usm_sycl(
-        queue, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc, dependencies);
+    return function_tables.call(libkey, &blas_function_table_t::row_major_zomatadd_usm_sycl, queue,
+                                transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc,
+                                dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -7496,8 +7968,10 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            std::int64_t* lda, float** b, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].row_major_somatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_somatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -7505,8 +7979,10 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            std::int64_t* lda, double** b, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].row_major_domatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_domatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -7514,8 +7990,10 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            const std::complex<float>** a, std::int64_t* lda,
                            std::complex<float>** b, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].row_major_comatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_comatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -7523,24 +8001,30 @@ sycl::event omatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            const std::complex<double>** a, std::int64_t* lda,
                            std::complex<double>** b, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].row_major_zomatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zomatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, a, lda, b, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
                            std::int64_t* m, std::int64_t* n, float* alpha, float** ab,
                            std::int64_t* lda, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].row_major_simatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_simatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
                            std::int64_t* m, std::int64_t* n, double* alpha, double** ab,
                            std::int64_t* lda, std::int64_t* ldb, std::int64_t group_count,
                            std::int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].row_major_dimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_dimatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -7548,8 +8032,10 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            std::complex<float>** ab, std::int64_t* lda, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].row_major_cimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_cimatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, transpose* trans,
@@ -7557,12 +8043,27 @@ sycl::event imatcopy_batch(oneapi::mkl::device libkey, sycl::queue& queue, trans
                            std::complex<double>** ab, std::int64_t* lda, std::int64_t* ldb,
                            std::int64_t group_count, std::int64_t* groupsize,
                            const std::vector<sycl::event>& dependencies) {
-    return function_tables[libkey].row_major_zimatcopy_batch_group_usm_sycl(
-        queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize, dependencies);
+    return function_tables.call(libkey,
+                                &blas_function_table_t::row_major_zimatcopy_batch_group_usm_sycl,
+                                queue, trans, m, n, alpha, ab, lda, ldb, group_count, groupsize,
+                                dependencies);
 }
 
 } //namespace detail
 } //namespace row_major
+
+namespace detail {
+
+static void preload_tables(oneapi::mkl::device libkey) {
+    column_major::detail::function_tables.load_all(libkey);
+    row_major::detail::function_tables.load_all(libkey);
+}
+
+// Defined after both function tables, which it may load during static
+//  initialization.
+static oneapi::mkl::detail::preload_registration registration(domain::blas, preload_tables);
+
+} //namespace detail
 } //namespace blas
 } //namespace mkl
 } //namespace oneapi
@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_CALL_TRACE_HPP_
+#define _ONEMKL_CALL_TRACE_HPP_
+
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#ifdef __linux__
+#include <cxxabi.h>
+#include <dlfcn.h>
+#endif
+
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+
+/**
+ * Tracing of the run-time dispatched calls, requested with the ONEMKL_VERBOSE
+ * environment variable:
+ *
+ * - unset or "0": no tracing. The dispatch path only tests a flag.
+ * - "1": every call is printed to std::cerr with its arguments, the backend
+ *   library that served it and the host time taken to submit it.
+ * - "2": the call is also waited for, and the time to its completion is
+ *   printed: the device execution time from event profiling when the call
+ *   returns an event and the queue has profiling enabled, the host time until
+ *   the queue is idle otherwise. This serializes the calls of the application.
+ *
+ * Buffer and USM arguments are printed as their element type and size, e.g.
+ * float[4096] and float*, transpose, uplo, diag and side as their one-letter
+ * names, other enumerations as integers.
+ */
+enum class verbose_mode { none, submit, complete };
+
+inline verbose_mode get_verbose_mode() {
+    static const verbose_mode mode = []() {
+        const char *env = std::getenv("ONEMKL_VERBOSE");
+        if (env == nullptr || *env == '\0' || std::strcmp(env, "0") == 0)
+            return verbose_mode::none;
+        return (std::strcmp(env, "2") == 0) ? verbose_mode::complete : verbose_mode::submit;
+    }();
+    return mode;
+}
+
+template <typename T>
+inline const char *trace_type_name() {
+    if (std::is_same<T, float>::value)
+        return "float";
+    if (std::is_same<T, double>::value)
+        return "double";
+    if (std::is_same<T, std::complex<float>>::value)
+        return "complex<float>";
+    if (std::is_same<T, std::complex<double>>::value)
+        return "complex<double>";
+    if (std::is_same<T, sycl::half>::value)
+        return "half";
+    if (std::is_same<T, oneapi::mkl::bfloat16>::value)
+        return "bfloat16";
+    if (std::is_same<T, std::int64_t>::value)
+        return "int64";
+    if (std::is_same<T, std::int32_t>::value)
+        return "int32";
+    if (std::is_same<T, std::uint32_t>::value)
+        return "uint32";
+    if (std::is_same<T, std::int8_t>::value)
+        return "int8";
+    if (std::is_same<T, std::uint8_t>::value)
+        return "uint8";
+    if (std::is_pointer<T>::value)
+        return "pointer";
+    return "data";
+}
+
+// Argument printed as its text, e.g. the distribution of an RNG call.
+struct trace_label {
+    const char *text;
+};
+
+template <typename T, typename = void>
+struct trace_argument {
+    static void print(std::ostream &out, const T &) {
+        out << '?';
+    }
+};
+
+template <typename T>
+struct trace_argument<T, std::enable_if_t<std::is_arithmetic<T>::value>> {
+    static void print(std::ostream &out, const T &value) {
+        out << +value;
+    }
+};
+
+template <typename T>
+struct trace_argument<std::complex<T>> {
+    static void print(std::ostream &out, const std::complex<T> &value) {
+        out << value;
+    }
+};
+
+template <typename T>
+struct trace_argument<T, std::enable_if_t<std::is_enum<T>::value>> {
+    static void print(std::ostream &out, const T &value) {
+        out << static_cast<long long>(value);
+    }
+};
+
+template <>
+struct trace_argument<transpose> {
+    static void print(std::ostream &out, const transpose &value) {
+        out << (value == transpose::nontrans ? 'N' : value == transpose::trans ? 'T' : 'C');
+    }
+};
+
+template <>
+struct trace_argument<uplo> {
+    static void print(std::ostream &out, const uplo &value) {
+        out << (value == uplo::upper ? 'U' : 'L');
+    }
+};
+
+template <>
+struct trace_argument<diag> {
+    static void print(std::ostream &out, const diag &value) {
+        out << (value == diag::nonunit ? 'N' : 'U');
+    }
+};
+
+template <>
+struct trace_argument<side> {
+    static void print(std::ostream &out, const side &value) {
+        out << (value == side::left ? 'L' : 'R');
+    }
+};
+
+template <typename T>
+struct trace_argument<sycl::buffer<T, 1>> {
+    static void print(std::ostream &out, const sycl::buffer<T, 1> &value) {
+        out << trace_type_name<T>() << '[' << value.size() << ']';
+    }
+};
+
+template <typename T>
+struct trace_argument<T *> {
+    static void print(std::ostream &out, T *) {
+        out << trace_type_name<std::remove_cv_t<T>>() << '*';
+    }
+};
+
+template <typename T>
+struct trace_argument<std::initializer_list<T>> {
+    static void print(std::ostream &out, const std::initializer_list<T> &value) {
+        out << '{';
+        for (auto it = value.begin(); it != value.end(); ++it)
+            out << (it == value.begin() ? "" : ",") << +*it;
+        out << '}';
+    }
+};
+
+template <>
+struct trace_argument<std::vector<sycl::event>> {
+    static void print(std::ostream &out, const std::vector<sycl::event> &value) {
+        out << "deps[" << value.size() << ']';
+    }
+};
+
+template <>
+struct trace_argument<trace_label> {
+    static void print(std::ostream &out, const trace_label &value) {
+        out << value.text;
+    }
+};
+
+// The queue is not printed; it is the first argument of every call.
+template <>
+struct trace_argument<sycl::queue> {
+    static void print(std::ostream &, const sycl::queue &) {}
+};
+
+template <typename T>
+void print_trace_argument(std::ostream &out, bool &first, const T &value) {
+    using type = std::decay_t<T>;
+    if (std::is_same<type, sycl::queue>::value)
+        return;
+    if (!first)
+        out << ',';
+    first = false;
+    trace_argument<type>::print(out, value);
+}
+
+template <typename... Args>
+sycl::queue *find_trace_queue(Args &... args) {
+    sycl::queue *queue = nullptr;
+    auto find = [&](auto &value) {
+        if constexpr (std::is_same<std::decay_t<decltype(value)>, sycl::queue>::value) {
+            if (!queue)
+                queue = const_cast<sycl::queue *>(&value);
+        }
+    };
+    (find(args), ...);
+    return queue;
+}
+
+// Name of the backend function at address, without its namespaces up to the
+//  domain and without its parameters, e.g. mklcpu::column_major::gemm.
+inline std::string trace_routine_name(const char *domain, const void *address) {
+#ifdef __linux__
+    Dl_info info;
+    if (dladdr(address, &info) && info.dli_sname) {
+        int status = 0;
+        char *demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        std::string name = (status == 0 && demangled) ? demangled : info.dli_sname;
+        std::free(demangled);
+        name = name.substr(0, name.find('('));
+        const std::string prefix = std::string("oneapi::mkl::") + domain + "::";
+        if (name.compare(0, prefix.size(), prefix) == 0)
+            name.erase(0, prefix.size());
+        return name;
+    }
+#endif
+    return "unknown";
+}
+
+// Prints the trace of one call, started at construction.
+class call_trace {
+    using clock = std::chrono::steady_clock;
+
+public:
+    call_trace() : start_(clock::now()) {}
+
+    // Ends the submission of the call and, in complete mode, waits for result
+    //  or for the queue.
+    template <typename Result>
+    void submitted(sycl::queue *queue, Result *result) {
+        submit_ = clock::now();
+        if (get_verbose_mode() != verbose_mode::complete)
+            return;
+        if constexpr (std::is_same<Result, sycl::event>::value) {
+            result->wait();
+            if (queue && queue->has_property<sycl::property::queue::enable_profiling>()) {
+                device_ns_ =
+                    static_cast<double>(
+                        result->template get_profiling_info<
+                            sycl::info::event_profiling::command_end>() -
+                        result->template get_profiling_info<
+                            sycl::info::event_profiling::command_start>());
+            }
+        }
+        else if (queue)
+            queue->wait();
+        complete_ = clock::now();
+    }
+
+    template <typename... Args>
+    void print(const char *domain, const char *device, const void *function, const char *library,
+               const char *error, const Args &... args) const {
+        print(domain, device, trace_routine_name(domain, function), library, error, args...);
+    }
+
+    template <typename... Args>
+    void print(const char *domain, const char *device, const std::string &routine,
+               const char *library, const char *error, const Args &... args) const {
+        std::ostringstream out;
+        out << "oneMKL verbose: " << domain << ' ' << routine << '(';
+        bool first = true;
+        (print_trace_argument(out, first, args), ...);
+        out << ") " << (library ? library : "unknown") << ' ' << device;
+        if (error) {
+            out << " failed: " << error << '\n';
+            std::cerr << out.str();
+            return;
+        }
+        out << " submit " << microseconds(submit_ - start_) << " us";
+        if (get_verbose_mode() == verbose_mode::complete) {
+            if (device_ns_ >= 0.0)
+                out << " device " << device_ns_ * 1e-3 << " us";
+            else
+                out << " complete " << microseconds(complete_ - start_) << " us";
+        }
+        out << '\n';
+        std::cerr << out.str();
+    }
+
+private:
+    static double microseconds(clock::duration d) {
+        return std::chrono::duration<double, std::micro>(d).count();
+    }
+
+    clock::time_point start_, submit_, complete_;
+    double device_ns_ = -1.0;
+};
+
+} //namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_CALL_TRACE_HPP_
@@ -20,12 +20,24 @@
 #ifndef _LOADER_HPP_
 #define _LOADER_HPP_
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
 
 #include "oneapi/mkl/detail/backends_table.hpp"
 #include "oneapi/mkl/detail/exceptions.hpp"
 
+#include "call_trace.hpp"
+
 #define SPEC_VERSION 1
 
 #ifdef __linux__
@@ -48,6 +60,35 @@ namespace oneapi {
 namespace mkl {
 namespace detail {
 
+static std::map<oneapi::mkl::domain, const char *> domain_names = {
+    { oneapi::mkl::domain::blas, "blas" },
+    { oneapi::mkl::domain::lapack, "lapack" },
+    { oneapi::mkl::domain::rng, "rng" }
+};
+
+static std::map<oneapi::mkl::device, const char *> device_names = {
+    { oneapi::mkl::device::x86cpu, "x86cpu" },
+    { oneapi::mkl::device::intelgpu, "intelgpu" },
+    { oneapi::mkl::device::nvidiagpu, "nvidiagpu" },
+    { oneapi::mkl::device::amdgpu, "amdgpu" }
+};
+
+// Backend preloading requested with the ONEMKL_PRELOAD environment variable:
+//  unset or "0" loads backends on first use, "verbose" preloads them at startup
+//  and reports the load time of every library, any other value preloads them
+//  silently.
+enum class preload_mode { none, silent, verbose };
+
+inline preload_mode get_preload_mode() {
+    static const preload_mode mode = []() {
+        const char *env = std::getenv("ONEMKL_PRELOAD");
+        if (env == nullptr || *env == '\0' || std::strcmp(env, "0") == 0)
+            return preload_mode::none;
+        return (std::strcmp(env, "verbose") == 0) ? preload_mode::verbose : preload_mode::silent;
+    }();
+    return mode;
+}
+
 template <oneapi::mkl::domain domain_id, typename function_table_t>
 class table_initializer {
     struct handle_deleter {
@@ -59,14 +100,113 @@ class table_initializer {
     using dlhandle = std::unique_ptr<LIB_TYPE, handle_deleter>;
 
 public:
+    // Lookups of a loaded table are a single acquire load. The first call for a
+    //  device loads its backend under a lock; a failed load is retried by the
+    //  next call.
     function_table_t &operator[](oneapi::mkl::device key) {
-        auto lib = tables.find(key);
-        if (lib != tables.end())
-            return lib->second;
-        return add_table(key);
+        auto &slot = slots[static_cast<std::size_t>(key)];
+        if (function_table_t *table = slot.backends[0].table.load(std::memory_order_acquire))
+            return *table;
+        return *load_backend(key, slot, 0);
+    }
+
+    // Calls entry with args on the first backend of the device that implements
+    //  it. The libraries listed for a device in backends_table.hpp form a
+    //  fallback chain: when a backend throws oneapi::mkl::unimplemented before
+    //  submitting any work, the call is retried on the next library of the
+    //  list, which is loaded on first use, and the entry keeps using that
+    //  backend for later calls. The call is traced when ONEMKL_VERBOSE is set.
+    template <typename function_t, typename... Args>
+    auto call(oneapi::mkl::device key, function_t function_table_t::*entry, Args &&... args) {
+        if (get_verbose_mode() != verbose_mode::none)
+            return traced_call(key, entry, args...);
+        std::size_t backend;
+        return dispatch(key, entry, backend, args...);
+    }
+
+    // Name of the library that serves entry on the device, for tracing.
+    template <typename function_t>
+    const char *library(oneapi::mkl::device key, function_t function_table_t::*entry) {
+        auto &slot = slots[static_cast<std::size_t>(key)];
+        const std::size_t backend =
+            slot.resolved[entry_index(slot, entry)].load(std::memory_order_acquire);
+        return slot.backends[backend].libname;
+    }
+
+    // Loads every library listed for the device.
+    void load_all(oneapi::mkl::device key) {
+        auto &slot = slots[static_cast<std::size_t>(key)];
+        (*this)[key];
+        for (std::size_t backend = 1; backend < max_backends; backend++) {
+            if (!load_backend(key, slot, backend))
+                break;
+        }
     }
 
 private:
+    // Calls entry as described for call, setting backend to the position of
+    //  the backend that ran it.
+    template <typename function_t, typename... Args>
+    auto dispatch(oneapi::mkl::device key, function_t function_table_t::*entry,
+                  std::size_t &backend, Args &... args) {
+        auto &slot = slots[static_cast<std::size_t>(key)];
+        auto &resolved = slot.resolved[entry_index(slot, entry)];
+        backend = resolved.load(std::memory_order_acquire);
+        while (true) {
+            function_table_t *table =
+                (backend == 0) ? &(*this)[key]
+                               : slot.backends[backend].table.load(std::memory_order_acquire);
+            try {
+                return (table->*entry)(args...);
+            }
+            catch (const oneapi::mkl::unimplemented &) {
+                if (backend + 1 >= max_backends || !load_backend(key, slot, backend + 1))
+                    throw;
+            }
+            backend++;
+            std::uint8_t current = resolved.load(std::memory_order_relaxed);
+            while (current < backend &&
+                   !resolved.compare_exchange_weak(current, static_cast<std::uint8_t>(backend),
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed)) {}
+        }
+    }
+
+    template <typename function_t, typename... Args>
+    auto traced_call(oneapi::mkl::device key, function_t function_table_t::*entry,
+                     Args &... args) {
+        auto &slot = slots[static_cast<std::size_t>(key)];
+        std::size_t backend = 0;
+        auto print = [&](const call_trace &trace, const char *error) {
+            const backend_slot &served = slot.backends[backend];
+            const function_table_t *table = served.table.load(std::memory_order_acquire);
+            const void *function =
+                table ? reinterpret_cast<const void *>(table->*entry) : nullptr;
+            trace.print(domain_names[domain_id], device_names[key], function, served.libname,
+                        error, args...);
+        };
+        using result_t = decltype(dispatch(key, entry, backend, args...));
+        sycl::queue *queue = find_trace_queue(args...);
+        call_trace trace;
+        try {
+            if constexpr (std::is_void<result_t>::value) {
+                dispatch(key, entry, backend, args...);
+                trace.submitted<void>(queue, nullptr);
+                print(trace, nullptr);
+            }
+            else {
+                result_t result = dispatch(key, entry, backend, args...);
+                trace.submitted(queue, &result);
+                print(trace, nullptr);
+                return result;
+            }
+        }
+        catch (const std::exception &e) {
+            print(trace, e.what());
+            throw;
+        }
+    }
+
 #ifdef _WIN64
     // Create a string with last error message
     std::string GetLastErrorStdStr() {
@@ -90,15 +230,67 @@ private:
     }
 #endif
 
-    function_table_t &add_table(oneapi::mkl::device key) {
+    // Most libraries listed for one device and domain.
+    static constexpr std::size_t max_backends = 4;
+    // Upper bound on the number of entries of a function table.
+    static constexpr std::size_t max_entries = sizeof(function_table_t) / sizeof(void (*)()) + 1;
+
+    struct backend_slot {
+        std::atomic<function_table_t *> table{ nullptr };
+        function_table_t loaded_table;
         dlhandle handle;
-        // check all available libraries for the key(device)
-        for (const char *libname : libraries[domain_id][key]) {
-            handle = dlhandle{ ::GET_LIB_HANDLE(libname) };
-            if (handle)
-                break;
+        // Name of the library the table was loaded from, for tracing.
+        const char *libname = nullptr;
+    };
+
+    struct table_slot {
+        // backends[0] serves every entry until one of its routines is found
+        //  unimplemented.
+        std::array<backend_slot, max_backends> backends;
+        // Position in the library list of the next library to load, guarded
+        //  by load_mutex.
+        std::size_t next_library = 0;
+        // Backend serving each entry, indexed by entry_index.
+        std::array<std::atomic<std::uint8_t>, max_entries> resolved{};
+    };
+
+    template <typename function_t>
+    static std::size_t entry_index(table_slot &slot, function_t function_table_t::*entry) {
+        const function_table_t &table = slot.backends[0].loaded_table;
+        return static_cast<std::size_t>(reinterpret_cast<const char *>(&(table.*entry)) -
+                                        reinterpret_cast<const char *>(&table)) /
+               sizeof(void (*)());
+    }
+
+    // Loads backend number backend of the device from the next library of its
+    //  list that can be opened. Returns nullptr when a fallback backend is
+    //  requested and the list is exhausted; failing to load the first backend
+    //  throws.
+    function_table_t *load_backend(oneapi::mkl::device key, table_slot &slot, std::size_t backend) {
+        std::lock_guard<std::mutex> lock(load_mutex);
+        backend_slot &loaded = slot.backends[backend];
+        if (function_table_t *table = loaded.table.load(std::memory_order_relaxed))
+            return table;
+
+        auto start = std::chrono::steady_clock::now();
+        dlhandle handle;
+        const char *loaded_libname = nullptr;
+        std::size_t next_library = slot.next_library;
+        // check the remaining libraries for the key(device)
+        auto domain_libraries = libraries.find(domain_id);
+        if (domain_libraries != libraries.end()) {
+            auto device_libraries = domain_libraries->second.find(key);
+            if (device_libraries != domain_libraries->second.end()) {
+                const auto &libnames = device_libraries->second;
+                for (; next_library < libnames.size() && !handle; next_library++) {
+                    handle = dlhandle{ ::GET_LIB_HANDLE(libnames[next_library]) };
+                    loaded_libname = libnames[next_library];
+                }
+            }
         }
         if (!handle) {
+            if (backend != 0)
+                return nullptr;
             std::cerr << ERROR_MSG << '\n';
             throw mkl::backend_not_found();
         }
@@ -112,13 +304,57 @@ private:
         if (t->version != SPEC_VERSION)
             throw mkl::specification_mismatch();
 
-        handles[key] = std::move(handle);
-        tables[key] = *t;
-        return *t;
+        slot.next_library = next_library;
+        loaded.handle = std::move(handle);
+        loaded.loaded_table = *t;
+        loaded.libname = loaded_libname;
+        loaded.table.store(&loaded.loaded_table, std::memory_order_release);
+
+        if (get_preload_mode() == preload_mode::verbose) {
+            auto stop = std::chrono::steady_clock::now();
+            std::cerr << "oneMKL: loaded " << loaded_libname << " for " << domain_names[domain_id]
+                      << " on " << device_names[key] << " in "
+                      << std::chrono::duration<double, std::milli>(stop - start).count()
+                      << " ms\n";
+        }
+        return &loaded.loaded_table;
     }
 
-    std::map<oneapi::mkl::device, function_table_t> tables;
-    std::map<oneapi::mkl::device, dlhandle> handles;
+    std::array<table_slot, num_devices> slots;
+    std::mutex load_mutex;
+};
+
+// Loads the function tables of a domain for a device. Every domain loader
+//  registers one with a preload_registration, so that oneapi::mkl::preload only
+//  reaches the domains built into the dispatcher library.
+using preload_function_t = void (*)(oneapi::mkl::device);
+
+inline std::map<oneapi::mkl::domain, preload_function_t> &preload_functions() {
+    static std::map<oneapi::mkl::domain, preload_function_t> functions;
+    return functions;
+}
+
+// Registers the preload function of a domain during static initialization and,
+//  when ONEMKL_PRELOAD is set, loads the backends of every device configured for
+//  the domain. A backend that fails to load at startup is reported and loaded
+//  again on first use, which throws as usual.
+struct preload_registration {
+    preload_registration(oneapi::mkl::domain domain_id, preload_function_t function) {
+        preload_functions()[domain_id] = function;
+        if (get_preload_mode() == preload_mode::none)
+            return;
+        for (const auto &device_libraries : libraries[domain_id]) {
+            if (device_libraries.second.empty())
+                continue;
+            try {
+                function(device_libraries.first);
+            }
+            catch (const std::exception &e) {
+                std::cerr << "oneMKL: failed to preload " << domain_names[domain_id] << " on "
+                          << device_names[device_libraries.first] << ": " << e.what() << '\n';
+            }
+        }
+    }
 };
 
 } //namespace detail
@@ -0,0 +1,332 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_HOST_THREAD_POOL_HPP_
+#define _ONEMKL_HOST_THREAD_POOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+
+/**
+ * Work-stealing pool of host threads shared by the backends that compute on
+ * the host inside their host_tasks (netlib BLAS, mklcpu RNG).
+ *
+ * parallel_for splits a call into chunks that are queued on the workers; the
+ * calling thread processes chunks as well until all of them are done. Idle
+ * threads steal chunks from the queues of the others, so uneven chunks
+ * balance out and a parallel_for nested in a chunk cannot deadlock. The
+ * workers are started on first use.
+ *
+ * The number of threads taking part in a call, the calling thread included,
+ * defaults to the number of hardware threads and is set with the
+ * ONEMKL_HOST_NUM_THREADS environment variable. ONEMKL_HOST_AFFINITY pins the
+ * workers to a list of CPUs such as "0-7,16-23" (Linux only): worker i runs on
+ * CPU i + 1 of the list, the first one being left to the calling thread.
+ *
+ * Code running in a chunk sees in_parallel_region() return true. Backends use
+ * it to keep the threading layer of their vendor library (OpenMP or TBB)
+ * sequential inside chunks, so a call never runs more threads than the pool.
+ */
+class host_thread_pool {
+public:
+    static host_thread_pool &instance() {
+        static host_thread_pool pool;
+        return pool;
+    }
+
+    // Number of threads taking part in a parallel_for, the caller included.
+    int64_t num_threads() const {
+        return num_threads_;
+    }
+
+    // Whether the calling thread is running a chunk of a parallel_for.
+    static bool in_parallel_region() {
+        return region_depth() > 0;
+    }
+
+    // Splits [0, count) into contiguous ranges of about grain items or more
+    //  and calls f(begin, end) for each range on the pool. At most max_threads
+    //  threads work on the call when max_threads > 0. Exceptions thrown by f
+    //  are rethrown to the caller once all ranges are done.
+    template <typename F>
+    void parallel_for(int64_t count, int64_t grain, int64_t max_threads, F &&f) {
+        if (count <= 0)
+            return;
+        grain = std::max<int64_t>(grain, 1);
+        const int64_t threads =
+            (max_threads > 0) ? std::min(max_threads, num_threads_) : num_threads_;
+        // Without a thread limit, extra chunks let idle threads balance the load.
+        const int64_t max_chunks = (threads < num_threads_) ? threads : threads * chunks_per_thread;
+        const int64_t chunks = std::min((count + grain - 1) / grain, max_chunks);
+        if (threads <= 1 || chunks <= 1) {
+            f(int64_t(0), count);
+            return;
+        }
+        auto range = [&](int64_t chunk) {
+            f(chunk * count / chunks, (chunk + 1) * count / chunks);
+        };
+        task_group group;
+        group.run = [](void *context, int64_t chunk) {
+            (*static_cast<decltype(range) *>(context))(chunk);
+        };
+        group.context = &range;
+        run_group(group, chunks);
+    }
+
+    ~host_thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto &worker : workers_)
+            worker.join();
+    }
+
+private:
+    // Chunks queued per thread when a call may use the whole pool.
+    static constexpr int64_t chunks_per_thread = 4;
+
+    struct task_group {
+        void (*run)(void *context, int64_t chunk);
+        void *context;
+        int64_t pending;
+        std::mutex mutex;
+        std::condition_variable done;
+        std::exception_ptr error;
+    };
+
+    struct task {
+        task_group *group;
+        int64_t chunk;
+    };
+
+    struct worker_queue {
+        std::mutex mutex;
+        std::deque<task> tasks;
+    };
+
+    host_thread_pool() {
+        int64_t num_threads = 0;
+        if (const char *env = std::getenv("ONEMKL_HOST_NUM_THREADS"))
+            num_threads = std::atoll(env);
+        if (num_threads <= 0)
+            num_threads = static_cast<int64_t>(std::thread::hardware_concurrency());
+        num_threads_ = std::max<int64_t>(num_threads, 1);
+        if (const char *env = std::getenv("ONEMKL_HOST_AFFINITY"))
+            cpus_ = parse_cpu_list(env);
+    }
+
+    // Index of the pool worker running on this thread, -1 for other threads.
+    static int64_t &worker_index() {
+        static thread_local int64_t index = -1;
+        return index;
+    }
+
+    static int &region_depth() {
+        static thread_local int depth = 0;
+        return depth;
+    }
+
+    // Parses a list of CPUs and CPU ranges such as "0-7,16-23".
+    static std::vector<int> parse_cpu_list(const char *list) {
+        std::vector<int> cpus;
+        const char *p = list;
+        while (*p != '\0') {
+            char *end;
+            long first = std::strtol(p, &end, 10);
+            if (end == p)
+                return {};
+            long last = first;
+            p = end;
+            if (*p == '-') {
+                last = std::strtol(p + 1, &end, 10);
+                if (end == p + 1)
+                    return {};
+                p = end;
+            }
+            for (long cpu = first; cpu <= last; cpu++)
+                cpus.push_back(static_cast<int>(cpu));
+            if (*p == ',')
+                p++;
+            else if (*p != '\0')
+                return {};
+        }
+        return cpus;
+    }
+
+    void start_workers() {
+        std::call_once(started_, [this]() {
+            const int64_t num_workers = num_threads_ - 1;
+            for (int64_t i = 0; i < num_workers; i++)
+                queues_.emplace_back(new worker_queue);
+            for (int64_t i = 0; i < num_workers; i++)
+                workers_.emplace_back([this, i]() { worker_loop(i); });
+        });
+    }
+
+    void worker_loop(int64_t index) {
+        worker_index() = index;
+#ifdef __linux__
+        if (!cpus_.empty()) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpus_[(index + 1) % cpus_.size()], &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        }
+#endif
+        while (true) {
+            task t;
+            if (take_task(t)) {
+                run_task(t);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            wake_.wait(lock, [this]() { return stop_ || queued_.load() > 0; });
+            if (stop_)
+                return;
+        }
+    }
+
+    // Takes the newest task of the own queue of a worker, or else steals the
+    //  oldest task of another queue.
+    bool take_task(task &t) {
+        const int64_t self = worker_index();
+        const int64_t num_queues = static_cast<int64_t>(queues_.size());
+        if (self >= 0) {
+            worker_queue &queue = *queues_[self];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                t = queue.tasks.back();
+                queue.tasks.pop_back();
+                queued_--;
+                return true;
+            }
+        }
+        const int64_t start = (self >= 0) ? self + 1 : next_queue_++;
+        for (int64_t i = 0; i < num_queues; i++) {
+            const int64_t victim = (start + i) % num_queues;
+            if (victim == self)
+                continue;
+            worker_queue &queue = *queues_[victim];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                t = queue.tasks.front();
+                queue.tasks.pop_front();
+                queued_--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static void run_task(const task &t) {
+        task_group &group = *t.group;
+        region_depth()++;
+        try {
+            group.run(group.context, t.chunk);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(group.mutex);
+            if (!group.error)
+                group.error = std::current_exception();
+        }
+        region_depth()--;
+        // The group lives on the stack of its caller, which leaves once it
+        //  has seen pending reach 0 under the mutex.
+        std::lock_guard<std::mutex> lock(group.mutex);
+        if (--group.pending == 0)
+            group.done.notify_all();
+    }
+
+    void run_group(task_group &group, int64_t chunks) {
+        start_workers();
+        group.pending = chunks;
+        // A worker queues the chunks on its own queue, for the others to
+        //  steal; any other thread deals them out to the workers.
+        const int64_t self = worker_index();
+        const int64_t num_queues = static_cast<int64_t>(queues_.size());
+        const int64_t first = (self >= 0) ? self : next_queue_++;
+        for (int64_t chunk = 1; chunk < chunks; chunk++) {
+            const int64_t index = (self >= 0) ? self : (first + chunk) % num_queues;
+            worker_queue &queue = *queues_[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back({ &group, chunk });
+        }
+        queued_ += chunks - 1;
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+        }
+        wake_.notify_all();
+
+        run_task({ &group, 0 });
+        task t;
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(group.mutex);
+                if (group.pending == 0)
+                    break;
+            }
+            if (!take_task(t))
+                break;
+            run_task(t);
+        }
+        {
+            std::unique_lock<std::mutex> lock(group.mutex);
+            group.done.wait(lock, [&group]() { return group.pending == 0; });
+        }
+        if (group.error)
+            std::rethrow_exception(group.error);
+    }
+
+    int64_t num_threads_;
+    std::vector<int> cpus_;
+    std::once_flag started_;
+    std::vector<std::unique_ptr<worker_queue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<int64_t> queued_{ 0 };
+    std::atomic<int64_t> next_queue_{ 0 };
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+};
+
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_HOST_THREAD_POOL_HPP_
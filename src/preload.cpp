@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <string>
+
+#include "oneapi/mkl/preload.hpp"
+
+#include "function_table_initializer.hpp"
+
+namespace oneapi {
+namespace mkl {
+
+void preload(oneapi::mkl::domain domain_id, oneapi::mkl::device device_id) {
+    auto &functions = detail::preload_functions();
+    auto function = functions.find(domain_id);
+    if (function == functions.end())
+        throw backend_not_found(std::string(detail::domain_names[domain_id]) +
+                                " domain is not part of this build");
+    function->second(device_id);
+}
+
+} // namespace mkl
+} // namespace oneapi
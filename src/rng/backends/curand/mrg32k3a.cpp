@@ -314,6 +314,128 @@ public:
             .wait_and_throw();
     }
 
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const exponential<float, exponential_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia_accurate>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia_accurate>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<float, beta_method::cja_accurate>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<double, beta_method::cja_accurate>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const cauchy<float, cauchy_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const cauchy<double, cauchy_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const weibull<float, weibull_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const weibull<double, weibull_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const weibull<float, weibull_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const weibull<double, weibull_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const discrete<std::int32_t, discrete_method::alias>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const discrete<std::uint32_t, discrete_method::alias>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(
+        const multinomial<std::int32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(
+        const multinomial<std::uint32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
     // USM APIs
 
     virtual sycl::event generate(
@@ -531,6 +653,167 @@ public:
         });
     }
 
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const exponential<double, exponential_method::icdf_accurate>& distr, std::int64_t n,
+        double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia_accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja_accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const cauchy<float, cauchy_method::icdf>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const cauchy<double, cauchy_method::icdf>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const weibull<float, weibull_method::icdf>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const weibull<double, weibull_method::icdf>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const weibull<float, weibull_method::icdf_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const weibull<double, weibull_method::icdf_accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const discrete<std::int32_t, discrete_method::alias>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const discrete<std::uint32_t, discrete_method::alias>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multinomial<std::int32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, std::int32_t* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multinomial<std::uint32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, std::uint32_t* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
     virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
         return new mrg32k3a_impl(this);
     }
@@ -679,6 +962,128 @@ public:
         throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
     }
 
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const exponential<float, exponential_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia_accurate>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia_accurate>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<float, beta_method::cja_accurate>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const beta<double, beta_method::cja_accurate>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const cauchy<float, cauchy_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const cauchy<double, cauchy_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const weibull<float, weibull_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const weibull<double, weibull_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const weibull<float, weibull_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const weibull<double, weibull_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const discrete<std::int32_t, discrete_method::alias>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const discrete<std::uint32_t, discrete_method::alias>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(
+        const multinomial<std::int32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(
+        const multinomial<std::uint32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+    }
+
     // USM APIs
 
     virtual sycl::event generate(
@@ -811,6 +1216,167 @@ public:
         return sycl::event{};
     }
 
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const exponential<double, exponential_method::icdf_accurate>& distr, std::int64_t n,
+        double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia_accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja_accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const cauchy<float, cauchy_method::icdf>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const cauchy<double, cauchy_method::icdf>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const weibull<float, weibull_method::icdf>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const weibull<double, weibull_method::icdf>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const weibull<float, weibull_method::icdf_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const weibull<double, weibull_method::icdf_accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const discrete<std::int32_t, discrete_method::alias>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const discrete<std::uint32_t, discrete_method::alias>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multinomial<std::int32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, std::int32_t* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(
+        const multinomial<std::uint32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, std::uint32_t* r, const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        throw oneapi::mkl::unimplemented("rng", "mrg32k3a engine");
+        return sycl::event{};
+    }
+
     virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
         throw oneapi::mkl::unimplemented("rng", "mrg32ka engine");
         return nullptr;
@@ -26,6 +26,18 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "mkl_service.h"
+#include "mkl_vsl.h"
+
+#include "oneapi/mkl/rng/distributions.hpp"
+
+#include "host_thread_pool.hpp"
+
 namespace oneapi {
 namespace mkl {
 namespace rng {
@@ -50,6 +62,239 @@ static inline void host_task(H &cgh, F f) {
     (void)host_task_internal<K>(cgh, f, 0);
 }
 
+// Makes MKL sequential on the calling thread for the lifetime of the object.
+struct mkl_sequential_scope {
+    int previous = mkl_set_num_threads_local(1);
+    ~mkl_sequential_scope() {
+        mkl_set_num_threads_local(previous);
+    }
+};
+
+// Calls f(begin, end) for contiguous ranges of [0, count) of at least grain
+//  items on the shared host thread pool. MKL runs sequentially inside the
+//  ranges, so that its own threading layer does not add threads on top of the
+//  pool.
+template <typename F>
+static inline void parallel_for(std::int64_t count, std::int64_t grain, F f) {
+    auto &pool = oneapi::mkl::detail::host_thread_pool::instance();
+    pool.parallel_for(count, grain, 0, [&](std::int64_t begin, std::int64_t end) {
+        if (!oneapi::mkl::detail::host_thread_pool::in_parallel_region()) {
+            f(begin, end);
+            return;
+        }
+        mkl_sequential_scope sequential;
+        f(begin, end);
+    });
+}
+
+// Size from which parallel_generate splits a call across the host threads,
+//  and the number of values of its chunks. The chunk size is even, so that
+//  the methods producing pairs of values keep their pairs.
+constexpr std::int64_t parallel_generate_threshold = std::int64_t(1) << 18;
+constexpr std::int64_t parallel_generate_chunk = std::int64_t(1) << 16;
+
+// Distributions whose values consume a number of outputs of the basic
+//  generator that depends on their parameters, so that it cannot be found once
+//  for the distribution: poisson, multinomial, and the rejection methods of
+//  gamma and beta.
+template <typename Distr>
+struct variable_consumption : std::false_type {};
+
+template <typename IntType, typename Method>
+struct variable_consumption<oneapi::mkl::rng::poisson<IntType, Method>> : std::true_type {};
+
+template <typename RealType, typename Method>
+struct variable_consumption<oneapi::mkl::rng::gamma<RealType, Method>> : std::true_type {};
+
+template <typename RealType, typename Method>
+struct variable_consumption<oneapi::mkl::rng::beta<RealType, Method>> : std::true_type {};
+
+template <typename IntType, typename Method>
+struct variable_consumption<oneapi::mkl::rng::multinomial<IntType, Method>> : std::true_type {};
+
+// Number of outputs of the basic generator Brng consumed by one value of the
+//  distribution Distr generated by vsl_function with method, 0 when it is not
+//  fixed. It is found on the first call for the distribution: values
+//  generated from a skipped-ahead stream must continue the serial sequence,
+//  within a call and after a call of an even or an odd number of values.
+template <MKL_INT Brng, typename Distr, typename F, typename T, typename... Params>
+static inline std::uint64_t outputs_per_value(F vsl_function, MKL_INT method,
+                                              Params... params) {
+    if (variable_consumption<Distr>::value)
+        return 0;
+    static const std::uint64_t outputs = [&]() -> std::uint64_t {
+        constexpr MKL_INT count = 32;
+        auto generate = [&](std::uint64_t skip, MKL_INT first, MKL_INT second) {
+            std::vector<T> values(first + second);
+            VSLStreamStatePtr stream;
+            vslNewStream(&stream, Brng, 1);
+            vslSkipAheadStream(stream, skip);
+            vsl_function(method, stream, first, values.data(), params...);
+            vsl_function(method, stream, second, values.data() + first, params...);
+            vslDeleteStream(&stream);
+            return std::vector<T>(values.begin() + first, values.end());
+        };
+        auto equal = [](const std::vector<T>& a, const std::vector<T>& b) {
+            return std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+        };
+        const std::vector<T> whole = generate(0, 0, 2 * count);
+        const std::vector<T> tail(whole.begin() + count, whole.end());
+        const std::vector<T> after_even = generate(0, count, count);
+        const std::vector<T> after_odd = generate(0, count + 1, count);
+        for (std::uint64_t candidate : { 1, 2, 4 }) {
+            const std::vector<T> skipped = generate(candidate * count, 0, count);
+            if (equal(skipped, tail) && equal(skipped, after_even) &&
+                equal(generate(candidate * (count + 1), 0, count), after_odd))
+                return candidate;
+        }
+        return 0;
+    }();
+    return outputs;
+}
+
+// Generates the n values of r of the distribution with
+//  vsl_function(method, stream, n, r, params...) and advances stream past
+//  them. Large outputs are split into chunks generated in parallel, each from
+//  a copy of stream skipped ahead to its first value, so that the values and
+//  the final state of stream are those of serial generation. Distributions
+//  whose values do not consume a fixed number of outputs of the basic
+//  generator are generated serially.
+template <MKL_INT Brng, typename Distr, typename F, typename T, typename... Params>
+static inline void parallel_generate(const Distr&, F vsl_function, MKL_INT method,
+                                     VSLStreamStatePtr stream, std::int64_t n, T* r,
+                                     Params... params) {
+    const std::uint64_t outputs =
+        (n < parallel_generate_threshold)
+            ? 0
+            : outputs_per_value<Brng, Distr, F, T>(vsl_function, method, params...);
+    if (outputs == 0) {
+        vsl_function(method, stream, n, r, params...);
+        return;
+    }
+    const std::int64_t chunks = (n + parallel_generate_chunk - 1) / parallel_generate_chunk;
+    parallel_for(chunks, 1, [&](std::int64_t first, std::int64_t last) {
+        const std::int64_t begin = first * parallel_generate_chunk;
+        const std::int64_t end = std::min(last * parallel_generate_chunk, n);
+        VSLStreamStatePtr chunk;
+        vslCopyStream(&chunk, stream);
+        vslSkipAheadStream(chunk, begin * outputs);
+        vsl_function(method, chunk, end - begin, r + begin, params...);
+        vslDeleteStream(&chunk);
+    });
+    vslSkipAheadStream(stream, n * outputs);
+}
+
+// Position of an engine in the sequence of values of its stream after
+//  leapfrog(idx, stride): it generates the values idx, idx + stride,
+//  idx + 2 * stride, ... of the serial sequence, and skip_ahead skips values of
+//  this subsequence, which are accounted for at the next generation.
+struct leapfrog_state {
+    std::uint64_t idx = 0;
+    std::uint64_t stride = 1;
+    std::uint64_t skipped = 0; // serial values to skip before the next value
+};
+
+// Number of values of the subsequence per chunk of leapfrog_generate, number
+//  of serial values per call when it generates all of them, and largest stride
+//  for which generating all of them is cheaper than skipping to each value.
+constexpr std::int64_t leapfrog_chunk = std::int64_t(1) << 12;
+constexpr std::int64_t leapfrog_block = std::int64_t(1) << 16;
+constexpr std::uint64_t leapfrog_max_discard_stride = 64;
+
+// Generates the next total serial values of stream in blocks of an even
+//  number of values, so that the methods producing pairs of values keep their
+//  pairs, and copies the n values first, first + stride, ... of them to r.
+template <typename F, typename T, typename... Params>
+static inline void discard_generate(F vsl_function, MKL_INT method, VSLStreamStatePtr stream,
+                                    std::uint64_t total, std::uint64_t first,
+                                    std::uint64_t stride, std::int64_t n, T* r,
+                                    Params... params) {
+    std::vector<T> block(std::min<std::uint64_t>(total, leapfrog_block));
+    std::uint64_t next = first;
+    std::int64_t i = 0;
+    for (std::uint64_t position = 0; position < total;) {
+        const std::int64_t size = std::min<std::uint64_t>(total - position, leapfrog_block);
+        vsl_function(method, stream, size, block.data(), params...);
+        for (; i < n && next < position + size; i++, next += stride)
+            r[i] = block[next - position];
+        position += size;
+    }
+}
+
+// Generates the next n values of the leapfrog subsequence of stream into r
+//  with vsl_function(method, stream, n, r, params...) and advances stream past
+//  the n * stride serial values they are taken from. When the values consume a
+//  fixed number of outputs of the basic generator, the subsequence is split
+//  into parallel chunks, each generated from a copy of stream skipped ahead to
+//  its first value. Within a chunk, the serial values are generated and one in
+//  stride of them is kept for strides up to leapfrog_max_discard_stride;
+//  beyond, the copy is skipped ahead to each value, which is cheaper than
+//  generating the values in between even though a skip of mrg32k3a computes a
+//  power of its jump matrices. Otherwise the whole call is generated serially,
+//  keeping one in stride of the values.
+template <MKL_INT Brng, typename Distr, typename F, typename T, typename... Params>
+static inline void leapfrog_generate(const Distr&, leapfrog_state& leapfrog, F vsl_function,
+                                     MKL_INT method, VSLStreamStatePtr stream, std::int64_t n,
+                                     T* r, Params... params) {
+    const std::uint64_t stride = leapfrog.stride;
+    const std::uint64_t first = leapfrog.skipped + leapfrog.idx;
+    const std::uint64_t outputs =
+        outputs_per_value<Brng, Distr, F, T>(vsl_function, method, params...);
+    if (outputs != 0) {
+        const std::int64_t chunks = (n + leapfrog_chunk - 1) / leapfrog_chunk;
+        parallel_for(chunks, 1, [&](std::int64_t first_chunk, std::int64_t last_chunk) {
+            const std::int64_t begin = first_chunk * leapfrog_chunk;
+            const std::int64_t end = std::min(last_chunk * leapfrog_chunk, n);
+            VSLStreamStatePtr chunk;
+            vslCopyStream(&chunk, stream);
+            vslSkipAheadStream(chunk, outputs * (first + begin * stride));
+            if (stride <= leapfrog_max_discard_stride) {
+                discard_generate(vsl_function, method, chunk, (end - begin - 1) * stride + 1, 0,
+                                 stride, end - begin, r + begin, params...);
+            }
+            else {
+                for (std::int64_t i = begin; i < end; i++) {
+                    if (i != begin)
+                        vslSkipAheadStream(chunk, outputs * (stride - 1));
+                    vsl_function(method, chunk, 1, r + i, params...);
+                }
+            }
+            vslDeleteStream(&chunk);
+        });
+        vslSkipAheadStream(stream, outputs * (leapfrog.skipped + n * stride));
+        leapfrog.skipped = 0;
+        return;
+    }
+
+    discard_generate(vsl_function, method, stream, leapfrog.skipped + n * stride, first, stride,
+                     n, r, params...);
+    leapfrog.skipped = 0;
+}
+
+// Generates n values of a discrete distribution from its alias table, with
+//  the signature of the VSL generators: each value takes one uniform double of
+//  [0, k) from vdRngUniform with method, whose integer part is the column and
+//  whose fractional part is compared with the threshold of the column.
+template <typename IntType>
+static inline int generate_discrete_alias(MKL_INT method, VSLStreamStatePtr stream, MKL_INT n,
+                                          IntType* r, const double* threshold,
+                                          const std::int32_t* alias, std::int32_t k) {
+    constexpr MKL_INT block = 1024;
+    double u[block];
+    for (MKL_INT i = 0; i < n; i += block) {
+        const MKL_INT count = std::min(block, n - i);
+        int status = vdRngUniform(method, stream, count, u, 0.0, static_cast<double>(k));
+        if (status != VSL_STATUS_OK)
+            return status;
+        for (MKL_INT j = 0; j < count; j++) {
+            const std::int32_t column = std::min(static_cast<std::int32_t>(u[j]), k - 1);
+            r[i + j] = static_cast<IntType>((u[j] - column < threshold[column]) ? column
+                                                                                 : alias[column]);
+        }
+    }
+    return VSL_STATUS_OK;
+}
+
 template <typename Engine, typename Distr>
 class kernel_name {};
 
@@ -42,277 +42,543 @@ public:
     mrg32k3a_impl(sycl::queue queue, std::uint32_t seed)
             : oneapi::mkl::rng::detail::engine_impl(queue) {
         vslNewStream(&stream_, VSL_BRNG_MRG32K3A, seed);
-        state_size_ = vslGetStreamSize(stream_);
     }
 
     mrg32k3a_impl(sycl::queue queue, std::initializer_list<std::uint32_t> seed)
             : oneapi::mkl::rng::detail::engine_impl(queue) {
         vslNewStreamEx(&stream_, VSL_BRNG_MRG32K3A, 2 * seed.size(),
                        reinterpret_cast<const std::uint32_t*>(seed.begin()));
-        state_size_ = vslGetStreamSize(stream_);
     }
 
     mrg32k3a_impl(const mrg32k3a_impl* other) : oneapi::mkl::rng::detail::engine_impl(*other) {
         vslCopyStream(&stream_, other->stream_);
-        state_size_ = vslGetStreamSize(stream_);
+        leapfrog_ = other->leapfrog_;
     }
 
     // Buffers APIs
 
     virtual void generate(const uniform<float, uniform_method::standard>& distr, std::int64_t n,
                           sycl::buffer<float, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD,
-                             static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                             acc_r.get_pointer(), distr.a(), distr.b());
+                generate_values(distr, vsRngUniform, VSL_RNG_METHOD_UNIFORM_STD, stream, n,
+                                acc_r.get_pointer(), distr.a(), distr.b());
             });
         });
     }
 
     virtual void generate(const uniform<double, uniform_method::standard>& distr, std::int64_t n,
                           sycl::buffer<double, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD,
-                             static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                             acc_r.get_pointer(), distr.a(), distr.b());
+                generate_values(distr, vdRngUniform, VSL_RNG_METHOD_UNIFORM_STD, stream, n,
+                                acc_r.get_pointer(), distr.a(), distr.b());
             });
         });
     }
 
     virtual void generate(const uniform<std::int32_t, uniform_method::standard>& distr,
                           std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                viRngUniform(VSL_RNG_METHOD_UNIFORM_STD,
-                             static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                             acc_r.get_pointer(), distr.a(), distr.b());
+                generate_values(distr, viRngUniform, VSL_RNG_METHOD_UNIFORM_STD, stream, n,
+                                acc_r.get_pointer(), distr.a(), distr.b());
             });
         });
     }
 
     virtual void generate(const uniform<float, uniform_method::accurate>& distr, std::int64_t n,
                           sycl::buffer<float, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD_ACCURATE,
-                             static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                             acc_r.get_pointer(), distr.a(), distr.b());
+                generate_values(distr, vsRngUniform, VSL_RNG_METHOD_UNIFORM_STD_ACCURATE, stream, n,
+                                acc_r.get_pointer(), distr.a(), distr.b());
             });
         });
     }
 
     virtual void generate(const uniform<double, uniform_method::accurate>& distr, std::int64_t n,
                           sycl::buffer<double, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD_ACCURATE,
-                             static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                             acc_r.get_pointer(), distr.a(), distr.b());
+                generate_values(distr, vdRngUniform, VSL_RNG_METHOD_UNIFORM_STD_ACCURATE, stream, n,
+                                acc_r.get_pointer(), distr.a(), distr.b());
             });
         });
     }
 
     virtual void generate(const gaussian<float, gaussian_method::box_muller2>& distr,
                           std::int64_t n, sycl::buffer<float, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2,
-                              static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                              acc_r.get_pointer(), distr.mean(), distr.stddev());
+                generate_values(distr, vsRngGaussian, VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2, stream, n,
+                                acc_r.get_pointer(), distr.mean(), distr.stddev());
             });
         });
     }
 
     virtual void generate(const gaussian<double, gaussian_method::box_muller2>& distr,
                           std::int64_t n, sycl::buffer<double, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2,
-                              static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                              acc_r.get_pointer(), distr.mean(), distr.stddev());
+                generate_values(distr, vdRngGaussian, VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2, stream, n,
+                                acc_r.get_pointer(), distr.mean(), distr.stddev());
             });
         });
     }
 
     virtual void generate(const gaussian<float, gaussian_method::icdf>& distr, std::int64_t n,
                           sycl::buffer<float, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF,
-                              static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                              acc_r.get_pointer(), distr.mean(), distr.stddev());
+                generate_values(distr, vsRngGaussian, VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.mean(), distr.stddev());
             });
         });
     }
 
     virtual void generate(const gaussian<double, gaussian_method::icdf>& distr, std::int64_t n,
                           sycl::buffer<double, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF,
-                              static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                              acc_r.get_pointer(), distr.mean(), distr.stddev());
+                generate_values(distr, vdRngGaussian, VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.mean(), distr.stddev());
             });
         });
     }
 
     virtual void generate(const lognormal<float, lognormal_method::box_muller2>& distr,
                           std::int64_t n, sycl::buffer<float, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngLognormal(VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2,
-                               static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                               acc_r.get_pointer(), distr.m(), distr.s(), distr.displ(),
-                               distr.scale());
+                generate_values(distr, vsRngLognormal, VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2, stream,
+                                n, acc_r.get_pointer(), distr.m(), distr.s(), distr.displ(),
+                                distr.scale());
             });
         });
     }
 
     virtual void generate(const lognormal<double, lognormal_method::box_muller2>& distr,
                           std::int64_t n, sycl::buffer<double, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngLognormal(VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2,
-                               static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                               acc_r.get_pointer(), distr.m(), distr.s(), distr.displ(),
-                               distr.scale());
+                generate_values(distr, vdRngLognormal, VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2, stream,
+                                n, acc_r.get_pointer(), distr.m(), distr.s(), distr.displ(),
+                                distr.scale());
             });
         });
     }
 
     virtual void generate(const lognormal<float, lognormal_method::icdf>& distr, std::int64_t n,
                           sycl::buffer<float, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngLognormal(VSL_RNG_METHOD_LOGNORMAL_ICDF,
-                               static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                               acc_r.get_pointer(), distr.m(), distr.s(), distr.displ(),
-                               distr.scale());
+                generate_values(distr, vsRngLognormal, VSL_RNG_METHOD_LOGNORMAL_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.m(), distr.s(), distr.displ(),
+                                distr.scale());
             });
         });
     }
 
     virtual void generate(const lognormal<double, lognormal_method::icdf>& distr, std::int64_t n,
                           sycl::buffer<double, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngLognormal(VSL_RNG_METHOD_LOGNORMAL_ICDF,
-                               static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                               acc_r.get_pointer(), distr.m(), distr.s(), distr.displ(),
-                               distr.scale());
+                generate_values(distr, vdRngLognormal, VSL_RNG_METHOD_LOGNORMAL_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.m(), distr.s(), distr.displ(),
+                                distr.scale());
             });
         });
     }
 
     virtual void generate(const bernoulli<std::int32_t, bernoulli_method::icdf>& distr,
                           std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                viRngBernoulli(VSL_RNG_METHOD_BERNOULLI_ICDF,
-                               static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                               acc_r.get_pointer(), distr.p());
+                generate_values(distr, viRngBernoulli, VSL_RNG_METHOD_BERNOULLI_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.p());
             });
         });
     }
 
     virtual void generate(const bernoulli<std::uint32_t, bernoulli_method::icdf>& distr,
                           std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
                 std::uint32_t* r_ptr = acc_r.get_pointer();
-                viRngBernoulli(VSL_RNG_METHOD_BERNOULLI_ICDF,
-                               static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                               reinterpret_cast<std::int32_t*>(r_ptr), distr.p());
+                generate_values(distr, viRngBernoulli, VSL_RNG_METHOD_BERNOULLI_ICDF, stream, n,
+                                reinterpret_cast<std::int32_t*>(r_ptr), distr.p());
             });
         });
     }
 
     virtual void generate(const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr,
                           std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                viRngPoisson(VSL_RNG_METHOD_POISSON_POISNORM,
-                             static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                             acc_r.get_pointer(), distr.lambda());
+                generate_values(distr, viRngPoisson, VSL_RNG_METHOD_POISSON_POISNORM, stream, n,
+                                acc_r.get_pointer(), distr.lambda());
             });
         });
     }
 
     virtual void generate(const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr,
                           std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
                 std::uint32_t* r_ptr = acc_r.get_pointer();
-                viRngPoisson(VSL_RNG_METHOD_POISSON_POISNORM,
-                             static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                             reinterpret_cast<std::int32_t*>(r_ptr), distr.lambda());
+                generate_values(distr, viRngPoisson, VSL_RNG_METHOD_POISSON_POISNORM, stream, n,
+                                reinterpret_cast<std::int32_t*>(r_ptr), distr.lambda());
             });
         });
     }
 
     virtual void generate(const bits<std::uint32_t>& distr, std::int64_t n,
                           sycl::buffer<std::uint32_t, 1>& r) override {
-        sycl::buffer<char, 1> stream_buf(static_cast<char*>(stream_), state_size_);
-        queue_.submit([&](sycl::handler& cgh) {
-            auto acc_stream = stream_buf.get_access<sycl::access::mode::read_write>(cgh);
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, viRngUniformBits, VSL_RNG_METHOD_UNIFORMBITS_STD, stream, n,
+                                acc_r.get_pointer());
+            });
+        });
+    }
+
+    virtual void generate(const exponential<float, exponential_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngExponential, VSL_RNG_METHOD_EXPONENTIAL_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngExponential, VSL_RNG_METHOD_EXPONENTIAL_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const exponential<float, exponential_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngExponential, VSL_RNG_METHOD_EXPONENTIAL_ICDF_ACCURATE,
+                                stream, n, acc_r.get_pointer(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const exponential<double, exponential_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngExponential, VSL_RNG_METHOD_EXPONENTIAL_ICDF_ACCURATE,
+                                stream, n, acc_r.get_pointer(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngGamma, VSL_RNG_METHOD_GAMMA_GNORM, stream, n,
+                                acc_r.get_pointer(), distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngGamma, VSL_RNG_METHOD_GAMMA_GNORM, stream, n,
+                                acc_r.get_pointer(), distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const gamma<float, gamma_method::marsaglia_accurate>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngGamma, VSL_RNG_METHOD_GAMMA_GNORM_ACCURATE, stream, n,
+                                acc_r.get_pointer(), distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const gamma<double, gamma_method::marsaglia_accurate>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngGamma, VSL_RNG_METHOD_GAMMA_GNORM_ACCURATE, stream, n,
+                                acc_r.get_pointer(), distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngBeta, VSL_RNG_METHOD_BETA_CJA, stream, n,
+                                acc_r.get_pointer(), distr.p(), distr.q(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngBeta, VSL_RNG_METHOD_BETA_CJA, stream, n,
+                                acc_r.get_pointer(), distr.p(), distr.q(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const beta<float, beta_method::cja_accurate>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngBeta, VSL_RNG_METHOD_BETA_CJA_ACCURATE, stream, n,
+                                acc_r.get_pointer(), distr.p(), distr.q(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const beta<double, beta_method::cja_accurate>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngBeta, VSL_RNG_METHOD_BETA_CJA_ACCURATE, stream, n,
+                                acc_r.get_pointer(), distr.p(), distr.q(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const cauchy<float, cauchy_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngCauchy, VSL_RNG_METHOD_CAUCHY_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const cauchy<double, cauchy_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngCauchy, VSL_RNG_METHOD_CAUCHY_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual void generate(const weibull<float, weibull_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<float, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngWeibull, VSL_RNG_METHOD_WEIBULL_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const weibull<double, weibull_method::icdf>& distr, std::int64_t n,
+                          sycl::buffer<double, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngWeibull, VSL_RNG_METHOD_WEIBULL_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const weibull<float, weibull_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<float, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngWeibull, VSL_RNG_METHOD_WEIBULL_ICDF_ACCURATE, stream,
+                                n, acc_r.get_pointer(), distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const weibull<double, weibull_method::icdf_accurate>& distr,
+                          std::int64_t n, sycl::buffer<double, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngWeibull, VSL_RNG_METHOD_WEIBULL_ICDF_ACCURATE, stream,
+                                n, acc_r.get_pointer(), distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual void generate(const discrete<std::int32_t, discrete_method::alias>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, generate_discrete_alias<std::int32_t>,
+                                VSL_RNG_METHOD_UNIFORM_STD, stream, n, acc_r.get_pointer(),
+                                distr.threshold().data(), distr.alias().data(), distr.k());
+            });
+        });
+    }
+
+    virtual void generate(const discrete<std::uint32_t, discrete_method::alias>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, generate_discrete_alias<std::uint32_t>,
+                                VSL_RNG_METHOD_UNIFORM_STD, stream, n, acc_r.get_pointer(),
+                                distr.threshold().data(), distr.alias().data(), distr.k());
+            });
+        });
+    }
+
+    virtual void generate(
+        const multinomial<std::int32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        // The values of an experiment are not consecutive in a leapfrog subsequence.
+        if (leapfrog_.stride > 1)
+            throw oneapi::mkl::unimplemented("rng", "generate", "multinomial after leapfrog");
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                const MKL_INT k = static_cast<MKL_INT>(distr.p().size());
+                generate_values(distr, viRngMultinomial, VSL_RNG_METHOD_MULTINOMIAL_MULTPOISSON,
+                                stream, n / k, acc_r.get_pointer(), distr.ntrial(), k,
+                                distr.p().data());
+            });
+        });
+    }
+
+    virtual void generate(
+        const multinomial<std::uint32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        // The values of an experiment are not consecutive in a leapfrog subsequence.
+        if (leapfrog_.stride > 1)
+            throw oneapi::mkl::unimplemented("rng", "generate", "multinomial after leapfrog");
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                const MKL_INT k = static_cast<MKL_INT>(distr.p().size());
+                std::uint32_t* r_ptr = acc_r.get_pointer();
+                generate_values(distr, viRngMultinomial, VSL_RNG_METHOD_MULTINOMIAL_MULTPOISSON,
+                                stream, n / k, reinterpret_cast<std::int32_t*>(r_ptr),
+                                distr.ntrial(), k, distr.p().data());
+            });
+        });
+    }
+
+    virtual void generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::int32_t, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
+            host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, viRngGeometric, VSL_RNG_METHOD_GEOMETRIC_ICDF, stream, n,
+                                acc_r.get_pointer(), distr.p());
+            });
+        });
+    }
+
+    virtual void generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                          std::int64_t n, sycl::buffer<std::uint32_t, 1>& r) override {
+        submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
             auto acc_r = r.get_access<sycl::access::mode::read_write>(cgh);
             host_task<kernel_name<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                viRngUniformBits(VSL_RNG_METHOD_UNIFORMBITS_STD,
-                                 static_cast<VSLStreamStatePtr>(acc_stream.get_pointer()), n,
-                                 acc_r.get_pointer());
+                std::uint32_t* r_ptr = acc_r.get_pointer();
+                generate_values(distr, viRngGeometric, VSL_RNG_METHOD_GEOMETRIC_ICDF, stream, n,
+                                reinterpret_cast<std::int32_t*>(r_ptr), distr.p());
             });
         });
     }
@@ -323,10 +589,11 @@ public:
                                  std::int64_t n, float* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.a(), distr.b());
+                generate_values(distr, vsRngUniform, VSL_RNG_METHOD_UNIFORM_STD, stream, n, r,
+                                distr.a(), distr.b());
             });
         });
     }
@@ -335,10 +602,11 @@ public:
                                  std::int64_t n, double* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.a(), distr.b());
+                generate_values(distr, vdRngUniform, VSL_RNG_METHOD_UNIFORM_STD, stream, n, r,
+                                distr.a(), distr.b());
             });
         });
     }
@@ -347,10 +615,11 @@ public:
                                  std::int64_t n, std::int32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                viRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.a(), distr.b());
+                generate_values(distr, viRngUniform, VSL_RNG_METHOD_UNIFORM_STD, stream, n, r,
+                                distr.a(), distr.b());
             });
         });
     }
@@ -359,11 +628,11 @@ public:
                                  std::int64_t n, float* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD_ACCURATE, stream, n, r, distr.a(),
-                             distr.b());
+                generate_values(distr, vsRngUniform, VSL_RNG_METHOD_UNIFORM_STD_ACCURATE, stream, n,
+                                r, distr.a(), distr.b());
             });
         });
     }
@@ -372,11 +641,11 @@ public:
                                  std::int64_t n, double* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD_ACCURATE, stream, n, r, distr.a(),
-                             distr.b());
+                generate_values(distr, vdRngUniform, VSL_RNG_METHOD_UNIFORM_STD_ACCURATE, stream, n,
+                                r, distr.a(), distr.b());
             });
         });
     }
@@ -385,11 +654,11 @@ public:
                                  std::int64_t n, float* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2, stream, n, r, distr.mean(),
-                              distr.stddev());
+                generate_values(distr, vsRngGaussian, VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2, stream, n,
+                                r, distr.mean(), distr.stddev());
             });
         });
     }
@@ -398,11 +667,11 @@ public:
                                  std::int64_t n, double* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2, stream, n, r, distr.mean(),
-                              distr.stddev());
+                generate_values(distr, vdRngGaussian, VSL_RNG_METHOD_GAUSSIAN_BOXMULLER2, stream, n,
+                                r, distr.mean(), distr.stddev());
             });
         });
     }
@@ -411,11 +680,11 @@ public:
                                  std::int64_t n, float* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n, r, distr.mean(),
-                              distr.stddev());
+                generate_values(distr, vsRngGaussian, VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n, r,
+                                distr.mean(), distr.stddev());
             });
         });
     }
@@ -424,11 +693,11 @@ public:
                                  std::int64_t n, double* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n, r, distr.mean(),
-                              distr.stddev());
+                generate_values(distr, vdRngGaussian, VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n, r,
+                                distr.mean(), distr.stddev());
             });
         });
     }
@@ -437,11 +706,11 @@ public:
                                  std::int64_t n, float* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngLognormal(VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2, stream, n, r, distr.m(),
-                               distr.s(), distr.displ(), distr.scale());
+                generate_values(distr, vsRngLognormal, VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2, stream,
+                                n, r, distr.m(), distr.s(), distr.displ(), distr.scale());
             });
         });
     }
@@ -450,11 +719,11 @@ public:
                                  std::int64_t n, double* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngLognormal(VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2, stream, n, r, distr.m(),
-                               distr.s(), distr.displ(), distr.scale());
+                generate_values(distr, vdRngLognormal, VSL_RNG_METHOD_LOGNORMAL_BOXMULLER2, stream,
+                                n, r, distr.m(), distr.s(), distr.displ(), distr.scale());
             });
         });
     }
@@ -463,11 +732,11 @@ public:
                                  std::int64_t n, float* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vsRngLognormal(VSL_RNG_METHOD_LOGNORMAL_ICDF, stream, n, r, distr.m(), distr.s(),
-                               distr.displ(), distr.scale());
+                generate_values(distr, vsRngLognormal, VSL_RNG_METHOD_LOGNORMAL_ICDF, stream, n, r,
+                                distr.m(), distr.s(), distr.displ(), distr.scale());
             });
         });
     }
@@ -476,11 +745,11 @@ public:
                                  std::int64_t n, double* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                vdRngLognormal(VSL_RNG_METHOD_LOGNORMAL_ICDF, stream, n, r, distr.m(), distr.s(),
-                               distr.displ(), distr.scale());
+                generate_values(distr, vdRngLognormal, VSL_RNG_METHOD_LOGNORMAL_ICDF, stream, n, r,
+                                distr.m(), distr.s(), distr.displ(), distr.scale());
             });
         });
     }
@@ -489,10 +758,11 @@ public:
                                  std::int64_t n, std::int32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                viRngBernoulli(VSL_RNG_METHOD_BERNOULLI_ICDF, stream, n, r, distr.p());
+                generate_values(distr, viRngBernoulli, VSL_RNG_METHOD_BERNOULLI_ICDF, stream, n, r,
+                                distr.p());
             });
         });
     }
@@ -501,11 +771,11 @@ public:
                                  std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                viRngBernoulli(VSL_RNG_METHOD_BERNOULLI_ICDF, stream, n,
-                               reinterpret_cast<int32_t*>(r), distr.p());
+                generate_values(distr, viRngBernoulli, VSL_RNG_METHOD_BERNOULLI_ICDF, stream, n,
+                                reinterpret_cast<int32_t*>(r), distr.p());
             });
         });
     }
@@ -514,10 +784,11 @@ public:
         const poisson<std::int32_t, poisson_method::gaussian_icdf_based>& distr, std::int64_t n,
         std::int32_t* r, const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                viRngPoisson(VSL_RNG_METHOD_POISSON_POISNORM, stream, n, r, distr.lambda());
+                generate_values(distr, viRngPoisson, VSL_RNG_METHOD_POISSON_POISNORM, stream, n, r,
+                                distr.lambda());
             });
         });
     }
@@ -526,11 +797,11 @@ public:
         const poisson<std::uint32_t, poisson_method::gaussian_icdf_based>& distr, std::int64_t n,
         std::uint32_t* r, const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
             host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
-                viRngPoisson(VSL_RNG_METHOD_POISSON_POISNORM, stream, n,
-                             reinterpret_cast<int32_t*>(r), distr.lambda());
+                generate_values(distr, viRngPoisson, VSL_RNG_METHOD_POISSON_POISNORM, stream, n,
+                                reinterpret_cast<int32_t*>(r), distr.lambda());
             });
         });
     }
@@ -538,36 +809,394 @@ public:
     virtual sycl::event generate(const bits<std::uint32_t>& distr, std::int64_t n, std::uint32_t* r,
                                  const std::vector<sycl::event>& dependencies) override {
         sycl::event::wait_and_throw(dependencies);
-        return queue_.submit([&](sycl::handler& cgh) {
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, viRngUniformBits, VSL_RNG_METHOD_UNIFORMBITS_STD, stream, n,
+                                r);
+            });
+        });
+    }
+
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngExponential, VSL_RNG_METHOD_EXPONENTIAL_ICDF, stream, n,
+                                r, distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const exponential<double, exponential_method::icdf>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngExponential, VSL_RNG_METHOD_EXPONENTIAL_ICDF, stream, n,
+                                r, distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const exponential<float, exponential_method::icdf_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngExponential, VSL_RNG_METHOD_EXPONENTIAL_ICDF_ACCURATE,
+                                stream, n, r, distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(
+        const exponential<double, exponential_method::icdf_accurate>& distr, std::int64_t n,
+        double* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngExponential, VSL_RNG_METHOD_EXPONENTIAL_ICDF_ACCURATE,
+                                stream, n, r, distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngGamma, VSL_RNG_METHOD_GAMMA_GNORM, stream, n, r,
+                                distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngGamma, VSL_RNG_METHOD_GAMMA_GNORM, stream, n, r,
+                                distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gamma<float, gamma_method::marsaglia_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngGamma, VSL_RNG_METHOD_GAMMA_GNORM_ACCURATE, stream, n,
+                                r, distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const gamma<double, gamma_method::marsaglia_accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngGamma, VSL_RNG_METHOD_GAMMA_GNORM_ACCURATE, stream, n,
+                                r, distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngBeta, VSL_RNG_METHOD_BETA_CJA, stream, n, r, distr.p(),
+                                distr.q(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngBeta, VSL_RNG_METHOD_BETA_CJA, stream, n, r, distr.p(),
+                                distr.q(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const beta<float, beta_method::cja_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngBeta, VSL_RNG_METHOD_BETA_CJA_ACCURATE, stream, n, r,
+                                distr.p(), distr.q(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const beta<double, beta_method::cja_accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngBeta, VSL_RNG_METHOD_BETA_CJA_ACCURATE, stream, n, r,
+                                distr.p(), distr.q(), distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const cauchy<float, cauchy_method::icdf>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngCauchy, VSL_RNG_METHOD_CAUCHY_ICDF, stream, n, r,
+                                distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const cauchy<double, cauchy_method::icdf>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngCauchy, VSL_RNG_METHOD_CAUCHY_ICDF, stream, n, r,
+                                distr.a(), distr.b());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const weibull<float, weibull_method::icdf>& distr, std::int64_t n,
+                                 float* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngWeibull, VSL_RNG_METHOD_WEIBULL_ICDF, stream, n, r,
+                                distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const weibull<double, weibull_method::icdf>& distr, std::int64_t n,
+                                 double* r, const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngWeibull, VSL_RNG_METHOD_WEIBULL_ICDF, stream, n, r,
+                                distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const weibull<float, weibull_method::icdf_accurate>& distr,
+                                 std::int64_t n, float* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vsRngWeibull, VSL_RNG_METHOD_WEIBULL_ICDF_ACCURATE, stream,
+                                n, r, distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const weibull<double, weibull_method::icdf_accurate>& distr,
+                                 std::int64_t n, double* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, vdRngWeibull, VSL_RNG_METHOD_WEIBULL_ICDF_ACCURATE, stream,
+                                n, r, distr.alpha(), distr.a(), distr.beta());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const discrete<std::int32_t, discrete_method::alias>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, generate_discrete_alias<std::int32_t>,
+                                VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.threshold().data(),
+                                distr.alias().data(), distr.k());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const discrete<std::uint32_t, discrete_method::alias>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, generate_discrete_alias<std::uint32_t>,
+                                VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, distr.threshold().data(),
+                                distr.alias().data(), distr.k());
+            });
+        });
+    }
+
+    virtual sycl::event generate(
+        const multinomial<std::int32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, std::int32_t* r, const std::vector<sycl::event>& dependencies) override {
+        // The values of an experiment are not consecutive in a leapfrog subsequence.
+        if (leapfrog_.stride > 1)
+            throw oneapi::mkl::unimplemented("rng", "generate", "multinomial after leapfrog");
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                const MKL_INT k = static_cast<MKL_INT>(distr.p().size());
+                generate_values(distr, viRngMultinomial, VSL_RNG_METHOD_MULTINOMIAL_MULTPOISSON,
+                                stream, n / k, r, distr.ntrial(), k, distr.p().data());
+            });
+        });
+    }
+
+    virtual sycl::event generate(
+        const multinomial<std::uint32_t, multinomial_method::poisson_icdf_based>& distr,
+        std::int64_t n, std::uint32_t* r, const std::vector<sycl::event>& dependencies) override {
+        // The values of an experiment are not consecutive in a leapfrog subsequence.
+        if (leapfrog_.stride > 1)
+            throw oneapi::mkl::unimplemented("rng", "generate", "multinomial after leapfrog");
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                const MKL_INT k = static_cast<MKL_INT>(distr.p().size());
+                generate_values(distr, viRngMultinomial, VSL_RNG_METHOD_MULTINOMIAL_MULTPOISSON,
+                                stream, n / k, reinterpret_cast<std::int32_t*>(r), distr.ntrial(),
+                                k, distr.p().data());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const geometric<std::int32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::int32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
+            VSLStreamStatePtr stream = stream_;
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, viRngGeometric, VSL_RNG_METHOD_GEOMETRIC_ICDF, stream, n, r,
+                                distr.p());
+            });
+        });
+    }
+
+    virtual sycl::event generate(const geometric<std::uint32_t, geometric_method::icdf>& distr,
+                                 std::int64_t n, std::uint32_t* r,
+                                 const std::vector<sycl::event>& dependencies) override {
+        sycl::event::wait_and_throw(dependencies);
+        return submit([&](sycl::handler& cgh) {
             VSLStreamStatePtr stream = stream_;
-            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(
-                cgh, [=]() { viRngUniformBits(VSL_RNG_METHOD_UNIFORMBITS_STD, stream, n, r); });
+            host_task<kernel_name_usm<mrg32k3a_impl, decltype(distr)>>(cgh, [=]() {
+                generate_values(distr, viRngGeometric, VSL_RNG_METHOD_GEOMETRIC_ICDF, stream, n,
+                                reinterpret_cast<std::int32_t*>(r), distr.p());
+            });
         });
     }
 
     virtual oneapi::mkl::rng::detail::engine_impl* copy_state() override {
+        last_event_.wait();
         return new mrg32k3a_impl(this);
     }
 
     virtual void skip_ahead(std::uint64_t num_to_skip) override {
-        vslSkipAheadStream(stream_, num_to_skip);
+        last_event_.wait();
+        if (leapfrog_.stride > 1)
+            leapfrog_.skipped += num_to_skip * leapfrog_.stride;
+        else
+            vslSkipAheadStream(stream_, num_to_skip);
     }
 
     virtual void skip_ahead(std::initializer_list<std::uint64_t> num_to_skip) override {
+        last_event_.wait();
+        if (leapfrog_.stride > 1)
+            throw oneapi::mkl::unimplemented("rng", "skip_ahead",
+                                             "with a multi-word num_to_skip after leapfrog");
         vslSkipAheadStreamEx(stream_, num_to_skip.size(), (unsigned long long*)num_to_skip.begin());
     }
 
     virtual void leapfrog(std::uint64_t idx, std::uint64_t stride) override {
-        throw oneapi::mkl::unimplemented("rng", "leapfrog");
+        if (stride == 0 || idx >= stride)
+            throw oneapi::mkl::invalid_argument("rng", "leapfrog", "idx must be less than stride");
+        last_event_.wait();
+        leapfrog_.idx = idx;
+        leapfrog_.stride = stride;
     }
 
     virtual ~mrg32k3a_impl() override {
+        last_event_.wait();
         vslDeleteStream(&stream_);
     }
 
 private:
+    // Generates the values of the leapfrog subsequence of the engine after
+    //  leapfrog, and otherwise calls vsl_function. It runs in the host_tasks,
+    //  which are ordered, so it may update leapfrog_.
+    template <typename Distr, typename F, typename T, typename... Params>
+    void generate_values(const Distr& distr, F vsl_function, MKL_INT method,
+                         VSLStreamStatePtr stream, std::int64_t n, T* r, Params... params) {
+        if (leapfrog_.stride > 1)
+            leapfrog_generate<VSL_BRNG_MRG32K3A>(distr, leapfrog_, vsl_function, method, stream, n,
+                                                 r, params...);
+        else
+            vsl_function(method, stream, n, r, params...);
+    }
+
+    // Submits the command group f after the previous submission of the engine.
+    //  The host_tasks of an engine all use its stream state, so they run in
+    //  order, and host-side operations on the state wait for the last one.
+    template <typename F>
+    sycl::event submit(F f) {
+        last_event_ = queue_.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(last_event_);
+            f(cgh);
+        });
+        return last_event_;
+    }
+
     VSLStreamStatePtr stream_;
-    std::int32_t state_size_;
+    leapfrog_state leapfrog_;
+    sycl::event last_event_;
 };
 
 oneapi::mkl::rng::detail::engine_impl* create_mrg32k3a(sycl::queue queue, std::uint32_t seed) {
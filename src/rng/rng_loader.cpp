@@ -21,6 +21,7 @@
 
 #include "function_table_initializer.hpp"
 #include "rng/function_table.hpp"
+#include "rng/traced_engine.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -29,25 +30,46 @@ namespace detail {
 
 static oneapi::mkl::detail::table_initializer<domain::rng, rng_function_table_t> function_tables;
 
+// Creates an engine with entry. When ONEMKL_VERBOSE is set, the engine is
+//  wrapped so that its own calls are traced as well.
+template <typename function_t, typename... Args>
+static engine_impl* create(const char* name, oneapi::mkl::device libkey,
+                           function_t rng_function_table_t::*entry, Args&... args) {
+    engine_impl* engine = function_tables.call(libkey, entry, args...);
+    if (oneapi::mkl::detail::get_verbose_mode() == oneapi::mkl::detail::verbose_mode::none)
+        return engine;
+    return new traced_engine(engine, name, oneapi::mkl::detail::device_names[libkey],
+                             function_tables.library(libkey, entry));
+}
+
 engine_impl* create_philox4x32x10(oneapi::mkl::device libkey, sycl::queue queue,
                                   std::uint64_t seed) {
-    return function_tables[libkey].create_philox4x32x10_sycl(queue, seed);
+    return create("philox4x32x10", libkey, &rng_function_table_t::create_philox4x32x10_sycl, queue,
+                  seed);
 }
 
 engine_impl* create_philox4x32x10(oneapi::mkl::device libkey, sycl::queue queue,
                                   std::initializer_list<std::uint64_t> seed) {
-    return function_tables[libkey].create_philox4x32x10_ex_sycl(queue, seed);
+    return create("philox4x32x10", libkey, &rng_function_table_t::create_philox4x32x10_ex_sycl,
+                  queue, seed);
 }
 
 engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, sycl::queue queue, std::uint32_t seed) {
-    return function_tables[libkey].create_mrg32k3a_sycl(queue, seed);
+    return create("mrg32k3a", libkey, &rng_function_table_t::create_mrg32k3a_sycl, queue, seed);
 }
 
 engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, sycl::queue queue,
                              std::initializer_list<std::uint32_t> seed) {
-    return function_tables[libkey].create_mrg32k3a_ex_sycl(queue, seed);
+    return create("mrg32k3a", libkey, &rng_function_table_t::create_mrg32k3a_ex_sycl, queue,
+                  seed);
 }
 
+static void preload_tables(oneapi::mkl::device libkey) {
+    function_tables.load_all(libkey);
+}
+
+static oneapi::mkl::detail::preload_registration registration(domain::rng, preload_tables);
+
 } // namespace detail
 } // namespace rng
 } // namespace mkl
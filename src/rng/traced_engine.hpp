@@ -0,0 +1,176 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_RNG_TRACED_ENGINE_HPP_
+#define _ONEMKL_RNG_TRACED_ENGINE_HPP_
+
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl/rng/detail/engine_impl.hpp"
+
+#include "call_trace.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace rng {
+namespace detail {
+
+// Engine returned by the RNG loader when ONEMKL_VERBOSE is set. The calls of an
+//  engine are virtual calls on its engine_impl and do not go through the
+//  function table, so this wrapper traces them before forwarding them to the
+//  engine of the backend. The routine is printed as <engine>::<call> and the
+//  distribution by its type.
+class traced_engine : public engine_impl {
+public:
+    traced_engine(engine_impl* engine, std::string name, const char* device, const char* library)
+            : engine_impl(engine->get_queue()),
+              engine_(engine),
+              name_(std::move(name)),
+              device_(device),
+              library_(library) {}
+
+#define TRACED_GENERATE(T, ...)                                                                 \
+    void generate(const __VA_ARGS__& distr, std::int64_t n, sycl::buffer<T, 1>& r) override {   \
+        trace(                                                                                  \
+            "generate", [&]() { engine_->generate(distr, n, r); },                              \
+            oneapi::mkl::detail::trace_label{ #__VA_ARGS__ }, n, r);                            \
+    }                                                                                           \
+    sycl::event generate(const __VA_ARGS__& distr, std::int64_t n, T* r,                        \
+                         const std::vector<sycl::event>& dependencies) override {               \
+        return trace(                                                                           \
+            "generate", [&]() { return engine_->generate(distr, n, r, dependencies); },         \
+            oneapi::mkl::detail::trace_label{ #__VA_ARGS__ }, n, r, dependencies);              \
+    }
+
+    TRACED_GENERATE(float, uniform<float, uniform_method::standard>)
+    TRACED_GENERATE(double, uniform<double, uniform_method::standard>)
+    TRACED_GENERATE(std::int32_t, uniform<std::int32_t, uniform_method::standard>)
+    TRACED_GENERATE(float, uniform<float, uniform_method::accurate>)
+    TRACED_GENERATE(double, uniform<double, uniform_method::accurate>)
+    TRACED_GENERATE(float, gaussian<float, gaussian_method::box_muller2>)
+    TRACED_GENERATE(double, gaussian<double, gaussian_method::box_muller2>)
+    TRACED_GENERATE(float, gaussian<float, gaussian_method::icdf>)
+    TRACED_GENERATE(double, gaussian<double, gaussian_method::icdf>)
+    TRACED_GENERATE(float, lognormal<float, lognormal_method::box_muller2>)
+    TRACED_GENERATE(double, lognormal<double, lognormal_method::box_muller2>)
+    TRACED_GENERATE(float, lognormal<float, lognormal_method::icdf>)
+    TRACED_GENERATE(double, lognormal<double, lognormal_method::icdf>)
+    TRACED_GENERATE(std::int32_t, bernoulli<std::int32_t, bernoulli_method::icdf>)
+    TRACED_GENERATE(std::uint32_t, bernoulli<std::uint32_t, bernoulli_method::icdf>)
+    TRACED_GENERATE(std::int32_t, poisson<std::int32_t, poisson_method::gaussian_icdf_based>)
+    TRACED_GENERATE(std::uint32_t, poisson<std::uint32_t, poisson_method::gaussian_icdf_based>)
+    TRACED_GENERATE(std::uint32_t, bits<std::uint32_t>)
+    TRACED_GENERATE(float, exponential<float, exponential_method::icdf>)
+    TRACED_GENERATE(double, exponential<double, exponential_method::icdf>)
+    TRACED_GENERATE(float, exponential<float, exponential_method::icdf_accurate>)
+    TRACED_GENERATE(double, exponential<double, exponential_method::icdf_accurate>)
+    TRACED_GENERATE(float, gamma<float, gamma_method::marsaglia>)
+    TRACED_GENERATE(double, gamma<double, gamma_method::marsaglia>)
+    TRACED_GENERATE(float, gamma<float, gamma_method::marsaglia_accurate>)
+    TRACED_GENERATE(double, gamma<double, gamma_method::marsaglia_accurate>)
+    TRACED_GENERATE(float, beta<float, beta_method::cja>)
+    TRACED_GENERATE(double, beta<double, beta_method::cja>)
+    TRACED_GENERATE(float, beta<float, beta_method::cja_accurate>)
+    TRACED_GENERATE(double, beta<double, beta_method::cja_accurate>)
+    TRACED_GENERATE(float, cauchy<float, cauchy_method::icdf>)
+    TRACED_GENERATE(double, cauchy<double, cauchy_method::icdf>)
+    TRACED_GENERATE(float, weibull<float, weibull_method::icdf>)
+    TRACED_GENERATE(double, weibull<double, weibull_method::icdf>)
+    TRACED_GENERATE(float, weibull<float, weibull_method::icdf_accurate>)
+    TRACED_GENERATE(double, weibull<double, weibull_method::icdf_accurate>)
+    TRACED_GENERATE(std::int32_t, discrete<std::int32_t, discrete_method::alias>)
+    TRACED_GENERATE(std::uint32_t, discrete<std::uint32_t, discrete_method::alias>)
+    TRACED_GENERATE(std::int32_t, multinomial<std::int32_t, multinomial_method::poisson_icdf_based>)
+    TRACED_GENERATE(std::uint32_t,
+                    multinomial<std::uint32_t, multinomial_method::poisson_icdf_based>)
+    TRACED_GENERATE(std::int32_t, geometric<std::int32_t, geometric_method::icdf>)
+    TRACED_GENERATE(std::uint32_t, geometric<std::uint32_t, geometric_method::icdf>)
+
+#undef TRACED_GENERATE
+
+    engine_impl* copy_state() override {
+        engine_impl* copy = trace("copy_state", [&]() { return engine_->copy_state(); });
+        return new traced_engine(copy, name_, device_, library_);
+    }
+
+    void skip_ahead(std::uint64_t num_to_skip) override {
+        trace("skip_ahead", [&]() { engine_->skip_ahead(num_to_skip); }, num_to_skip);
+    }
+
+    void skip_ahead(std::initializer_list<std::uint64_t> num_to_skip) override {
+        trace("skip_ahead", [&]() { engine_->skip_ahead(num_to_skip); }, num_to_skip);
+    }
+
+    void leapfrog(std::uint64_t idx, std::uint64_t stride) override {
+        trace("leapfrog", [&]() { engine_->leapfrog(idx, stride); }, idx, stride);
+    }
+
+private:
+    // Runs call and prints its trace, as table_initializer::call does for the
+    //  calls through the function table.
+    template <typename Call, typename... Args>
+    auto trace(const char* routine, Call&& call, const Args&... args) -> decltype(call()) {
+        using result_t = decltype(call());
+        oneapi::mkl::detail::call_trace trace;
+        auto print = [&](const char* error) {
+            trace.print("rng", device_, name_ + "::" + routine, library_, error, args...);
+        };
+        try {
+            if constexpr (std::is_void<result_t>::value) {
+                call();
+                trace.submitted<void>(&queue_, nullptr);
+                print(nullptr);
+            }
+            else {
+                result_t result = call();
+                trace.submitted(&queue_, &result);
+                print(nullptr);
+                return result;
+            }
+        }
+        catch (const std::exception& e) {
+            print(e.what());
+            throw;
+        }
+    }
+
+    std::unique_ptr<engine_impl> engine_;
+    std::string name_;
+    const char* device_;
+    const char* library_;
+};
+
+} // namespace detail
+} // namespace rng
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_RNG_TRACED_ENGINE_HPP_
@@ -0,0 +1,886 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures the latency and GFLOP/s of the BLAS routines:
+*
+*       - level 1: asum, axpy, axpby, copy, dot, dotc, dotu, sdsdot, iamax,
+*         iamin, nrm2, rot, rotg, rotm, rotmg, scal, swap,
+*       - level 2: gemv, gbmv, ger, gerc, geru, symv, sbmv, spmv, hemv, hbmv,
+*         hpmv, syr, spr, her, hpr, syr2, spr2, her2, hpr2, trmv, tbmv, tpmv,
+*         trsv, tbsv, tpsv,
+*       - level 3: gemm, symm, hemm, syrk, herk, syr2k, her2k, trmm, trsm,
+*       - batch: strided and group gemm_batch, trsm_batch, syrk_batch,
+*         gemv_batch, dgmm_batch, axpy_batch, copy_batch, omatcopy_batch,
+*         imatcopy_batch, omatadd_batch,
+*       - extensions: gemmt, omatcopy, imatcopy, omatadd, gemm_bias,
+*
+*       for float, double, complex<float> and complex<double>, over a range of
+*       sizes, with buffers and with USM (USM only for the group API of
+*       gemm_batch), dispatched at run time through the
+*       queue and at compile time through the backend_selector of every
+*       backend built for the device.
+*
+*       Usage: benchmark_blas [--json=<file>] [--filter=<text>] [--quick] ...
+*       See benchmark_common.hpp for the options. The device is selected with
+*       the SYCL default selector.
+*
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl/detail/backend_selector.hpp"
+
+#include "benchmark_common.hpp"
+
+using oneapi::mkl::diag;
+using oneapi::mkl::offset;
+using oneapi::mkl::side;
+using oneapi::mkl::transpose;
+using oneapi::mkl::uplo;
+namespace blas = oneapi::mkl::blas::column_major;
+
+using benchmark::flops;
+using benchmark::is_complex;
+using benchmark::operand;
+using benchmark::session;
+
+namespace benchmark {
+template <>
+inline const char *type_name<std::int8_t>() {
+    return "int8";
+}
+} // namespace benchmark
+
+using parameters = std::vector<std::pair<std::string, std::int64_t>>;
+
+template <typename T>
+using real_t = typename benchmark::real_type<T>::type;
+
+// Makes the batch_size n x n matrices with leading dimension ld, stride
+//  elements apart, well conditioned triangles: unit diagonal and off-diagonal
+//  entries of order 1/n, so repeated in-place products and solves keep the
+//  magnitude of their operands.
+template <typename T>
+typename operand<T>::initializer triangular(std::int64_t n, std::int64_t ld,
+                                            std::int64_t stride = 0,
+                                            std::int64_t batch_size = 1) {
+    return [=](std::vector<T> &values) {
+        for (std::int64_t b = 0; b < batch_size; b++) {
+            for (std::int64_t j = 0; j < n; j++) {
+                for (std::int64_t i = 0; i < n; i++) {
+                    T &value = values[b * stride + i + j * ld];
+                    value = (i == j) ? T(1) : value / static_cast<real_t<T>>(n);
+                }
+            }
+        }
+    };
+}
+
+// Makes an n x n lower triangular band matrix with kd subdiagonals, in band
+//  storage with leading dimension kd + 1, well conditioned like triangular().
+template <typename T>
+typename operand<T>::initializer band_triangular(std::int64_t n, std::int64_t kd) {
+    return [=](std::vector<T> &values) {
+        for (std::int64_t j = 0; j < n; j++) {
+            for (std::int64_t i = 0; i <= kd; i++) {
+                T &value = values[i + j * (kd + 1)];
+                value = (i == 0) ? T(1) : value / static_cast<real_t<T>>(kd + 1);
+            }
+        }
+    };
+}
+
+// Makes an n x n lower triangular matrix in packed storage, well conditioned
+//  like triangular().
+template <typename T>
+typename operand<T>::initializer packed_triangular(std::int64_t n) {
+    return [=](std::vector<T> &values) {
+        std::int64_t index = 0;
+        for (std::int64_t j = 0; j < n; j++) {
+            for (std::int64_t i = j; i < n; i++, index++)
+                values[index] = (i == j) ? T(1) : values[index] / static_cast<real_t<T>>(n);
+        }
+    };
+}
+
+template <typename T>
+using shared_vector = std::vector<T, sycl::usm_allocator<T, sycl::usm::alloc::shared>>;
+
+// Calls f(backend_name, selector) with the backend_selector of every backend
+//  built for the device of queue.
+template <typename F>
+void for_each_ct_backend(sycl::queue &queue, F &&f) {
+    sycl::device device = queue.get_device();
+    if (device.is_cpu()) {
+#ifdef ENABLE_MKLCPU_BACKEND
+        f("mklcpu", oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu>{ queue });
+#endif
+#ifdef ENABLE_NETLIB_BACKEND
+        f("netlib", oneapi::mkl::backend_selector<oneapi::mkl::backend::netlib>{ queue });
+#endif
+    }
+    else if (device.is_gpu()) {
+        unsigned int vendor_id =
+            static_cast<unsigned int>(device.get_info<sycl::info::device::vendor_id>());
+#ifdef ENABLE_MKLGPU_BACKEND
+        if (vendor_id == INTEL_ID)
+            f("mklgpu", oneapi::mkl::backend_selector<oneapi::mkl::backend::mklgpu>{ queue });
+#endif
+#ifdef ENABLE_CUBLAS_BACKEND
+        if (vendor_id == NVIDIA_ID)
+            f("cublas", oneapi::mkl::backend_selector<oneapi::mkl::backend::cublas>{ queue });
+#endif
+#ifdef ENABLE_ROCBLAS_BACKEND
+        if (vendor_id == AMD_ID)
+            f("rocblas", oneapi::mkl::backend_selector<oneapi::mkl::backend::rocblas>{ queue });
+#endif
+        (void)vendor_id;
+    }
+}
+
+// Measures call(target, operands...) with the buffers or with the USM
+//  pointers of the operands, target being the queue (run-time dispatch) or a
+//  backend_selector (compile-time dispatch).
+template <typename T, typename Call, typename... Operands>
+void run_api(session &s, benchmark::result &r, bool use_usm, Call &call, Operands &... ops) {
+    auto invoke = [&](auto &&target) {
+        if (use_usm)
+            call(target, ops.usm()...).wait_and_throw();
+        else {
+            call(target, ops.buffer()...);
+            s.queue.wait_and_throw();
+        }
+    };
+    const char *api = use_usm ? "usm" : "buffer";
+    r.labels = { { "type", benchmark::type_name<T>() }, { "api", api }, { "dispatch", "rt" } };
+    s.report.run(r, [&]() { invoke(s.queue); });
+    for_each_ct_backend(s.queue, [&](const char *backend, auto selector) {
+        r.labels = { { "type", benchmark::type_name<T>() },
+                     { "api", api },
+                     { "dispatch", "ct" },
+                     { "backend", backend } };
+        s.report.run(r, [&]() { invoke(selector); });
+    });
+}
+
+// Measures call with buffers and with USM. flops and bytes are the work and
+//  memory traffic of one call.
+template <typename T, typename Call, typename... Operands>
+void run(session &s, const char *routine, parameters params, double flops, double bytes,
+         Call &&call, Operands &... ops) {
+    benchmark::result r;
+    r.routine = routine;
+    r.parameters = std::move(params);
+    r.flops = flops;
+    r.bytes = bytes;
+    for (bool use_usm : { false, true })
+        run_api<T>(s, r, use_usm, call, ops...);
+}
+
+// Measures call with USM only, for routines without a buffer API.
+template <typename T, typename Call, typename... Operands>
+void run_usm(session &s, const char *routine, parameters params, double flops, double bytes,
+             Call &&call, Operands &... ops) {
+    benchmark::result r;
+    r.routine = routine;
+    r.parameters = std::move(params);
+    r.flops = flops;
+    r.bytes = bytes;
+    run_api<T>(s, r, true, call, ops...);
+}
+
+template <typename T>
+void level1(session &s, std::int64_t n) {
+    const double size = sizeof(T);
+    const T alpha = T(1), beta = T(1);
+    const real_t<T> c = 0.6, sn = 0.8;
+    operand<T> x(s.queue, n), y(s.queue, n), result(s.queue, 1);
+    operand<real_t<T>> real_result(s.queue, 1);
+    operand<std::int64_t> index(s.queue, 1);
+    const parameters p = { { "n", n } };
+
+    run<T>(
+        s, "asum", p, (is_complex<T>::value ? 2.0 : 1.0) * n, n * size,
+        [&](auto &&target, auto &&x, auto &&r) { return blas::asum(target, n, x, 1, r); }, x,
+        real_result);
+    run<T>(
+        s, "axpy", p, flops<T>(n, n), 3.0 * n * size,
+        [&](auto &&target, auto &&x, auto &&y) { return blas::axpy(target, n, alpha, x, 1, y, 1); },
+        x, y);
+    run<T>(
+        s, "axpby", p, flops<T>(2.0 * n, n), 3.0 * n * size,
+        [&](auto &&target, auto &&x, auto &&y) {
+            return blas::axpby(target, n, alpha, x, 1, beta, y, 1);
+        },
+        x, y);
+    run<T>(
+        s, "copy", p, 0.0, 2.0 * n * size,
+        [&](auto &&target, auto &&x, auto &&y) { return blas::copy(target, n, x, 1, y, 1); }, x,
+        y);
+    if constexpr (is_complex<T>::value) {
+        run<T>(
+            s, "dotc", p, flops<T>(n, n), 2.0 * n * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&r) {
+                return blas::dotc(target, n, x, 1, y, 1, r);
+            },
+            x, y, result);
+        run<T>(
+            s, "dotu", p, flops<T>(n, n), 2.0 * n * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&r) {
+                return blas::dotu(target, n, x, 1, y, 1, r);
+            },
+            x, y, result);
+    }
+    else {
+        run<T>(
+            s, "dot", p, flops<T>(n, n), 2.0 * n * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&r) {
+                return blas::dot(target, n, x, 1, y, 1, r);
+            },
+            x, y, result);
+        if constexpr (std::is_same<T, float>::value) {
+            run<T>(
+                s, "sdsdot", p, flops<T>(n, n), 2.0 * n * size,
+                [&](auto &&target, auto &&x, auto &&y, auto &&r) {
+                    return blas::sdsdot(target, n, 1.0f, x, 1, y, 1, r);
+                },
+                x, y, result);
+        }
+    }
+    run<T>(
+        s, "iamax", p, 0.0, n * size,
+        [&](auto &&target, auto &&x, auto &&r) { return blas::iamax(target, n, x, 1, r); }, x,
+        index);
+    run<T>(
+        s, "iamin", p, 0.0, n * size,
+        [&](auto &&target, auto &&x, auto &&r) { return blas::iamin(target, n, x, 1, r); }, x,
+        index);
+    run<T>(
+        s, "nrm2", p, flops<T>(n, n), n * size,
+        [&](auto &&target, auto &&x, auto &&r) { return blas::nrm2(target, n, x, 1, r); }, x,
+        real_result);
+    run<T>(
+        s, "rot", p, (is_complex<T>::value ? 12.0 : 6.0) * n, 4.0 * n * size,
+        [&](auto &&target, auto &&x, auto &&y) { return blas::rot(target, n, x, 1, y, 1, c, sn); },
+        x, y);
+    if constexpr (!is_complex<T>::value) {
+        // Flag -1: the full 2 x 2 matrix H of param is applied
+        operand<T> param(s.queue, 5, [](std::vector<T> &values) { values[0] = T(-1); });
+        run<T>(
+            s, "rotm", p, 6.0 * n, 4.0 * n * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&param) {
+                return blas::rotm(target, n, x, 1, y, 1, param);
+            },
+            x, y, param);
+    }
+    run<T>(
+        s, "scal", p, flops<T>(n, 0), 2.0 * n * size,
+        [&](auto &&target, auto &&x) { return blas::scal(target, n, alpha, x, 1); }, x);
+    run<T>(
+        s, "swap", p, 0.0, 4.0 * n * size,
+        [&](auto &&target, auto &&x, auto &&y) { return blas::swap(target, n, x, 1, y, 1); }, x,
+        y);
+}
+
+// Routines on scalars, which do not depend on a size.
+template <typename T>
+void level1_scalar(session &s) {
+    const double size = sizeof(T);
+    operand<T> a(s.queue, 1), b(s.queue, 1), sn(s.queue, 1);
+    operand<real_t<T>> c(s.queue, 1);
+
+    run<T>(
+        s, "rotg", {}, 0.0, 4.0 * size,
+        [&](auto &&target, auto &&a, auto &&b, auto &&c, auto &&sn) {
+            return blas::rotg(target, a, b, c, sn);
+        },
+        a, b, c, sn);
+    if constexpr (!is_complex<T>::value) {
+        auto positive = [](std::vector<T> &values) { values[0] = std::abs(values[0]) + T(1); };
+        operand<T> d1(s.queue, 1, positive), d2(s.queue, 1, positive), x1(s.queue, 1),
+            param(s.queue, 5);
+        const T y1 = T(1);
+        run<T>(
+            s, "rotmg", {}, 0.0, 8.0 * size,
+            [&](auto &&target, auto &&d1, auto &&d2, auto &&x1, auto &&param) {
+                return blas::rotmg(target, d1, d2, x1, y1, param);
+            },
+            d1, d2, x1, param);
+    }
+}
+
+template <typename T>
+void level2(session &s, std::int64_t n) {
+    const double size = sizeof(T);
+    const double nn = double(n) * n;
+    const double triangle = 0.5 * n * (n + 1);
+    const T alpha = T(1), beta = T(1);
+    operand<T> a(s.queue, n * n), t(s.queue, n * n, triangular<T>(n, n)), x(s.queue, n),
+        y(s.queue, n);
+    const parameters p = { { "n", n } };
+
+    // Band matrices have kd sub- and superdiagonals, packed ones a triangle
+    const std::int64_t kd = std::min<std::int64_t>(n - 1, 32);
+    const double band = double(n) * (2 * kd + 1);
+    const double half_band = double(n) * (kd + 1);
+    const std::int64_t packed = n * (n + 1) / 2;
+    operand<T> ab(s.queue, (2 * kd + 1) * n), tb(s.queue, (kd + 1) * n, band_triangular<T>(n, kd)),
+        ap(s.queue, packed), tp(s.queue, packed, packed_triangular<T>(n));
+    const parameters pk = { { "n", n }, { "k", kd } };
+
+    run<T>(
+        s, "gemv", p, flops<T>(nn, nn), (nn + 3.0 * n) * size,
+        [&](auto &&target, auto &&a, auto &&x, auto &&y) {
+            return blas::gemv(target, transpose::nontrans, n, n, alpha, a, n, x, 1, beta, y, 1);
+        },
+        a, x, y);
+    run<T>(
+        s, "gbmv", { { "m", n }, { "n", n }, { "kl", kd }, { "ku", kd } }, flops<T>(band, band),
+        (band + 3.0 * n) * size,
+        [&](auto &&target, auto &&ab, auto &&x, auto &&y) {
+            return blas::gbmv(target, transpose::nontrans, n, n, kd, kd, alpha, ab, 2 * kd + 1, x,
+                              1, beta, y, 1);
+        },
+        ab, x, y);
+    if constexpr (is_complex<T>::value) {
+        const real_t<T> real_alpha = 1;
+        run<T>(
+            s, "gerc", p, flops<T>(nn, nn), (2.0 * nn + 2.0 * n) * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&a) {
+                return blas::gerc(target, n, n, alpha, x, 1, y, 1, a, n);
+            },
+            x, y, a);
+        run<T>(
+            s, "geru", p, flops<T>(nn, nn), (2.0 * nn + 2.0 * n) * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&a) {
+                return blas::geru(target, n, n, alpha, x, 1, y, 1, a, n);
+            },
+            x, y, a);
+        run<T>(
+            s, "hemv", p, flops<T>(nn, nn), (triangle + 3.0 * n) * size,
+            [&](auto &&target, auto &&a, auto &&x, auto &&y) {
+                return blas::hemv(target, uplo::lower, n, alpha, a, n, x, 1, beta, y, 1);
+            },
+            a, x, y);
+        run<T>(
+            s, "hbmv", pk, flops<T>(band, band), (half_band + 3.0 * n) * size,
+            [&](auto &&target, auto &&ab, auto &&x, auto &&y) {
+                return blas::hbmv(target, uplo::lower, n, kd, alpha, ab, kd + 1, x, 1, beta, y, 1);
+            },
+            ab, x, y);
+        run<T>(
+            s, "hpmv", p, flops<T>(nn, nn), (triangle + 3.0 * n) * size,
+            [&](auto &&target, auto &&ap, auto &&x, auto &&y) {
+                return blas::hpmv(target, uplo::lower, n, alpha, ap, x, 1, beta, y, 1);
+            },
+            ap, x, y);
+        run<T>(
+            s, "hpr", p, flops<T>(triangle, triangle), (2.0 * triangle + n) * size,
+            [&](auto &&target, auto &&x, auto &&ap) {
+                return blas::hpr(target, uplo::lower, n, real_alpha, x, 1, ap);
+            },
+            x, ap);
+        run<T>(
+            s, "hpr2", p, flops<T>(2.0 * triangle, 2.0 * triangle),
+            (2.0 * triangle + 2.0 * n) * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&ap) {
+                return blas::hpr2(target, uplo::lower, n, alpha, x, 1, y, 1, ap);
+            },
+            x, y, ap);
+        run<T>(
+            s, "her", p, flops<T>(triangle, triangle), (2.0 * triangle + n) * size,
+            [&](auto &&target, auto &&x, auto &&a) {
+                return blas::her(target, uplo::lower, n, real_alpha, x, 1, a, n);
+            },
+            x, a);
+        run<T>(
+            s, "her2", p, flops<T>(2.0 * triangle, 2.0 * triangle),
+            (2.0 * triangle + 2.0 * n) * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&a) {
+                return blas::her2(target, uplo::lower, n, alpha, x, 1, y, 1, a, n);
+            },
+            x, y, a);
+    }
+    else {
+        run<T>(
+            s, "ger", p, flops<T>(nn, nn), (2.0 * nn + 2.0 * n) * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&a) {
+                return blas::ger(target, n, n, alpha, x, 1, y, 1, a, n);
+            },
+            x, y, a);
+        run<T>(
+            s, "symv", p, flops<T>(nn, nn), (triangle + 3.0 * n) * size,
+            [&](auto &&target, auto &&a, auto &&x, auto &&y) {
+                return blas::symv(target, uplo::lower, n, alpha, a, n, x, 1, beta, y, 1);
+            },
+            a, x, y);
+        run<T>(
+            s, "sbmv", pk, flops<T>(band, band), (half_band + 3.0 * n) * size,
+            [&](auto &&target, auto &&ab, auto &&x, auto &&y) {
+                return blas::sbmv(target, uplo::lower, n, kd, alpha, ab, kd + 1, x, 1, beta, y, 1);
+            },
+            ab, x, y);
+        run<T>(
+            s, "spmv", p, flops<T>(nn, nn), (triangle + 3.0 * n) * size,
+            [&](auto &&target, auto &&ap, auto &&x, auto &&y) {
+                return blas::spmv(target, uplo::lower, n, alpha, ap, x, 1, beta, y, 1);
+            },
+            ap, x, y);
+        run<T>(
+            s, "spr", p, flops<T>(triangle, triangle), (2.0 * triangle + n) * size,
+            [&](auto &&target, auto &&x, auto &&ap) {
+                return blas::spr(target, uplo::lower, n, alpha, x, 1, ap);
+            },
+            x, ap);
+        run<T>(
+            s, "spr2", p, flops<T>(2.0 * triangle, 2.0 * triangle),
+            (2.0 * triangle + 2.0 * n) * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&ap) {
+                return blas::spr2(target, uplo::lower, n, alpha, x, 1, y, 1, ap);
+            },
+            x, y, ap);
+        run<T>(
+            s, "syr", p, flops<T>(triangle, triangle), (2.0 * triangle + n) * size,
+            [&](auto &&target, auto &&x, auto &&a) {
+                return blas::syr(target, uplo::lower, n, alpha, x, 1, a, n);
+            },
+            x, a);
+        run<T>(
+            s, "syr2", p, flops<T>(2.0 * triangle, 2.0 * triangle),
+            (2.0 * triangle + 2.0 * n) * size,
+            [&](auto &&target, auto &&x, auto &&y, auto &&a) {
+                return blas::syr2(target, uplo::lower, n, alpha, x, 1, y, 1, a, n);
+            },
+            x, y, a);
+    }
+    run<T>(
+        s, "trmv", p, flops<T>(triangle, triangle), (triangle + 2.0 * n) * size,
+        [&](auto &&target, auto &&t, auto &&x) {
+            return blas::trmv(target, uplo::lower, transpose::nontrans, diag::nonunit, n, t, n, x,
+                              1);
+        },
+        t, x);
+    run<T>(
+        s, "trsv", p, flops<T>(triangle, triangle), (triangle + 2.0 * n) * size,
+        [&](auto &&target, auto &&t, auto &&x) {
+            return blas::trsv(target, uplo::lower, transpose::nontrans, diag::nonunit, n, t, n, x,
+                              1);
+        },
+        t, x);
+    run<T>(
+        s, "tbmv", pk, flops<T>(half_band, half_band), (half_band + 2.0 * n) * size,
+        [&](auto &&target, auto &&tb, auto &&x) {
+            return blas::tbmv(target, uplo::lower, transpose::nontrans, diag::nonunit, n, kd, tb,
+                              kd + 1, x, 1);
+        },
+        tb, x);
+    run<T>(
+        s, "tbsv", pk, flops<T>(half_band, half_band), (half_band + 2.0 * n) * size,
+        [&](auto &&target, auto &&tb, auto &&x) {
+            return blas::tbsv(target, uplo::lower, transpose::nontrans, diag::nonunit, n, kd, tb,
+                              kd + 1, x, 1);
+        },
+        tb, x);
+    run<T>(
+        s, "tpmv", p, flops<T>(triangle, triangle), (triangle + 2.0 * n) * size,
+        [&](auto &&target, auto &&tp, auto &&x) {
+            return blas::tpmv(target, uplo::lower, transpose::nontrans, diag::nonunit, n, tp, x,
+                              1);
+        },
+        tp, x);
+    run<T>(
+        s, "tpsv", p, flops<T>(triangle, triangle), (triangle + 2.0 * n) * size,
+        [&](auto &&target, auto &&tp, auto &&x) {
+            return blas::tpsv(target, uplo::lower, transpose::nontrans, diag::nonunit, n, tp, x,
+                              1);
+        },
+        tp, x);
+}
+
+template <typename T>
+void level3(session &s, std::int64_t n) {
+    const double size = sizeof(T);
+    const double nn = double(n) * n;
+    const double nnn = nn * n;
+    const double rank_k = 0.5 * n * (n + 1) * n;
+    const T alpha = T(1), beta = T(1);
+    operand<T> a(s.queue, n * n), b(s.queue, n * n), c(s.queue, n * n),
+        t(s.queue, n * n, triangular<T>(n, n));
+    const parameters p = { { "m", n }, { "n", n }, { "k", n } };
+
+    run<T>(
+        s, "gemm", p, flops<T>(nnn, nnn), 4.0 * nn * size,
+        [&](auto &&target, auto &&a, auto &&b, auto &&c) {
+            return blas::gemm(target, transpose::nontrans, transpose::nontrans, n, n, n, alpha, a,
+                              n, b, n, beta, c, n);
+        },
+        a, b, c);
+    run<T>(
+        s, "symm", p, flops<T>(nnn, nnn), 3.5 * nn * size,
+        [&](auto &&target, auto &&a, auto &&b, auto &&c) {
+            return blas::symm(target, side::left, uplo::lower, n, n, alpha, a, n, b, n, beta, c,
+                              n);
+        },
+        a, b, c);
+    run<T>(
+        s, "syrk", p, flops<T>(rank_k, rank_k), 2.0 * nn * size,
+        [&](auto &&target, auto &&a, auto &&c) {
+            return blas::syrk(target, uplo::lower, transpose::nontrans, n, n, alpha, a, n, beta,
+                              c, n);
+        },
+        a, c);
+    run<T>(
+        s, "syr2k", p, flops<T>(2.0 * rank_k, 2.0 * rank_k), 3.0 * nn * size,
+        [&](auto &&target, auto &&a, auto &&b, auto &&c) {
+            return blas::syr2k(target, uplo::lower, transpose::nontrans, n, n, alpha, a, n, b, n,
+                               beta, c, n);
+        },
+        a, b, c);
+    if constexpr (is_complex<T>::value) {
+        const real_t<T> real_alpha = 1, real_beta = 1;
+        run<T>(
+            s, "hemm", p, flops<T>(nnn, nnn), 3.5 * nn * size,
+            [&](auto &&target, auto &&a, auto &&b, auto &&c) {
+                return blas::hemm(target, side::left, uplo::lower, n, n, alpha, a, n, b, n, beta,
+                                  c, n);
+            },
+            a, b, c);
+        run<T>(
+            s, "herk", p, flops<T>(rank_k, rank_k), 2.0 * nn * size,
+            [&](auto &&target, auto &&a, auto &&c) {
+                return blas::herk(target, uplo::lower, transpose::nontrans, n, n, real_alpha, a, n,
+                                  real_beta, c, n);
+            },
+            a, c);
+        run<T>(
+            s, "her2k", p, flops<T>(2.0 * rank_k, 2.0 * rank_k), 3.0 * nn * size,
+            [&](auto &&target, auto &&a, auto &&b, auto &&c) {
+                return blas::her2k(target, uplo::lower, transpose::nontrans, n, n, alpha, a, n, b,
+                                   n, real_beta, c, n);
+            },
+            a, b, c);
+    }
+    run<T>(
+        s, "trmm", p, flops<T>(0.5 * nnn, 0.5 * nnn), 2.5 * nn * size,
+        [&](auto &&target, auto &&t, auto &&b) {
+            return blas::trmm(target, side::left, uplo::lower, transpose::nontrans, diag::nonunit,
+                              n, n, alpha, t, n, b, n);
+        },
+        t, b);
+    run<T>(
+        s, "trsm", p, flops<T>(0.5 * nnn, 0.5 * nnn), 2.5 * nn * size,
+        [&](auto &&target, auto &&t, auto &&b) {
+            return blas::trsm(target, side::left, uplo::lower, transpose::nontrans, diag::nonunit,
+                              n, n, alpha, t, n, b, n);
+        },
+        t, b);
+}
+
+// Batch size giving about 4M elements per operand for matrices (or vectors) of
+//  the given number of elements.
+inline std::int64_t batch_size_for(std::int64_t elements) {
+    return std::max<std::int64_t>(1, (std::int64_t(1) << 22) / elements);
+}
+
+template <typename T>
+void batch_matrix(session &s, std::int64_t n) {
+    const double size = sizeof(T);
+    const std::int64_t stride = n * n;
+    const std::int64_t batch_size = batch_size_for(stride);
+    const double nn = double(n) * n * batch_size;
+    const double nnn = nn * n;
+    const T alpha = T(1), beta = T(1);
+    operand<T> a(s.queue, stride * batch_size), b(s.queue, stride * batch_size),
+        c(s.queue, stride * batch_size),
+        t(s.queue, stride * batch_size, triangular<T>(n, n, stride, batch_size));
+    const parameters p = { { "m", n }, { "n", n }, { "k", n }, { "batch_size", batch_size } };
+
+    run<T>(
+        s, "gemm_batch", p, flops<T>(nnn, nnn), 4.0 * nn * size,
+        [&](auto &&target, auto &&a, auto &&b, auto &&c) {
+            return blas::gemm_batch(target, transpose::nontrans, transpose::nontrans, n, n, n,
+                                    alpha, a, n, stride, b, n, stride, beta, c, n, stride,
+                                    batch_size);
+        },
+        a, b, c);
+    run<T>(
+        s, "trsm_batch", p, flops<T>(0.5 * nnn, 0.5 * nnn), 2.5 * nn * size,
+        [&](auto &&target, auto &&t, auto &&b) {
+            return blas::trsm_batch(target, side::left, uplo::lower, transpose::nontrans,
+                                    diag::nonunit, n, n, alpha, t, n, stride, b, n, stride,
+                                    batch_size);
+        },
+        t, b);
+    run<T>(
+        s, "syrk_batch", p, flops<T>(0.5 * (n + 1) * nn, 0.5 * (n + 1) * nn), 2.0 * nn * size,
+        [&](auto &&target, auto &&a, auto &&c) {
+            return blas::syrk_batch(target, uplo::lower, transpose::nontrans, n, n, alpha, a, n,
+                                    stride, beta, c, n, stride, batch_size);
+        },
+        a, c);
+    run<T>(
+        s, "omatcopy_batch", p, flops<T>(nn, 0), 2.0 * nn * size,
+        [&](auto &&target, auto &&a, auto &&b) {
+            return blas::omatcopy_batch(target, transpose::trans, n, n, alpha, a, n, stride, b, n,
+                                        stride, batch_size);
+        },
+        a, b);
+    run<T>(
+        s, "imatcopy_batch", p, flops<T>(nn, 0), 2.0 * nn * size,
+        [&](auto &&target, auto &&ab) {
+            return blas::imatcopy_batch(target, transpose::trans, n, n, alpha, ab, n, n, stride,
+                                        batch_size);
+        },
+        a);
+    run<T>(
+        s, "omatadd_batch", p, flops<T>(2.0 * nn, nn), 3.0 * nn * size,
+        [&](auto &&target, auto &&a, auto &&b, auto &&c) {
+            return blas::omatadd_batch(target, transpose::nontrans, transpose::trans, n, n, alpha,
+                                       a, n, stride, beta, b, n, stride, c, n, stride, batch_size);
+        },
+        a, b, c);
+}
+
+// Group API of gemm_batch, which only takes USM: one group of n x n and one
+//  of n/2 x n/2 products, which the backend has to balance between threads.
+template <typename T>
+void batch_group(session &s, std::int64_t n) {
+    const double size = sizeof(T);
+    const std::int64_t group_count = 2;
+    const std::int64_t dims[group_count] = { n, std::max<std::int64_t>(1, n / 2) };
+    shared_vector<transpose> trans(group_count, transpose::nontrans, { s.queue });
+    shared_vector<std::int64_t> dim(dims, dims + group_count, { s.queue });
+    shared_vector<std::int64_t> group_size(group_count, 0, { s.queue });
+    shared_vector<T> alpha(group_count, T(1), { s.queue }), beta(group_count, T(1), { s.queue });
+
+    std::int64_t batch_size = 0, elements = 0;
+    double muls = 0.0;
+    for (std::int64_t g = 0; g < group_count; g++) {
+        group_size[g] = batch_size_for(dim[g] * dim[g]);
+        batch_size += group_size[g];
+        elements += group_size[g] * dim[g] * dim[g];
+        muls += double(group_size[g]) * dim[g] * dim[g] * dim[g];
+    }
+
+    // The operands stay in USM, so the pointers into them are set once.
+    operand<T> a(s.queue, elements), b(s.queue, elements), c(s.queue, elements);
+    shared_vector<const T *> a_array(batch_size, nullptr, { s.queue }),
+        b_array(batch_size, nullptr, { s.queue });
+    shared_vector<T *> c_array(batch_size, nullptr, { s.queue });
+    for (std::int64_t g = 0, i = 0, offset = 0; g < group_count; g++) {
+        for (std::int64_t j = 0; j < group_size[g]; j++, i++, offset += dim[g] * dim[g]) {
+            a_array[i] = a.usm() + offset;
+            b_array[i] = b.usm() + offset;
+            c_array[i] = c.usm() + offset;
+        }
+    }
+    const parameters p = { { "n", n },
+                           { "group_count", group_count },
+                           { "batch_size", batch_size } };
+
+    run_usm<T>(s, "gemm_batch_group", p, flops<T>(muls, muls), 4.0 * elements * size,
+               [&](auto &&target) {
+                   return blas::gemm_batch(target, trans.data(), trans.data(), dim.data(),
+                                           dim.data(), dim.data(), alpha.data(), a_array.data(),
+                                           dim.data(), b_array.data(), dim.data(), beta.data(),
+                                           c_array.data(), dim.data(), group_count,
+                                           group_size.data());
+               });
+}
+
+template <typename T>
+void batch_matrix_vector(session &s, std::int64_t n) {
+    const double size = sizeof(T);
+    const std::int64_t stride = n * n;
+    const std::int64_t batch_size = batch_size_for(stride);
+    const double nn = double(n) * n * batch_size;
+    const double vectors = double(n) * batch_size;
+    const T alpha = T(1), beta = T(1);
+    operand<T> a(s.queue, stride * batch_size), c(s.queue, stride * batch_size),
+        x(s.queue, n * batch_size), y(s.queue, n * batch_size);
+    const parameters p = { { "m", n }, { "n", n }, { "batch_size", batch_size } };
+
+    run<T>(
+        s, "gemv_batch", p, flops<T>(nn, nn), (nn + 3.0 * vectors) * size,
+        [&](auto &&target, auto &&a, auto &&x, auto &&y) {
+            return blas::gemv_batch(target, transpose::nontrans, n, n, alpha, a, n, stride, x, 1,
+                                    n, beta, y, 1, n, batch_size);
+        },
+        a, x, y);
+    run<T>(
+        s, "dgmm_batch", p, flops<T>(nn, 0), (2.0 * nn + vectors) * size,
+        [&](auto &&target, auto &&a, auto &&x, auto &&c) {
+            return blas::dgmm_batch(target, side::left, n, n, a, n, stride, x, 1, n, c, n, stride,
+                                    batch_size);
+        },
+        a, x, c);
+}
+
+template <typename T>
+void batch_vector(session &s, std::int64_t n) {
+    const double size = sizeof(T);
+    const std::int64_t batch_size = batch_size_for(n);
+    const double elements = double(n) * batch_size;
+    const T alpha = T(1);
+    operand<T> x(s.queue, n * batch_size), y(s.queue, n * batch_size);
+    const parameters p = { { "n", n }, { "batch_size", batch_size } };
+
+    run<T>(
+        s, "axpy_batch", p, flops<T>(elements, elements), 3.0 * elements * size,
+        [&](auto &&target, auto &&x, auto &&y) {
+            return blas::axpy_batch(target, n, alpha, x, 1, n, y, 1, n, batch_size);
+        },
+        x, y);
+    run<T>(
+        s, "copy_batch", p, 0.0, 2.0 * elements * size,
+        [&](auto &&target, auto &&x, auto &&y) {
+            return blas::copy_batch(target, n, x, 1, n, y, 1, n, batch_size);
+        },
+        x, y);
+}
+
+template <typename T>
+void extensions(session &s, std::int64_t n) {
+    const double size = sizeof(T);
+    const double nn = double(n) * n;
+    const double rank_k = 0.5 * n * (n + 1) * n;
+    const T alpha = T(1), beta = T(1);
+    operand<T> a(s.queue, n * n), b(s.queue, n * n), c(s.queue, n * n);
+    const parameters p = { { "m", n }, { "n", n } };
+
+    run<T>(
+        s, "gemmt", { { "n", n }, { "k", n } }, flops<T>(rank_k, rank_k), 3.0 * nn * size,
+        [&](auto &&target, auto &&a, auto &&b, auto &&c) {
+            return blas::gemmt(target, uplo::lower, transpose::nontrans, transpose::nontrans, n, n,
+                               alpha, a, n, b, n, beta, c, n);
+        },
+        a, b, c);
+    run<T>(
+        s, "omatcopy", p, flops<T>(nn, 0), 2.0 * nn * size,
+        [&](auto &&target, auto &&a, auto &&b) {
+            return blas::omatcopy(target, transpose::trans, n, n, alpha, a, n, b, n);
+        },
+        a, b);
+    run<T>(
+        s, "imatcopy", p, flops<T>(nn, 0), 2.0 * nn * size,
+        [&](auto &&target, auto &&ab) {
+            return blas::imatcopy(target, transpose::trans, n, n, alpha, ab, n, n);
+        },
+        a);
+    run<T>(
+        s, "omatadd", p, flops<T>(2.0 * nn, nn), 3.0 * nn * size,
+        [&](auto &&target, auto &&a, auto &&b, auto &&c) {
+            return blas::omatadd(target, transpose::nontrans, transpose::trans, n, n, alpha, a, n,
+                                 beta, b, n, c, n);
+        },
+        a, b, c);
+}
+
+void gemm_bias(session &s, std::int64_t n) {
+    const double nn = double(n) * n;
+    operand<std::int8_t> a(s.queue, n * n);
+    operand<std::uint8_t> b(s.queue, n * n);
+    operand<std::int32_t> c(s.queue, n * n), co(s.queue, 1);
+    run<std::int8_t>(
+        s, "gemm_bias", { { "m", n }, { "n", n }, { "k", n } }, 2.0 * nn * n,
+        nn * (2.0 + 2.0 * sizeof(std::int32_t)),
+        [&](auto &&target, auto &&a, auto &&b, auto &&c, auto &&co) {
+            return blas::gemm_bias(target, transpose::nontrans, transpose::nontrans, offset::fix,
+                                   n, n, n, 1.0f, a, n, std::int8_t(0), b, n, std::uint8_t(0),
+                                   1.0f, c, n, co);
+        },
+        a, b, c, co);
+}
+
+template <typename T>
+void run_type(session &s) {
+    if (!benchmark::is_supported<T>(s.queue)) {
+        std::cout << benchmark::type_name<T>() << " is not supported by the device, skipped"
+                  << std::endl;
+        return;
+    }
+    for (auto n : s.sizes({ 1 << 10, 1 << 14, 1 << 18, 1 << 22 }))
+        level1<T>(s, n);
+    level1_scalar<T>(s);
+    for (auto n : s.sizes({ 128, 512, 2048 }))
+        level2<T>(s, n);
+    for (auto n : s.sizes({ 64, 256, 1024 }))
+        level3<T>(s, n);
+    for (auto n : s.sizes({ 4, 16, 32, 64 }))
+        batch_matrix<T>(s, n);
+    for (auto n : s.sizes({ 4, 16, 32, 64 }))
+        batch_group<T>(s, n);
+    for (auto n : s.sizes({ 16, 128 }))
+        batch_matrix_vector<T>(s, n);
+    for (auto n : s.sizes({ 64, 4096 }))
+        batch_vector<T>(s, n);
+    for (auto n : s.sizes({ 128, 512, 2048 }))
+        extensions<T>(s, n);
+}
+
+int main(int argc, char **argv) {
+    benchmark::options opts;
+    if (!benchmark::parse_options(argc, argv, opts))
+        return 1;
+
+    try {
+        sycl::queue queue((sycl::default_selector()));
+        session s{ queue, benchmark::reporter("blas", opts, queue) };
+
+        run_type<float>(s);
+        run_type<double>(s);
+        run_type<std::complex<float>>(s);
+        run_type<std::complex<double>>(s);
+        for (auto n : s.sizes({ 64, 256, 1024 }))
+            gemm_bias(s, n);
+
+        if (!s.report.write_json())
+            return 1;
+    }
+    catch (sycl::exception const &e) {
+        std::cerr << "Caught synchronous SYCL exception:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        return 1;
+    }
+    catch (std::exception const &e) {
+        std::cerr << "Caught std::exception:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
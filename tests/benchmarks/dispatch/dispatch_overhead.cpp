@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures the per-call overhead of run-time dispatching:
+*
+*       - classifying the device of a queue with the SYCL runtime queries
+*         (the cost every call paid before device classification was cached),
+*       - the cached oneapi::mkl::get_device_id used by run-time dispatching,
+*       - a complete run-time dispatched call of a 1-element USM axpy,
+*         including the wait on its event.
+*
+*       Usage: benchmark_dispatch_overhead [iterations]
+*       The device is selected with the SYCL default selector.
+*
+*******************************************************************************/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/mkl.hpp"
+
+// Average time of f() in nanoseconds over iterations calls, after a warm-up
+//  call.
+template <typename F>
+double ns_per_call(std::int64_t iterations, F f) {
+    f();
+    auto start = std::chrono::steady_clock::now();
+    for (std::int64_t i = 0; i < iterations; i++)
+        f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / iterations;
+}
+
+int main(int argc, char **argv) {
+    std::int64_t iterations = (argc > 1) ? std::atoll(argv[1]) : 100000;
+    if (iterations <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [iterations]" << std::endl;
+        return 1;
+    }
+
+    try {
+        sycl::queue queue((sycl::default_selector()));
+        std::cout << "Device: " << queue.get_device().get_info<sycl::info::device::name>()
+                  << std::endl;
+        std::cout << "Iterations: " << iterations << std::endl;
+
+        volatile int sink = 0;
+        double uncached = ns_per_call(iterations, [&]() {
+            sink = static_cast<int>(oneapi::mkl::detail::query_device_id(queue));
+        });
+        double cached = ns_per_call(iterations, [&]() {
+            sink = static_cast<int>(oneapi::mkl::get_device_id(queue));
+        });
+
+        float *x = sycl::malloc_shared<float>(1, queue);
+        float *y = sycl::malloc_shared<float>(1, queue);
+        x[0] = 1.0f;
+        y[0] = 0.0f;
+        double axpy = ns_per_call(iterations, [&]() {
+            oneapi::mkl::blas::column_major::axpy(queue, 1, 1.0f, x, 1, y, 1).wait();
+        });
+        sycl::free(x, queue);
+        sycl::free(y, queue);
+
+        std::cout << "device classification (uncached): " << uncached << " ns/call" << std::endl;
+        std::cout << "get_device_id (cached):           " << cached << " ns/call" << std::endl;
+        std::cout << "axpy n=1, run-time dispatched:    " << axpy << " ns/call" << std::endl;
+    }
+    catch (sycl::exception const &e) {
+        std::cerr << "Caught synchronous SYCL exception:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        return 1;
+    }
+    catch (std::exception const &e) {
+        std::cerr << "Caught std::exception:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,511 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _BENCHMARK_COMMON_HPP_
+#define _BENCHMARK_COMMON_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/mkl/exceptions.hpp"
+
+/**
+ * Self-contained harness shared by the domain benchmarks.
+ *
+ * Every measurement runs its operation once to warm up (loading the backend
+ * library and touching the operands), then repeats it until both the minimum
+ * number of repetitions and the minimum time are reached, or the maximum
+ * number of repetitions is. Each repetition is timed separately, including the
+ * wait for its completion, and the minimum, median and mean times are
+ * reported. Results are printed as a table and can be written to a JSON file
+ * whose layout ("context" and "benchmarks") follows the Google Benchmark one,
+ * so existing comparison tools can track them.
+ *
+ * Command line options:
+ *   --json=<file>          write the results to <file>
+ *   --filter=<text>        only run the benchmarks whose name contains <text>
+ *   --min-time=<seconds>   minimum time of a measurement (default 0.2)
+ *   --min-iterations=<n>   minimum number of repetitions (default 3)
+ *   --max-iterations=<n>   maximum number of repetitions (default 1000)
+ *   --quick                only run the smaller problem sizes
+ */
+
+namespace benchmark {
+
+template <typename T>
+struct is_complex : std::false_type {};
+template <typename T>
+struct is_complex<std::complex<T>> : std::true_type {};
+
+template <typename T>
+struct real_type {
+    using type = T;
+};
+template <typename T>
+struct real_type<std::complex<T>> {
+    using type = T;
+};
+
+template <typename T>
+const char *type_name();
+template <>
+inline const char *type_name<float>() {
+    return "float";
+}
+template <>
+inline const char *type_name<double>() {
+    return "double";
+}
+template <>
+inline const char *type_name<std::complex<float>>() {
+    return "complex<float>";
+}
+template <>
+inline const char *type_name<std::complex<double>>() {
+    return "complex<double>";
+}
+
+// Number of real floating point operations of muls multiplications and adds
+//  additions in T: a complex multiplication counts 6 and a complex addition 2.
+template <typename T>
+inline double flops(double muls, double adds) {
+    return is_complex<T>::value ? 6.0 * muls + 2.0 * adds : muls + adds;
+}
+
+// Whether T can be used on the device of queue.
+template <typename T>
+inline bool is_supported(sycl::queue &queue) {
+    return !std::is_same<typename real_type<T>::type, double>::value ||
+           queue.get_device().has(sycl::aspect::fp64);
+}
+
+// Uniform random value in [-0.5, 0.5) (both parts for complex types), or in
+//  [0, 8) for integer types.
+template <typename T>
+T random_value(std::mt19937_64 &engine) {
+    std::uniform_real_distribution<double> dist(-0.5, 0.5);
+    if constexpr (is_complex<T>::value)
+        return T(dist(engine), dist(engine));
+    else if constexpr (std::is_floating_point<T>::value)
+        return T(dist(engine));
+    else
+        return T(engine() % 8);
+}
+
+// Operand of a benchmarked routine. Its values are generated on first use:
+//  random values, optionally modified by an initializer (to make a matrix
+//  triangular or positive definite, for instance). They are then copied to a
+//  buffer or to a USM device allocation depending on the API being measured;
+//  switching API releases the other copy. restore() copies the values to the
+//  device copy again, for routines that overwrite their inputs.
+template <typename T>
+class operand {
+public:
+    using initializer = std::function<void(std::vector<T> &)>;
+
+    operand(sycl::queue &queue, std::int64_t size, initializer init = nullptr)
+            : queue_(queue),
+              size_(std::max<std::int64_t>(size, 1)),
+              init_(std::move(init)) {}
+    operand(const operand &) = delete;
+    operand &operator=(const operand &) = delete;
+    ~operand() {
+        free_usm();
+    }
+
+    std::int64_t size() const {
+        return size_;
+    }
+
+    sycl::buffer<T, 1> &buffer() {
+        if (!buffer_) {
+            free_usm();
+            buffer_.reset(new sycl::buffer<T, 1>(sycl::range<1>(size_)));
+            restore();
+        }
+        return *buffer_;
+    }
+
+    T *usm() {
+        if (!usm_) {
+            buffer_.reset();
+            usm_ = sycl::malloc_device<T>(size_, queue_);
+            restore();
+        }
+        return usm_;
+    }
+
+    void restore() {
+        const std::vector<T> &v = values();
+        if (usm_)
+            queue_.memcpy(usm_, v.data(), size_ * sizeof(T)).wait();
+        else if (buffer_) {
+            queue_
+                .submit([&](sycl::handler &cgh) {
+                    auto acc = buffer_->template get_access<sycl::access::mode::discard_write>(cgh);
+                    cgh.copy(v.data(), acc);
+                })
+                .wait();
+        }
+    }
+
+private:
+    const std::vector<T> &values() {
+        if (values_.empty()) {
+            values_.resize(size_);
+            std::mt19937_64 engine(size_);
+            for (auto &value : values_)
+                value = random_value<T>(engine);
+            if (init_)
+                init_(values_);
+        }
+        return values_;
+    }
+
+    void free_usm() {
+        if (usm_)
+            sycl::free(usm_, queue_);
+        usm_ = nullptr;
+    }
+
+    sycl::queue queue_;
+    std::int64_t size_;
+    initializer init_;
+    std::vector<T> values_;
+    std::unique_ptr<sycl::buffer<T, 1>> buffer_;
+    T *usm_ = nullptr;
+};
+
+struct options {
+    std::string json_file;
+    std::string filter;
+    double min_time = 0.2;
+    std::int64_t min_iterations = 3;
+    std::int64_t max_iterations = 1000;
+    bool quick = false;
+};
+
+// Parses the command line into opts; returns false and prints the usage on
+//  unknown or malformed options.
+inline bool parse_options(int argc, char **argv, options &opts) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&](const char *name) -> const char * {
+            std::string prefix = std::string(name) + "=";
+            return (arg.compare(0, prefix.size(), prefix) == 0) ? argv[i] + prefix.size()
+                                                               : nullptr;
+        };
+        if (const char *v = value("--json"))
+            opts.json_file = v;
+        else if (const char *v = value("--filter"))
+            opts.filter = v;
+        else if (const char *v = value("--min-time"))
+            opts.min_time = std::atof(v);
+        else if (const char *v = value("--min-iterations"))
+            opts.min_iterations = std::atoll(v);
+        else if (const char *v = value("--max-iterations"))
+            opts.max_iterations = std::atoll(v);
+        else if (arg == "--quick")
+            opts.quick = true;
+        else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--json=<file>] [--filter=<text>] [--min-time=<seconds>]"
+                      << " [--min-iterations=<n>] [--max-iterations=<n>] [--quick]" << std::endl;
+            return false;
+        }
+    }
+    opts.min_iterations = std::max<std::int64_t>(opts.min_iterations, 1);
+    opts.max_iterations = std::max(opts.max_iterations, opts.min_iterations);
+    return true;
+}
+
+struct statistics {
+    std::int64_t iterations = 0;
+    double min_ns = 0.0;
+    double median_ns = 0.0;
+    double mean_ns = 0.0;
+};
+
+struct result {
+    // Name of the measured routine or operation.
+    std::string routine;
+    // Textual attributes (type, memory API, dispatch mode, ...), in order.
+    std::vector<std::pair<std::string, std::string>> labels;
+    // Problem dimensions, in order.
+    std::vector<std::pair<std::string, std::int64_t>> parameters;
+    // Work of one repetition, used for the rates; 0 when not meaningful.
+    double flops = 0.0;
+    double bytes = 0.0;
+    double items = 0.0;
+    // Additional values written to the JSON output, e.g. workspace sizes.
+    std::vector<std::pair<std::string, double>> counters;
+
+    statistics time;
+    // Reason the measurement was skipped, empty when it ran.
+    std::string skipped;
+
+    std::string name() const {
+        std::string name = routine;
+        for (auto &label : labels)
+            name += "/" + label.second;
+        for (auto &parameter : parameters)
+            name += "/" + parameter.first + "=" + std::to_string(parameter.second);
+        return name;
+    }
+};
+
+// Times f() as described above, calling setup() untimed before every call of
+//  f().
+template <typename Setup, typename F>
+statistics measure(const options &opts, Setup &&setup, F &&f) {
+    using clock = std::chrono::steady_clock;
+    setup();
+    f();
+    std::vector<double> samples;
+    const auto begin = clock::now();
+    while (static_cast<std::int64_t>(samples.size()) < opts.max_iterations) {
+        const double elapsed = std::chrono::duration<double>(clock::now() - begin).count();
+        if (static_cast<std::int64_t>(samples.size()) >= opts.min_iterations &&
+            elapsed >= opts.min_time)
+            break;
+        setup();
+        const auto start = clock::now();
+        f();
+        const auto stop = clock::now();
+        samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+
+    statistics stats;
+    stats.iterations = static_cast<std::int64_t>(samples.size());
+    std::sort(samples.begin(), samples.end());
+    stats.min_ns = samples.front();
+    const std::size_t middle = samples.size() / 2;
+    stats.median_ns = (samples.size() % 2) ? samples[middle]
+                                           : 0.5 * (samples[middle - 1] + samples[middle]);
+    stats.mean_ns = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+    return stats;
+}
+
+template <typename F>
+statistics measure(const options &opts, F &&f) {
+    return measure(
+        opts, []() {}, std::forward<F>(f));
+}
+
+inline std::string json_string(const std::string &s) {
+    std::string out = "\"";
+    for (char c : s) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out += escaped;
+                }
+                else
+                    out += c;
+        }
+    }
+    return out + "\"";
+}
+
+// Runs the measurements, prints them and collects them for the JSON output.
+class reporter {
+public:
+    reporter(std::string benchmark, const options &opts, sycl::queue &queue)
+            : benchmark_(std::move(benchmark)),
+              opts_(opts),
+              device_(queue.get_device().get_info<sycl::info::device::name>()) {
+        std::cout << "Benchmark: " << benchmark_ << std::endl;
+        std::cout << "Device: " << device_ << std::endl;
+        std::printf("%-64s %10s %12s %12s %10s %10s\n", "name", "iterations", "median (us)",
+                    "min (us)", "GFLOP/s", "GB/s");
+    }
+
+    const options &get_options() const {
+        return opts_;
+    }
+
+    // Whether r is selected by the filter.
+    bool selected(const result &r) const {
+        return opts_.filter.empty() || r.name().find(opts_.filter) != std::string::npos;
+    }
+
+    // Measures f() for r unless filtered out, calling setup() untimed before
+    //  every call. Routines a backend does not implement and devices it does
+    //  not support are reported as skipped.
+    template <typename Setup, typename F>
+    void run(result r, Setup &&setup, F &&f) {
+        if (!selected(r))
+            return;
+        try {
+            r.time = measure(opts_, setup, f);
+        }
+        catch (const oneapi::mkl::unimplemented &e) {
+            r.skipped = e.what();
+        }
+        catch (const oneapi::mkl::unsupported_device &e) {
+            r.skipped = e.what();
+        }
+        print(r);
+        results_.push_back(std::move(r));
+    }
+
+    template <typename F>
+    void run(result r, F &&f) {
+        run(
+            std::move(r), []() {}, std::forward<F>(f));
+    }
+
+    // Reports r as skipped for the given reason unless filtered out.
+    void skip(result r, std::string reason) {
+        if (!selected(r))
+            return;
+        r.skipped = std::move(reason);
+        print(r);
+        results_.push_back(std::move(r));
+    }
+
+    // Writes the results to the JSON file given on the command line, if any.
+    //  Returns false when the file cannot be written.
+    bool write_json() const {
+        if (opts_.json_file.empty())
+            return true;
+        std::ofstream out(opts_.json_file);
+        if (!out) {
+            std::cerr << "Cannot write " << opts_.json_file << std::endl;
+            return false;
+        }
+        char date[32];
+        std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+
+        out << "{\n  \"context\": {\n";
+        out << "    \"benchmark\": " << json_string(benchmark_) << ",\n";
+        out << "    \"date\": " << json_string(date) << ",\n";
+        out << "    \"device\": " << json_string(device_) << ",\n";
+        out << "    \"min_time\": " << opts_.min_time << ",\n";
+        out << "    \"quick\": " << (opts_.quick ? "true" : "false") << "\n  },\n";
+        out << "  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results_.size(); i++) {
+            const result &r = results_[i];
+            out << (i ? ",\n" : "\n") << "    {\n";
+            out << "      \"name\": " << json_string(r.name()) << ",\n";
+            out << "      \"routine\": " << json_string(r.routine) << ",\n";
+            for (auto &label : r.labels)
+                out << "      " << json_string(label.first) << ": " << json_string(label.second)
+                    << ",\n";
+            out << "      \"parameters\": {";
+            for (std::size_t j = 0; j < r.parameters.size(); j++)
+                out << (j ? ", " : "") << json_string(r.parameters[j].first) << ": "
+                    << r.parameters[j].second;
+            out << "},\n";
+            for (auto &counter : r.counters)
+                out << "      " << json_string(counter.first) << ": " << counter.second << ",\n";
+            if (!r.skipped.empty()) {
+                out << "      \"skipped\": " << json_string(r.skipped) << "\n    }";
+                continue;
+            }
+            out << "      \"iterations\": " << r.time.iterations << ",\n";
+            out << "      \"time_unit\": \"ns\",\n";
+            out << "      \"min_time\": " << r.time.min_ns << ",\n";
+            out << "      \"median_time\": " << r.time.median_ns << ",\n";
+            out << "      \"real_time\": " << r.time.mean_ns;
+            if (r.flops > 0.0)
+                out << ",\n      \"gflops\": " << r.flops / r.time.median_ns;
+            if (r.bytes > 0.0)
+                out << ",\n      \"bytes_per_second\": " << r.bytes / (r.time.median_ns * 1e-9);
+            if (r.items > 0.0)
+                out << ",\n      \"items_per_second\": " << r.items / (r.time.median_ns * 1e-9);
+            out << "\n    }";
+        }
+        out << "\n  ]\n}\n";
+        std::cout << "Results written to " << opts_.json_file << std::endl;
+        return static_cast<bool>(out);
+    }
+
+private:
+    void print(const result &r) const {
+        if (!r.skipped.empty()) {
+            std::printf("%-64s skipped: %s\n", r.name().c_str(), r.skipped.c_str());
+            return;
+        }
+        const double us = r.time.median_ns * 1e-3;
+        std::printf("%-64s %10lld %12.3f %12.3f", r.name().c_str(),
+                    static_cast<long long>(r.time.iterations), us, r.time.min_ns * 1e-3);
+        if (r.flops > 0.0)
+            std::printf(" %10.3f", r.flops / r.time.median_ns);
+        else
+            std::printf(" %10s", "-");
+        if (r.bytes > 0.0)
+            std::printf(" %10.3f", r.bytes / r.time.median_ns);
+        else
+            std::printf(" %10s", "-");
+        if (r.items > 0.0)
+            std::printf(" %10.3e items/s", r.items / (r.time.median_ns * 1e-9));
+        std::printf("\n");
+        std::fflush(stdout);
+    }
+
+    std::string benchmark_;
+    options opts_;
+    std::string device_;
+    std::vector<result> results_;
+};
+
+// State shared by the measurements of a benchmark.
+struct session {
+    sycl::queue queue;
+    reporter report;
+
+    // The sizes to run out of all of them: the first two with --quick.
+    std::vector<std::int64_t> sizes(std::vector<std::int64_t> all) const {
+        if (report.get_options().quick && all.size() > 2)
+            all.resize(2);
+        return all;
+    }
+};
+
+} // namespace benchmark
+
+#endif //_BENCHMARK_COMMON_HPP_
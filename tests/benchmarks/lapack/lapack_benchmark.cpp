@@ -0,0 +1,846 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures the LAPACK routines in three phases:
+*
+*       - the *_scratchpad_size query,
+*       - the USM allocation of the scratchpad,
+*       - the computation, with buffers and with USM,
+*
+*       for getrf, potrf, geqrf, gesvd and syevd (heevd for complex types)
+*       over a range of matrix sizes, and for the batch routines getrf_batch,
+*       getri_batch, getrs_batch, geqrf_batch, orgqr_batch (ungqr_batch for
+*       complex types), potrf_batch and potrs_batch over a range of matrix and
+*       batch sizes, with three layouts of the batch:
+*
+*       - packed: strided, the matrices stored contiguously,
+*       - padded: strided, with the leading dimension rounded up to 16 elements
+*         and the matrices aligned to 4 KiB,
+*       - group: the USM group API, one group of matrices stored contiguously.
+*
+*       Inputs overwritten by a routine, and the factorizations getri, getrs,
+*       orgqr and potrs take as input, are recomputed before every call,
+*       outside of the measured time.
+*
+*       Usage: benchmark_lapack [--json=<file>] [--filter=<text>] [--quick] ...
+*       See benchmark_common.hpp for the options. The device is selected with
+*       the SYCL default selector.
+*
+*******************************************************************************/
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/mkl.hpp"
+
+#include "benchmark_common.hpp"
+
+using oneapi::mkl::job;
+using oneapi::mkl::jobsvd;
+using oneapi::mkl::transpose;
+using oneapi::mkl::uplo;
+namespace lapack = oneapi::mkl::lapack;
+
+using benchmark::flops;
+using benchmark::is_complex;
+using benchmark::operand;
+using benchmark::session;
+
+using labels = std::vector<std::pair<std::string, std::string>>;
+using parameters = std::vector<std::pair<std::string, std::int64_t>>;
+
+template <typename T>
+using real_t = typename benchmark::real_type<T>::type;
+
+template <typename T>
+T conjugate(T value) {
+    if constexpr (is_complex<T>::value)
+        return std::conj(value);
+    else
+        return value;
+}
+
+// Adds n to the diagonal of the batch_size n x n matrices with leading
+//  dimension ld, stride elements apart, so they are well conditioned.
+template <typename T>
+typename operand<T>::initializer diagonally_dominant(std::int64_t n, std::int64_t ld,
+                                                     std::int64_t stride = 0,
+                                                     std::int64_t batch_size = 1) {
+    return [=](std::vector<T> &values) {
+        for (std::int64_t b = 0; b < batch_size; b++) {
+            for (std::int64_t i = 0; i < n; i++)
+                values[b * stride + i + i * ld] += static_cast<real_t<T>>(n);
+        }
+    };
+}
+
+// Makes the batch_size n x n matrices with leading dimension ld, stride
+//  elements apart, Hermitian (symmetric for real types) positive definite: the
+//  upper triangle mirrors the lower one and the diagonal is n.
+template <typename T>
+typename operand<T>::initializer positive_definite(std::int64_t n, std::int64_t ld,
+                                                   std::int64_t stride = 0,
+                                                   std::int64_t batch_size = 1) {
+    return [=](std::vector<T> &values) {
+        for (std::int64_t b = 0; b < batch_size; b++) {
+            T *a = values.data() + b * stride;
+            for (std::int64_t j = 0; j < n; j++) {
+                for (std::int64_t i = 0; i < j; i++)
+                    a[i + j * ld] = conjugate(a[j + i * ld]);
+                a[j + j * ld] = static_cast<real_t<T>>(n);
+            }
+        }
+    };
+}
+
+enum class layout { packed, padded, group };
+
+const char *layout_name(layout l) {
+    switch (l) {
+        case layout::packed: return "packed";
+        case layout::padded: return "padded";
+        default: return "group";
+    }
+}
+
+// Leading dimension and stride of the n x n matrices of a batch of T.
+struct geometry {
+    std::int64_t ld;
+    std::int64_t stride;
+
+    geometry(layout l, std::int64_t n, std::size_t type_size) {
+        auto round_up = [](std::int64_t value, std::int64_t multiple) {
+            return (value + multiple - 1) / multiple * multiple;
+        };
+        ld = (l == layout::padded) ? round_up(n, 16) : n;
+        stride = ld * n;
+        if (l == layout::padded)
+            stride = round_up(stride, std::max<std::int64_t>(4096 / type_size, 1));
+    }
+};
+
+// Pointers to the matrices of a batch, stride elements apart, for the group
+//  API. They are held in shared USM and updated when the matrices move.
+template <typename T>
+class pointer_array {
+public:
+    pointer_array(sycl::queue &queue, std::int64_t batch_size)
+            : queue_(queue),
+              batch_size_(batch_size),
+              pointers_(sycl::malloc_shared<T *>(batch_size, queue)) {}
+    pointer_array(const pointer_array &) = delete;
+    pointer_array &operator=(const pointer_array &) = delete;
+    ~pointer_array() {
+        sycl::free(pointers_, queue_);
+    }
+
+    T **get(T *base, std::int64_t stride) {
+        if (base != base_) {
+            for (std::int64_t i = 0; i < batch_size_; i++)
+                pointers_[i] = base + i * stride;
+            base_ = base;
+        }
+        return pointers_;
+    }
+
+private:
+    sycl::queue queue_;
+    std::int64_t batch_size_;
+    T **pointers_;
+    T *base_ = nullptr;
+};
+
+// APIs a routine is measured with: the group batch API only takes USM
+//  pointers.
+enum class apis { buffer_and_usm, usm_only };
+
+// Calls f with the USM pointers of the operands and waits for its event, or
+//  with their buffers and waits for the queue.
+template <apis Apis, typename F, typename... Operands>
+void invoke(sycl::queue &queue, bool use_usm, F &&f, Operands &... ops) {
+    if (use_usm)
+        f(ops.usm()...).wait_and_throw();
+    else if constexpr (Apis == apis::buffer_and_usm) {
+        f(ops.buffer()...);
+        queue.wait_and_throw();
+    }
+}
+
+// Untimed work before every computation: restoring the inputs the routine
+//  overwrites and computing the factorization it takes as input. The
+//  factorization uses the scratchpad of the measured routine, which is
+//  allocated for both.
+template <typename T>
+struct preparation {
+    // Scratchpad size of the factorization, none when empty.
+    std::function<std::int64_t()> scratchpad_size;
+    std::function<void(bool use_usm, operand<T> &scratchpad, std::int64_t scratchpad_size)> run;
+};
+
+template <typename T>
+preparation<T> restoring(operand<T> &a) {
+    return { nullptr, [&a](bool, operand<T> &, std::int64_t) { a.restore(); } };
+}
+
+// Measures the scratchpad size query, the USM allocation of the scratchpad
+//  and call(operands..., scratchpad, scratchpad_size) with the buffers and
+//  with the USM pointers of the operands. flops is the work of one call.
+template <typename T, apis Apis = apis::buffer_and_usm, typename Query, typename Call,
+          typename... Operands>
+void run(session &s, const char *routine, const labels &attributes, parameters params,
+         double flops, Query &&query, const preparation<T> &prepare, Call &&call,
+         Operands &... ops) {
+    benchmark::result r;
+    r.routine = routine;
+    r.parameters = std::move(params);
+    auto phase = [&](const char *name, const char *api) {
+        r.labels = attributes;
+        r.labels.emplace_back("phase", name);
+        if (api)
+            r.labels.emplace_back("api", api);
+    };
+
+    std::int64_t scratchpad_size = 0, allocated_size = 0;
+    try {
+        scratchpad_size = query();
+        allocated_size = std::max(scratchpad_size,
+                                  prepare.scratchpad_size ? prepare.scratchpad_size() : 0);
+    }
+    catch (const oneapi::mkl::unimplemented &e) {
+        phase("scratchpad_size", nullptr);
+        s.report.skip(r, e.what());
+        return;
+    }
+    catch (const oneapi::mkl::unsupported_device &e) {
+        phase("scratchpad_size", nullptr);
+        s.report.skip(r, e.what());
+        return;
+    }
+    r.counters = { { "scratchpad_size", static_cast<double>(scratchpad_size) } };
+
+    phase("scratchpad_size", nullptr);
+    s.report.run(r, [&]() { scratchpad_size = query(); });
+
+    // Buffers allocate their memory on first use, within the computation, so
+    //  the allocation is only measured for USM.
+    phase("allocation", "usm");
+    s.report.run(r, [&]() {
+        T *scratchpad = sycl::malloc_device<T>(std::max<std::int64_t>(scratchpad_size, 1), s.queue);
+        sycl::free(scratchpad, s.queue);
+    });
+
+    operand<T> scratchpad(s.queue, allocated_size);
+    auto compute = [&](auto &&... args) { return call(args..., scratchpad_size); };
+    r.flops = flops;
+    for (bool use_usm : { false, true }) {
+        if (!use_usm && Apis == apis::usm_only)
+            continue;
+        phase("compute", use_usm ? "usm" : "buffer");
+        s.report.run(
+            r, [&]() { prepare.run(use_usm, scratchpad, allocated_size); },
+            [&]() { invoke<Apis>(s.queue, use_usm, compute, ops..., scratchpad); });
+    }
+}
+
+// Operation counts of LAPACK Working Note 41 for square matrices of order n.
+template <typename T>
+double getrf_flops(double n) {
+    return flops<T>(n * n * n / 3.0, n * n * n / 3.0);
+}
+template <typename T>
+double potrf_flops(double n) {
+    return flops<T>(n * n * n / 6.0, n * n * n / 6.0);
+}
+template <typename T>
+double geqrf_flops(double n) {
+    return flops<T>(2.0 * n * n * n / 3.0, 2.0 * n * n * n / 3.0);
+}
+template <typename T>
+double getri_flops(double n) {
+    return flops<T>(2.0 * n * n * n / 3.0, 2.0 * n * n * n / 3.0);
+}
+template <typename T>
+double getrs_flops(double n, double nrhs) {
+    return flops<T>(n * n * nrhs, n * n * nrhs);
+}
+
+template <typename T>
+void getrf(session &s, std::int64_t n) {
+    operand<T> a(s.queue, n * n, diagonally_dominant<T>(n, n));
+    operand<std::int64_t> ipiv(s.queue, n);
+    run<T>(
+        s, "getrf", { { "type", benchmark::type_name<T>() } }, { { "n", n } }, getrf_flops<T>(n),
+        [&]() { return lapack::getrf_scratchpad_size<T>(s.queue, n, n, n); }, restoring(a),
+        [&](auto &&a, auto &&ipiv, auto &&scratchpad, std::int64_t size) {
+            return lapack::getrf(s.queue, n, n, a, n, ipiv, scratchpad, size);
+        },
+        a, ipiv);
+}
+
+template <typename T>
+void potrf(session &s, std::int64_t n) {
+    operand<T> a(s.queue, n * n, positive_definite<T>(n, n));
+    run<T>(
+        s, "potrf", { { "type", benchmark::type_name<T>() } }, { { "n", n } }, potrf_flops<T>(n),
+        [&]() { return lapack::potrf_scratchpad_size<T>(s.queue, uplo::lower, n, n); },
+        restoring(a),
+        [&](auto &&a, auto &&scratchpad, std::int64_t size) {
+            return lapack::potrf(s.queue, uplo::lower, n, a, n, scratchpad, size);
+        },
+        a);
+}
+
+template <typename T>
+void geqrf(session &s, std::int64_t n) {
+    operand<T> a(s.queue, n * n), tau(s.queue, n);
+    run<T>(
+        s, "geqrf", { { "type", benchmark::type_name<T>() } }, { { "n", n } }, geqrf_flops<T>(n),
+        [&]() { return lapack::geqrf_scratchpad_size<T>(s.queue, n, n, n); }, restoring(a),
+        [&](auto &&a, auto &&tau, auto &&scratchpad, std::int64_t size) {
+            return lapack::geqrf(s.queue, n, n, a, n, tau, scratchpad, size);
+        },
+        a, tau);
+}
+
+// gesvd and syevd have no conventional operation count; only their time is
+//  reported.
+template <typename T>
+void gesvd(session &s, std::int64_t n) {
+    operand<T> a(s.queue, n * n), u(s.queue, n * n), vt(s.queue, n * n);
+    operand<real_t<T>> singular_values(s.queue, n);
+    run<T>(
+        s, "gesvd", { { "type", benchmark::type_name<T>() } }, { { "n", n } }, 0.0,
+        [&]() {
+            return lapack::gesvd_scratchpad_size<T>(s.queue, jobsvd::vectors, jobsvd::vectors, n,
+                                                    n, n, n, n);
+        },
+        restoring(a),
+        [&](auto &&a, auto &&singular_values, auto &&u, auto &&vt, auto &&scratchpad,
+            std::int64_t size) {
+            return lapack::gesvd(s.queue, jobsvd::vectors, jobsvd::vectors, n, n, a, n,
+                                 singular_values, u, n, vt, n, scratchpad, size);
+        },
+        a, singular_values, u, vt);
+}
+
+template <typename T>
+void syevd(session &s, std::int64_t n) {
+    operand<T> a(s.queue, n * n, positive_definite<T>(n, n));
+    operand<real_t<T>> w(s.queue, n);
+    const labels attributes = { { "type", benchmark::type_name<T>() } };
+    if constexpr (is_complex<T>::value) {
+        run<T>(
+            s, "heevd", attributes, { { "n", n } }, 0.0,
+            [&]() {
+                return lapack::heevd_scratchpad_size<T>(s.queue, job::vec, uplo::lower, n, n);
+            },
+            restoring(a),
+            [&](auto &&a, auto &&w, auto &&scratchpad, std::int64_t size) {
+                return lapack::heevd(s.queue, job::vec, uplo::lower, n, a, n, w, scratchpad, size);
+            },
+            a, w);
+    }
+    else {
+        run<T>(
+            s, "syevd", attributes, { { "n", n } }, 0.0,
+            [&]() {
+                return lapack::syevd_scratchpad_size<T>(s.queue, job::vec, uplo::lower, n, n);
+            },
+            restoring(a),
+            [&](auto &&a, auto &&w, auto &&scratchpad, std::int64_t size) {
+                return lapack::syevd(s.queue, job::vec, uplo::lower, n, a, n, w, scratchpad, size);
+            },
+            a, w);
+    }
+}
+
+// Operands of the batch routines: batch_size n x n matrices A with their pivots
+//  (getrf) or scalar factors (geqrf), and right-hand sides B for nrhs = 1.
+template <typename T>
+struct batch_problem {
+    std::int64_t n;
+    std::int64_t batch_size;
+    layout l;
+    geometry g;
+    std::int64_t stride_ipiv;
+    std::int64_t stride_tau;
+    std::int64_t stride_b;
+    operand<T> a;
+    operand<std::int64_t> ipiv;
+    operand<T> tau;
+    operand<T> b;
+
+    // Arguments of the group API: one group of batch_size problems.
+    std::int64_t group_n, group_lda, group_nrhs = 1, group_size;
+    transpose group_trans = transpose::nontrans;
+    uplo group_uplo = uplo::lower;
+    pointer_array<T> a_array, tau_array, b_array;
+    pointer_array<std::int64_t> ipiv_array;
+
+    batch_problem(session &s, layout l, std::int64_t n, std::int64_t batch_size,
+                  typename operand<T>::initializer init)
+            : n(n),
+              batch_size(batch_size),
+              l(l),
+              g(l, n, sizeof(T)),
+              stride_ipiv(n),
+              stride_tau(n),
+              stride_b(g.ld),
+              a(s.queue, g.stride * batch_size, init),
+              ipiv(s.queue, stride_ipiv * batch_size),
+              tau(s.queue, stride_tau * batch_size),
+              b(s.queue, stride_b * batch_size),
+              group_n(n),
+              group_lda(g.ld),
+              group_size(batch_size),
+              a_array(s.queue, batch_size),
+              tau_array(s.queue, batch_size),
+              b_array(s.queue, batch_size),
+              ipiv_array(s.queue, batch_size) {}
+
+    labels attributes() const {
+        return { { "type", benchmark::type_name<T>() }, { "layout", layout_name(l) } };
+    }
+
+    parameters dimensions() const {
+        return { { "n", n }, { "batch_size", batch_size } };
+    }
+};
+
+// LU factorization of the batch: the routine measured by getrf_batch and the
+//  preparation of getri_batch and getrs_batch.
+template <typename T>
+std::int64_t getrf_batch_size(session &s, batch_problem<T> &p) {
+    if (p.l == layout::group)
+        return lapack::getrf_batch_scratchpad_size<T>(s.queue, &p.group_n, &p.group_n,
+                                                      &p.group_lda, 1, &p.group_size);
+    return lapack::getrf_batch_scratchpad_size<T>(s.queue, p.n, p.n, p.g.ld, p.g.stride,
+                                                  p.stride_ipiv, p.batch_size);
+}
+
+template <typename T>
+void getrf_batch_run(session &s, batch_problem<T> &p, bool use_usm, operand<T> &scratchpad,
+                     std::int64_t size) {
+    if (p.l == layout::group) {
+        invoke<apis::usm_only>(
+            s.queue, use_usm,
+            [&](T *a, std::int64_t *ipiv, T *scratchpad) {
+                return lapack::getrf_batch(s.queue, &p.group_n, &p.group_n,
+                                           p.a_array.get(a, p.g.stride), &p.group_lda,
+                                           p.ipiv_array.get(ipiv, p.stride_ipiv), 1,
+                                           &p.group_size, scratchpad, size);
+            },
+            p.a, p.ipiv, scratchpad);
+        return;
+    }
+    invoke<apis::buffer_and_usm>(
+        s.queue, use_usm,
+        [&](auto &&a, auto &&ipiv, auto &&scratchpad) {
+            return lapack::getrf_batch(s.queue, p.n, p.n, a, p.g.ld, p.g.stride, ipiv,
+                                       p.stride_ipiv, p.batch_size, scratchpad, size);
+        },
+        p.a, p.ipiv, scratchpad);
+}
+
+template <typename T>
+preparation<T> factorizing_getrf(session &s, batch_problem<T> &p) {
+    return { [&]() { return getrf_batch_size(s, p); },
+             [&](bool use_usm, operand<T> &scratchpad, std::int64_t size) {
+                 p.a.restore();
+                 getrf_batch_run(s, p, use_usm, scratchpad, size);
+             } };
+}
+
+// Measures the batch routine of one problem with the strided API, or with the
+//  group API for the group layout.
+template <typename T, typename Query, typename GroupQuery, typename Call, typename GroupCall,
+          typename... Operands>
+void run_batch(session &s, batch_problem<T> &p, const char *routine, parameters params,
+               double flops, Query &&query, GroupQuery &&group_query,
+               const preparation<T> &prepare, Call &&call, GroupCall &&group_call,
+               Operands &... ops) {
+    if (p.l == layout::group)
+        run<T, apis::usm_only>(s, routine, p.attributes(), std::move(params), flops, group_query,
+                               prepare, group_call, ops...);
+    else
+        run<T>(s, routine, p.attributes(), std::move(params), flops, query, prepare, call,
+               ops...);
+}
+
+template <typename T>
+void getrf_batch(session &s, layout l, std::int64_t n, std::int64_t batch_size) {
+    const geometry g(l, n, sizeof(T));
+    batch_problem<T> p(s, l, n, batch_size, diagonally_dominant<T>(n, g.ld, g.stride, batch_size));
+    auto query = [&]() { return getrf_batch_size(s, p); };
+    run_batch(
+        s, p, "getrf_batch", p.dimensions(), batch_size * getrf_flops<T>(n), query, query,
+        restoring(p.a),
+        [&](auto &&a, auto &&ipiv, auto &&scratchpad, std::int64_t size) {
+            return lapack::getrf_batch(s.queue, n, n, a, p.g.ld, p.g.stride, ipiv, p.stride_ipiv,
+                                       batch_size, scratchpad, size);
+        },
+        [&](T *a, std::int64_t *ipiv, T *scratchpad, std::int64_t size) {
+            return lapack::getrf_batch(s.queue, &p.group_n, &p.group_n,
+                                       p.a_array.get(a, p.g.stride), &p.group_lda,
+                                       p.ipiv_array.get(ipiv, p.stride_ipiv), 1, &p.group_size,
+                                       scratchpad, size);
+        },
+        p.a, p.ipiv);
+}
+
+template <typename T>
+void getri_batch(session &s, layout l, std::int64_t n, std::int64_t batch_size) {
+    const geometry g(l, n, sizeof(T));
+    batch_problem<T> p(s, l, n, batch_size, diagonally_dominant<T>(n, g.ld, g.stride, batch_size));
+    run_batch(
+        s, p, "getri_batch", p.dimensions(), batch_size * getri_flops<T>(n),
+        [&]() {
+            return lapack::getri_batch_scratchpad_size<T>(s.queue, n, p.g.ld, p.g.stride,
+                                                          p.stride_ipiv, batch_size);
+        },
+        [&]() {
+            return lapack::getri_batch_scratchpad_size<T>(s.queue, &p.group_n, &p.group_lda, 1,
+                                                          &p.group_size);
+        },
+        factorizing_getrf(s, p),
+        [&](auto &&a, auto &&ipiv, auto &&scratchpad, std::int64_t size) {
+            return lapack::getri_batch(s.queue, n, a, p.g.ld, p.g.stride, ipiv, p.stride_ipiv,
+                                       batch_size, scratchpad, size);
+        },
+        [&](T *a, std::int64_t *ipiv, T *scratchpad, std::int64_t size) {
+            return lapack::getri_batch(s.queue, &p.group_n, p.a_array.get(a, p.g.stride),
+                                       &p.group_lda, p.ipiv_array.get(ipiv, p.stride_ipiv), 1,
+                                       &p.group_size, scratchpad, size);
+        },
+        p.a, p.ipiv);
+}
+
+template <typename T>
+void getrs_batch(session &s, layout l, std::int64_t n, std::int64_t batch_size) {
+    const geometry g(l, n, sizeof(T));
+    batch_problem<T> p(s, l, n, batch_size, diagonally_dominant<T>(n, g.ld, g.stride, batch_size));
+    parameters params = p.dimensions();
+    params.emplace_back("nrhs", 1);
+    run_batch(
+        s, p, "getrs_batch", std::move(params), batch_size * getrs_flops<T>(n, 1),
+        [&]() {
+            return lapack::getrs_batch_scratchpad_size<T>(s.queue, transpose::nontrans, n, 1,
+                                                          p.g.ld, p.g.stride, p.stride_ipiv,
+                                                          p.g.ld, p.stride_b, batch_size);
+        },
+        [&]() {
+            return lapack::getrs_batch_scratchpad_size<T>(s.queue, &p.group_trans, &p.group_n,
+                                                          &p.group_nrhs, &p.group_lda,
+                                                          &p.group_lda, 1, &p.group_size);
+        },
+        factorizing_getrf(s, p),
+        [&](auto &&a, auto &&ipiv, auto &&b, auto &&scratchpad, std::int64_t size) {
+            return lapack::getrs_batch(s.queue, transpose::nontrans, n, 1, a, p.g.ld, p.g.stride,
+                                       ipiv, p.stride_ipiv, b, p.g.ld, p.stride_b, batch_size,
+                                       scratchpad, size);
+        },
+        [&](T *a, std::int64_t *ipiv, T *b, T *scratchpad, std::int64_t size) {
+            return lapack::getrs_batch(s.queue, &p.group_trans, &p.group_n, &p.group_nrhs,
+                                       p.a_array.get(a, p.g.stride), &p.group_lda,
+                                       p.ipiv_array.get(ipiv, p.stride_ipiv),
+                                       p.b_array.get(b, p.stride_b), &p.group_lda, 1,
+                                       &p.group_size, scratchpad, size);
+        },
+        p.a, p.ipiv, p.b);
+}
+
+// QR factorization of the batch: the routine measured by geqrf_batch and the
+//  preparation of orgqr_batch and ungqr_batch.
+template <typename T>
+std::int64_t geqrf_batch_size(session &s, batch_problem<T> &p) {
+    if (p.l == layout::group)
+        return lapack::geqrf_batch_scratchpad_size<T>(s.queue, &p.group_n, &p.group_n,
+                                                      &p.group_lda, 1, &p.group_size);
+    return lapack::geqrf_batch_scratchpad_size<T>(s.queue, p.n, p.n, p.g.ld, p.g.stride,
+                                                  p.stride_tau, p.batch_size);
+}
+
+template <typename T>
+preparation<T> factorizing_geqrf(session &s, batch_problem<T> &p) {
+    return { [&]() { return geqrf_batch_size(s, p); },
+             [&](bool use_usm, operand<T> &scratchpad, std::int64_t size) {
+                 p.a.restore();
+                 if (p.l == layout::group) {
+                     invoke<apis::usm_only>(
+                         s.queue, use_usm,
+                         [&](T *a, T *tau, T *scratchpad) {
+                             return lapack::geqrf_batch(
+                                 s.queue, &p.group_n, &p.group_n, p.a_array.get(a, p.g.stride),
+                                 &p.group_lda, p.tau_array.get(tau, p.stride_tau), 1,
+                                 &p.group_size, scratchpad, size);
+                         },
+                         p.a, p.tau, scratchpad);
+                     return;
+                 }
+                 invoke<apis::buffer_and_usm>(
+                     s.queue, use_usm,
+                     [&](auto &&a, auto &&tau, auto &&scratchpad) {
+                         return lapack::geqrf_batch(s.queue, p.n, p.n, a, p.g.ld, p.g.stride, tau,
+                                                    p.stride_tau, p.batch_size, scratchpad, size);
+                     },
+                     p.a, p.tau, scratchpad);
+             } };
+}
+
+template <typename T>
+void geqrf_batch(session &s, layout l, std::int64_t n, std::int64_t batch_size) {
+    batch_problem<T> p(s, l, n, batch_size, nullptr);
+    auto query = [&]() { return geqrf_batch_size(s, p); };
+    run_batch(
+        s, p, "geqrf_batch", p.dimensions(), batch_size * geqrf_flops<T>(n), query, query,
+        restoring(p.a),
+        [&](auto &&a, auto &&tau, auto &&scratchpad, std::int64_t size) {
+            return lapack::geqrf_batch(s.queue, n, n, a, p.g.ld, p.g.stride, tau, p.stride_tau,
+                                       batch_size, scratchpad, size);
+        },
+        [&](T *a, T *tau, T *scratchpad, std::int64_t size) {
+            return lapack::geqrf_batch(s.queue, &p.group_n, &p.group_n,
+                                       p.a_array.get(a, p.g.stride), &p.group_lda,
+                                       p.tau_array.get(tau, p.stride_tau), 1, &p.group_size,
+                                       scratchpad, size);
+        },
+        p.a, p.tau);
+}
+
+// orgqr_batch for real types, ungqr_batch for complex types, forming Q from
+//  the QR factorization (k = n).
+template <typename T>
+void orgqr_batch(session &s, layout l, std::int64_t n, std::int64_t batch_size) {
+    batch_problem<T> p(s, l, n, batch_size, nullptr);
+    parameters params = p.dimensions();
+    params.emplace_back("k", n);
+    auto query = [&]() {
+        if constexpr (is_complex<T>::value)
+            return lapack::ungqr_batch_scratchpad_size<T>(s.queue, n, n, n, p.g.ld, p.g.stride,
+                                                          p.stride_tau, batch_size);
+        else
+            return lapack::orgqr_batch_scratchpad_size<T>(s.queue, n, n, n, p.g.ld, p.g.stride,
+                                                          p.stride_tau, batch_size);
+    };
+    auto group_query = [&]() {
+        if constexpr (is_complex<T>::value)
+            return lapack::ungqr_batch_scratchpad_size<T>(s.queue, &p.group_n, &p.group_n,
+                                                          &p.group_n, &p.group_lda, 1,
+                                                          &p.group_size);
+        else
+            return lapack::orgqr_batch_scratchpad_size<T>(s.queue, &p.group_n, &p.group_n,
+                                                          &p.group_n, &p.group_lda, 1,
+                                                          &p.group_size);
+    };
+    auto call = [&](auto &&a, auto &&tau, auto &&scratchpad, std::int64_t size) {
+        if constexpr (is_complex<T>::value)
+            return lapack::ungqr_batch(s.queue, n, n, n, a, p.g.ld, p.g.stride, tau, p.stride_tau,
+                                       batch_size, scratchpad, size);
+        else
+            return lapack::orgqr_batch(s.queue, n, n, n, a, p.g.ld, p.g.stride, tau, p.stride_tau,
+                                       batch_size, scratchpad, size);
+    };
+    auto group_call = [&](T *a, T *tau, T *scratchpad, std::int64_t size) {
+        T **a_array = p.a_array.get(a, p.g.stride);
+        T **tau_array = p.tau_array.get(tau, p.stride_tau);
+        if constexpr (is_complex<T>::value)
+            return lapack::ungqr_batch(s.queue, &p.group_n, &p.group_n, &p.group_n, a_array,
+                                       &p.group_lda, tau_array, 1, &p.group_size, scratchpad,
+                                       size);
+        else
+            return lapack::orgqr_batch(s.queue, &p.group_n, &p.group_n, &p.group_n, a_array,
+                                       &p.group_lda, tau_array, 1, &p.group_size, scratchpad,
+                                       size);
+    };
+    run_batch(s, p, is_complex<T>::value ? "ungqr_batch" : "orgqr_batch", std::move(params),
+              batch_size * geqrf_flops<T>(n), query, group_query, factorizing_geqrf(s, p), call,
+              group_call, p.a, p.tau);
+}
+
+// Cholesky factorization of the batch: the routine measured by potrf_batch and
+//  the preparation of potrs_batch.
+template <typename T>
+std::int64_t potrf_batch_size(session &s, batch_problem<T> &p) {
+    if (p.l == layout::group)
+        return lapack::potrf_batch_scratchpad_size<T>(s.queue, &p.group_uplo, &p.group_n,
+                                                      &p.group_lda, 1, &p.group_size);
+    return lapack::potrf_batch_scratchpad_size<T>(s.queue, uplo::lower, p.n, p.g.ld, p.g.stride,
+                                                  p.batch_size);
+}
+
+template <typename T>
+void potrf_batch_run(session &s, batch_problem<T> &p, bool use_usm, operand<T> &scratchpad,
+                     std::int64_t size) {
+    if (p.l == layout::group) {
+        invoke<apis::usm_only>(
+            s.queue, use_usm,
+            [&](T *a, T *scratchpad) {
+                return lapack::potrf_batch(s.queue, &p.group_uplo, &p.group_n,
+                                           p.a_array.get(a, p.g.stride), &p.group_lda, 1,
+                                           &p.group_size, scratchpad, size);
+            },
+            p.a, scratchpad);
+        return;
+    }
+    invoke<apis::buffer_and_usm>(
+        s.queue, use_usm,
+        [&](auto &&a, auto &&scratchpad) {
+            return lapack::potrf_batch(s.queue, uplo::lower, p.n, a, p.g.ld, p.g.stride,
+                                       p.batch_size, scratchpad, size);
+        },
+        p.a, scratchpad);
+}
+
+template <typename T>
+void potrf_batch(session &s, layout l, std::int64_t n, std::int64_t batch_size) {
+    const geometry g(l, n, sizeof(T));
+    batch_problem<T> p(s, l, n, batch_size, positive_definite<T>(n, g.ld, g.stride, batch_size));
+    auto query = [&]() { return potrf_batch_size(s, p); };
+    run_batch(
+        s, p, "potrf_batch", p.dimensions(), batch_size * potrf_flops<T>(n), query, query,
+        restoring(p.a),
+        [&](auto &&a, auto &&scratchpad, std::int64_t size) {
+            return lapack::potrf_batch(s.queue, uplo::lower, n, a, p.g.ld, p.g.stride, batch_size,
+                                       scratchpad, size);
+        },
+        [&](T *a, T *scratchpad, std::int64_t size) {
+            return lapack::potrf_batch(s.queue, &p.group_uplo, &p.group_n,
+                                       p.a_array.get(a, p.g.stride), &p.group_lda, 1,
+                                       &p.group_size, scratchpad, size);
+        },
+        p.a);
+}
+
+template <typename T>
+void potrs_batch(session &s, layout l, std::int64_t n, std::int64_t batch_size) {
+    const geometry g(l, n, sizeof(T));
+    batch_problem<T> p(s, l, n, batch_size, positive_definite<T>(n, g.ld, g.stride, batch_size));
+    parameters params = p.dimensions();
+    params.emplace_back("nrhs", 1);
+    const preparation<T> factorize = {
+        [&]() { return potrf_batch_size(s, p); },
+        [&](bool use_usm, operand<T> &scratchpad, std::int64_t size) {
+            p.a.restore();
+            potrf_batch_run(s, p, use_usm, scratchpad, size);
+        }
+    };
+    run_batch(
+        s, p, "potrs_batch", std::move(params), batch_size * getrs_flops<T>(n, 1),
+        [&]() {
+            return lapack::potrs_batch_scratchpad_size<T>(s.queue, uplo::lower, n, 1, p.g.ld,
+                                                          p.g.stride, p.g.ld, p.stride_b,
+                                                          batch_size);
+        },
+        [&]() {
+            return lapack::potrs_batch_scratchpad_size<T>(s.queue, &p.group_uplo, &p.group_n,
+                                                          &p.group_nrhs, &p.group_lda,
+                                                          &p.group_lda, 1, &p.group_size);
+        },
+        factorize,
+        [&](auto &&a, auto &&b, auto &&scratchpad, std::int64_t size) {
+            return lapack::potrs_batch(s.queue, uplo::lower, n, 1, a, p.g.ld, p.g.stride, b,
+                                       p.g.ld, p.stride_b, batch_size, scratchpad, size);
+        },
+        [&](T *a, T *b, T *scratchpad, std::int64_t size) {
+            return lapack::potrs_batch(s.queue, &p.group_uplo, &p.group_n, &p.group_nrhs,
+                                       p.a_array.get(a, p.g.stride), &p.group_lda,
+                                       p.b_array.get(b, p.stride_b), &p.group_lda, 1,
+                                       &p.group_size, scratchpad, size);
+        },
+        p.a, p.b);
+}
+
+template <typename T>
+void run_type(session &s) {
+    if (!benchmark::is_supported<T>(s.queue)) {
+        std::cout << benchmark::type_name<T>() << " is not supported by the device, skipped"
+                  << std::endl;
+        return;
+    }
+    for (auto n : s.sizes({ 64, 256, 1024 })) {
+        getrf<T>(s, n);
+        potrf<T>(s, n);
+        geqrf<T>(s, n);
+    }
+    for (auto n : s.sizes({ 64, 256, 512 })) {
+        gesvd<T>(s, n);
+        syevd<T>(s, n);
+    }
+    for (auto l : { layout::packed, layout::padded, layout::group }) {
+        for (auto n : s.sizes({ 4, 8, 16, 32, 64 })) {
+            for (auto batch_size : s.sizes({ 1, 32, 1024 })) {
+                // Keeps every operand within 4M elements.
+                if (n * n * batch_size > (std::int64_t(1) << 22))
+                    continue;
+                getrf_batch<T>(s, l, n, batch_size);
+                getri_batch<T>(s, l, n, batch_size);
+                getrs_batch<T>(s, l, n, batch_size);
+                geqrf_batch<T>(s, l, n, batch_size);
+                orgqr_batch<T>(s, l, n, batch_size);
+                potrf_batch<T>(s, l, n, batch_size);
+                potrs_batch<T>(s, l, n, batch_size);
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    benchmark::options opts;
+    if (!benchmark::parse_options(argc, argv, opts))
+        return 1;
+
+    try {
+        sycl::queue queue((sycl::default_selector()));
+        session s{ queue, benchmark::reporter("lapack", opts, queue) };
+
+        run_type<float>(s);
+        run_type<double>(s);
+        run_type<std::complex<float>>(s);
+        run_type<std::complex<double>>(s);
+
+        if (!s.report.write_json())
+            return 1;
+    }
+    catch (sycl::exception const &e) {
+        std::cerr << "Caught synchronous SYCL exception:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        return 1;
+    }
+    catch (std::exception const &e) {
+        std::cerr << "Caught std::exception:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,277 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures the random number generation throughput of the
+*       philox4x32x10 and mrg32k3a engines with every distribution and method
+*       of distributions.hpp, with buffers and with USM, for 1K to 1G
+*       outputs, and the service operations of the engines:
+*
+*       - construction, including the initialization the engine submits to
+*         the queue,
+*       - skip_ahead,
+*       - copy_state, through the copy constructor of the engine.
+*
+*       Sizes whose output exceeds the maximum allocation size of the device
+*       are reported as skipped.
+*
+*       Usage: benchmark_rng [--json=<file>] [--filter=<text>] [--quick] ...
+*       See benchmark_common.hpp for the options. The device is selected with
+*       the SYCL default selector.
+*
+*******************************************************************************/
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/mkl.hpp"
+
+#include "benchmark_common.hpp"
+
+namespace rng = oneapi::mkl::rng;
+
+using benchmark::session;
+
+namespace benchmark {
+template <>
+inline const char *type_name<std::int32_t>() {
+    return "int32";
+}
+template <>
+inline const char *type_name<std::uint32_t>() {
+    return "uint32";
+}
+} // namespace benchmark
+
+template <typename Engine>
+const char *engine_name();
+template <>
+const char *engine_name<rng::philox4x32x10>() {
+    return "philox4x32x10";
+}
+template <>
+const char *engine_name<rng::mrg32k3a>() {
+    return "mrg32k3a";
+}
+
+constexpr std::uint32_t seed = 777;
+
+// Measures generate(distr, engine, n, r) with buffers and with USM for every
+//  output size. method is null for distributions without methods.
+template <typename Engine, typename Distr>
+void generate(session &s, Engine &engine, const char *distribution, const char *method,
+              const Distr &distr = Distr()) {
+    using T = typename Distr::result_type;
+    const std::uint64_t max_alloc_size =
+        s.queue.get_device().get_info<sycl::info::device::max_mem_alloc_size>();
+
+    for (auto n : s.sizes({ 1 << 10, 1 << 15, 1 << 20, 1 << 25, 1 << 30 })) {
+        for (bool use_usm : { false, true }) {
+            benchmark::result r;
+            r.routine = "generate";
+            r.labels = { { "engine", engine_name<Engine>() },
+                         { "distribution", distribution },
+                         { "type", benchmark::type_name<T>() } };
+            if (method)
+                r.labels.emplace_back("method", method);
+            r.labels.emplace_back("api", use_usm ? "usm" : "buffer");
+            r.parameters = { { "n", n } };
+            r.bytes = static_cast<double>(n) * sizeof(T);
+            r.items = static_cast<double>(n);
+
+            if (!benchmark::is_supported<T>(s.queue)) {
+                s.report.skip(r, std::string(benchmark::type_name<T>()) +
+                                     " is not supported by the device");
+                continue;
+            }
+            if (n * sizeof(T) > max_alloc_size) {
+                s.report.skip(r, "the output exceeds the maximum allocation size of the device");
+                continue;
+            }
+            if (!s.report.selected(r))
+                continue;
+
+            // The output is only written by the generator, so it is allocated
+            //  without being initialized.
+            if (use_usm) {
+                T *out = sycl::malloc_device<T>(n, s.queue);
+                s.report.run(r, [&]() { rng::generate(distr, engine, n, out).wait_and_throw(); });
+                sycl::free(out, s.queue);
+            }
+            else {
+                sycl::buffer<T, 1> out{ sycl::range<1>(n) };
+                s.report.run(r, [&]() {
+                    rng::generate(distr, engine, n, out);
+                    s.queue.wait_and_throw();
+                });
+            }
+        }
+    }
+}
+
+template <typename Engine>
+void run_engine(session &s) {
+    const char *name = engine_name<Engine>();
+
+    // The engines are held by pointer so that the destruction of the previous
+    //  one happens in the untimed setup.
+    std::unique_ptr<Engine> constructed;
+    s.report.run(
+        { "construction", { { "engine", name } } }, [&]() { constructed.reset(); },
+        [&]() {
+            constructed.reset(new Engine(s.queue, seed));
+            s.queue.wait_and_throw();
+        });
+    if (!constructed) {
+        std::cout << name << " is not available for the device, skipped" << std::endl;
+        return;
+    }
+    Engine &engine = *constructed;
+
+    for (std::int64_t num_to_skip : s.sizes({ 1 << 10, 1 << 20, std::int64_t(1) << 40 })) {
+        s.report.run({ "skip_ahead", { { "engine", name } }, { { "num_to_skip", num_to_skip } } },
+                     [&]() {
+                         rng::skip_ahead(engine, num_to_skip);
+                         s.queue.wait_and_throw();
+                     });
+    }
+
+    std::unique_ptr<Engine> copy;
+    s.report.run(
+        { "copy_state", { { "engine", name } } }, [&]() { copy.reset(); },
+        [&]() {
+            copy.reset(new Engine(engine));
+            s.queue.wait_and_throw();
+        });
+    copy.reset();
+
+    using namespace rng;
+    generate<Engine, uniform<float, uniform_method::standard>>(s, engine, "uniform", "standard");
+    generate<Engine, uniform<float, uniform_method::accurate>>(s, engine, "uniform", "accurate");
+    generate<Engine, uniform<double, uniform_method::standard>>(s, engine, "uniform", "standard");
+    generate<Engine, uniform<double, uniform_method::accurate>>(s, engine, "uniform", "accurate");
+    generate<Engine, uniform<std::int32_t, uniform_method::standard>>(s, engine, "uniform",
+                                                                      "standard");
+    generate<Engine, gaussian<float, gaussian_method::box_muller2>>(s, engine, "gaussian",
+                                                                    "box_muller2");
+    generate<Engine, gaussian<float, gaussian_method::icdf>>(s, engine, "gaussian", "icdf");
+    generate<Engine, gaussian<double, gaussian_method::box_muller2>>(s, engine, "gaussian",
+                                                                     "box_muller2");
+    generate<Engine, gaussian<double, gaussian_method::icdf>>(s, engine, "gaussian", "icdf");
+    generate<Engine, lognormal<float, lognormal_method::box_muller2>>(s, engine, "lognormal",
+                                                                      "box_muller2");
+    generate<Engine, lognormal<float, lognormal_method::icdf>>(s, engine, "lognormal", "icdf");
+    generate<Engine, lognormal<double, lognormal_method::box_muller2>>(s, engine, "lognormal",
+                                                                       "box_muller2");
+    generate<Engine, lognormal<double, lognormal_method::icdf>>(s, engine, "lognormal", "icdf");
+    generate<Engine, exponential<float, exponential_method::icdf>>(s, engine, "exponential",
+                                                                   "icdf");
+    generate<Engine, exponential<double, exponential_method::icdf>>(s, engine, "exponential",
+                                                                    "icdf");
+    generate<Engine, exponential<float, exponential_method::icdf_accurate>>(
+        s, engine, "exponential", "icdf_accurate");
+    generate<Engine, exponential<double, exponential_method::icdf_accurate>>(
+        s, engine, "exponential", "icdf_accurate");
+    // Qualified, as the C library also declares gamma
+    generate<Engine, rng::gamma<float, gamma_method::marsaglia>>(s, engine, "gamma", "marsaglia");
+    generate<Engine, rng::gamma<double, gamma_method::marsaglia>>(s, engine, "gamma", "marsaglia");
+    generate<Engine, rng::gamma<float, gamma_method::marsaglia_accurate>>(s, engine, "gamma",
+                                                                          "marsaglia_accurate");
+    generate<Engine, rng::gamma<double, gamma_method::marsaglia_accurate>>(s, engine, "gamma",
+                                                                           "marsaglia_accurate");
+    generate<Engine, beta<float, beta_method::cja>>(s, engine, "beta", "cja");
+    generate<Engine, beta<double, beta_method::cja>>(s, engine, "beta", "cja");
+    generate<Engine, beta<float, beta_method::cja_accurate>>(s, engine, "beta", "cja_accurate");
+    generate<Engine, beta<double, beta_method::cja_accurate>>(s, engine, "beta", "cja_accurate");
+    generate<Engine, cauchy<float, cauchy_method::icdf>>(s, engine, "cauchy", "icdf");
+    generate<Engine, cauchy<double, cauchy_method::icdf>>(s, engine, "cauchy", "icdf");
+    generate<Engine, weibull<float, weibull_method::icdf>>(s, engine, "weibull", "icdf");
+    generate<Engine, weibull<double, weibull_method::icdf>>(s, engine, "weibull", "icdf");
+    generate<Engine, weibull<float, weibull_method::icdf_accurate>>(s, engine, "weibull",
+                                                                    "icdf_accurate");
+    generate<Engine, weibull<double, weibull_method::icdf_accurate>>(s, engine, "weibull",
+                                                                     "icdf_accurate");
+    generate<Engine, bernoulli<std::int32_t, bernoulli_method::icdf>>(s, engine, "bernoulli",
+                                                                      "icdf");
+    generate<Engine, bernoulli<std::uint32_t, bernoulli_method::icdf>>(s, engine, "bernoulli",
+                                                                       "icdf");
+    generate<Engine, poisson<std::int32_t, poisson_method::gaussian_icdf_based>>(
+        s, engine, "poisson", "gaussian_icdf_based");
+    generate<Engine, poisson<std::uint32_t, poisson_method::gaussian_icdf_based>>(
+        s, engine, "poisson", "gaussian_icdf_based");
+    generate<Engine, geometric<std::int32_t, geometric_method::icdf>>(s, engine, "geometric",
+                                                                      "icdf");
+    generate<Engine, geometric<std::uint32_t, geometric_method::icdf>>(s, engine, "geometric",
+                                                                       "icdf");
+    // The alias table is built once, outside of the measurements
+    const std::vector<double> weights = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
+    generate<Engine, discrete<std::int32_t, discrete_method::alias>>(
+        s, engine, "discrete", "alias", discrete<std::int32_t, discrete_method::alias>(weights));
+    generate<Engine, discrete<std::uint32_t, discrete_method::alias>>(
+        s, engine, "discrete", "alias", discrete<std::uint32_t, discrete_method::alias>(weights));
+    // Each experiment writes one value per outcome, so n is a multiple of the 4 outcomes
+    const std::vector<double> p = { 0.1, 0.2, 0.3, 0.4 };
+    generate<Engine, multinomial<std::int32_t, multinomial_method::poisson_icdf_based>>(
+        s, engine, "multinomial", "poisson_icdf_based",
+        multinomial<std::int32_t, multinomial_method::poisson_icdf_based>(10, p));
+    generate<Engine, multinomial<std::uint32_t, multinomial_method::poisson_icdf_based>>(
+        s, engine, "multinomial", "poisson_icdf_based",
+        multinomial<std::uint32_t, multinomial_method::poisson_icdf_based>(10, p));
+    generate<Engine, bits<std::uint32_t>>(s, engine, "bits", nullptr);
+}
+
+int main(int argc, char **argv) {
+    benchmark::options opts;
+    if (!benchmark::parse_options(argc, argv, opts))
+        return 1;
+
+    try {
+        sycl::queue queue((sycl::default_selector()));
+        session s{ queue, benchmark::reporter("rng", opts, queue) };
+
+        run_engine<rng::philox4x32x10>(s);
+        run_engine<rng::mrg32k3a>(s);
+
+        if (!s.report.write_json())
+            return 1;
+    }
+    catch (sycl::exception const &e) {
+        std::cerr << "Caught synchronous SYCL exception:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        return 1;
+    }
+    catch (std::exception const &e) {
+        std::cerr << "Caught std::exception:" << std::endl;
+        std::cerr << "\t" << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Runs a chain of dependent USM level 1 and level 2 calls of the netlib
+*       backend on an in-order queue, with a queue.memcpy in the middle, and
+*       compares the results with reference_blas_templates.hpp. The calls are
+*       fused into shared host_tasks when ONEMKL_NETLIB_FUSION=1, which the
+*       NetlibFusion ctest entry sets; the call after the memcpy must still
+*       run after it.
+*
+*******************************************************************************/
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace sycl;
+using std::vector;
+
+extern std::vector<sycl::device *> devices;
+
+namespace {
+
+template <typename fp>
+int test(device *dev, int N) {
+    if (!dev->is_cpu())
+        return test_skipped;
+
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during netlib fusion:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler, property_list{ property::queue::in_order() });
+    context cxt = main_queue.get_context();
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua), A(ua), v(N, fp(0), ua), z(N, fp(0), ua);
+
+    rand_vector(x, N, 1);
+    rand_vector(y, N, 1);
+    rand_matrix(A, oneapi::mkl::layout::column_major, oneapi::mkl::transpose::nontrans, N, N, N);
+
+    const fp alpha(2.0), scale(0.5), one(1.0), zero(0.0), two(2.0);
+
+    // Call the reference chain.
+    const int N_ref = N, inc_ref = 1;
+    vector<fp> y_ref(y.begin(), y.end()), v_ref(N), z_ref(N);
+
+    ::axpy(&N_ref, &alpha, x.data(), &inc_ref, y_ref.data(), &inc_ref);
+    ::scal(&N_ref, &scale, y_ref.data(), &inc_ref);
+    ::gemv(CblasColMajor, CblasNoTrans, &N_ref, &N_ref, &one, A.data(), &N_ref, y_ref.data(),
+           &inc_ref, &zero, v_ref.data(), &inc_ref);
+    z_ref = y_ref;
+    ::scal(&N_ref, &two, y_ref.data(), &inc_ref);
+    ::axpy(&N_ref, &one, v_ref.data(), &inc_ref, z_ref.data(), &inc_ref);
+
+    // Call the chain on the netlib backend: the first calls rely on the order
+    //  of the queue or on the event of the previous call, the scal after the
+    //  memcpy overwrites the y it copies.
+    bool ordered = true;
+    try {
+        oneapi::mkl::backend_selector<oneapi::mkl::backend::netlib> selector{ main_queue };
+        namespace blas = oneapi::mkl::blas::column_major;
+
+        blas::axpy(selector, N, alpha, x.data(), 1, y.data(), 1);
+        event scaled = blas::scal(selector, N, scale, y.data(), 1);
+        event product = blas::gemv(selector, oneapi::mkl::transpose::nontrans, N, N, one,
+                                   A.data(), N, y.data(), 1, zero, v.data(), 1, { scaled });
+        main_queue.memcpy(z.data(), y.data(), N * sizeof(fp));
+        event doubled = blas::scal(selector, N, two, y.data(), 1);
+        blas::axpy(selector, N, one, v.data(), 1, z.data(), 1, { doubled }).wait_and_throw();
+
+        // A call submitted after the memcpy is never fused with the calls
+        //  before it.
+        ordered = doubled != product;
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during netlib fusion:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented &e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of netlib fusion:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+    if (!ordered)
+        std::cout << "The scal after the memcpy was fused with the calls before it" << std::endl;
+    bool good = ordered;
+    good = check_equal_vector(y, y_ref, N, 1, N, std::cout) && good;
+    good = check_equal_vector(v, v_ref, N, 1, N, std::cout) && good;
+    good = check_equal_vector(z, z_ref, N, 1, N, std::cout) && good;
+
+    return (int)good;
+}
+
+class NetlibFusionUsmTests : public ::testing::TestWithParam<sycl::device *> {};
+
+TEST_P(NetlibFusionUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test<float>(GetParam(), 1357));
+}
+
+TEST_P(NetlibFusionUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test<double>(GetParam(), 1357));
+}
+
+INSTANTIATE_TEST_SUITE_P(NetlibFusionUsmTestSuite, NetlibFusionUsmTests,
+                         testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,216 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Calls the gemm engine of the netlib backend directly and compares it
+*       with reference_blas_templates.hpp. The float, double and complex
+*       engine only serves the gemm calls of the backend when it is built
+*       with ENABLE_NETLIB_NATIVE_GEMM, so it is tested here in every
+*       configuration. The microkernels are those of the host CPU, capped by
+*       ONEMKL_NETLIB_GEMM_ISA. The integer gemm_bias engine is checked on a
+*       long k against an int64 reference.
+*
+*******************************************************************************/
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "allocator_helper.hpp"
+#include "cblas.h"
+#include "oneapi/mkl.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include "netlib_gemm.hpp"
+
+#include <gtest/gtest.h>
+
+using std::vector;
+
+namespace {
+
+template <typename fp>
+int test(oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+         oneapi::mkl::transpose transb, int m, int n, int k, int lda, int ldb, int ldc, fp alpha,
+         fp beta) {
+    // Prepare data.
+    vector<fp, allocator_helper<fp, 64>> A, B, C, C_ref;
+
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    C_ref = C;
+
+    // Call Reference GEMM.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+           convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref, (fp_ref*)&alpha,
+           (fp_ref*)A.data(), &lda_ref, (fp_ref*)B.data(), &ldb_ref, (fp_ref*)&beta,
+           (fp_ref*)C_ref.data(), &ldc_ref);
+
+    // Call the engine.
+    oneapi::mkl::blas::netlib::native_gemm(convert_to_cblas_layout(layout), transa, transb, m, n,
+                                           k, alpha, A.data(), lda, B.data(), ldb, beta, C.data(),
+                                           ldc);
+
+    // Compare the results of reference implementation and the engine.
+    bool good = check_equal_matrix(C, C_ref, layout, m, n, ldc, 10 * k, std::cout);
+
+    return (int)good;
+}
+
+// Runs every combination of transposes on a problem that fits in one block
+//  and on one that spans several blocks of m, n and k.
+template <typename fp>
+int test_all(oneapi::mkl::layout layout, fp alpha, fp beta,
+             std::initializer_list<oneapi::mkl::transpose> transposes) {
+    int status = test_passed;
+    for (auto transa : transposes) {
+        for (auto transb : transposes) {
+            if (!test(layout, transa, transb, 79, 83, 91, 103, 105, 106, alpha, beta) ||
+                !test(layout, transa, transb, 300, 70, 600, 603, 605, 606, alpha, beta)) {
+                std::cout << "transa = " << static_cast<int>(transa)
+                          << ", transb = " << static_cast<int>(transb) << std::endl;
+                status = 0;
+            }
+        }
+    }
+    return status;
+}
+
+// Integer gemm_bias with k = 70001 and |a - ao| = |b - bo| = 255: the sums of
+//  products reach 4.5e9, which only fit in the int64 accumulation of the engine.
+template <typename Ta, typename Tb>
+int test_bias_long_k(oneapi::mkl::layout layout, Ta a_value, Ta ao, Tb b_value, Tb bo) {
+    const int64_t m = 3, n = 2, k = 70001;
+    const bool column_major = layout == oneapi::mkl::layout::column_major;
+    const int64_t lda = column_major ? m : k, ldb = column_major ? k : n;
+    const int64_t ldc = column_major ? m : n;
+    const float alpha = 1e-4f, beta = 1.0f;
+    const int32_t co = 7;
+    vector<Ta> A(m * k, a_value);
+    vector<Tb> B(k * n, b_value);
+    vector<int32_t> C(m * n), C_ref(m * n);
+    for (int64_t i = 0; i < m * n; i++)
+        C[i] = static_cast<int32_t>(10 * i - 20);
+
+    // int64 reference
+    for (int64_t i = 0; i < m; i++) {
+        for (int64_t j = 0; j < n; j++) {
+            const int64_t ic = column_major ? i + j * ldc : i * ldc + j;
+            int64_t acc = 0;
+            for (int64_t l = 0; l < k; l++) {
+                const int64_t a_il = A[column_major ? i + l * lda : i * lda + l];
+                const int64_t b_lj = B[column_major ? l + j * ldb : l * ldb + j];
+                acc += (a_il - ao) * (b_lj - bo);
+            }
+            C_ref[ic] = static_cast<int32_t>(
+                std::nearbyint(double(alpha) * acc + double(beta) * C[ic]) + co);
+        }
+    }
+
+    oneapi::mkl::blas::netlib::native_gemm_bias(
+        convert_to_cblas_layout(layout), oneapi::mkl::transpose::nontrans,
+        oneapi::mkl::transpose::nontrans, oneapi::mkl::offset::fix, m, n, k, alpha, A.data(), lda,
+        ao, B.data(), ldb, bo, beta, C.data(), ldc, &co);
+
+    bool good = true;
+    for (int64_t i = 0; i < m * n; i++) {
+        if (C[i] != C_ref[i]) {
+            std::cout << "C[" << i << "] = " << C[i] << ", expected " << C_ref[i] << std::endl;
+            good = false;
+        }
+    }
+    return (int)good;
+}
+
+class LayoutNamePrint {
+public:
+    std::string operator()(testing::TestParamInfo<oneapi::mkl::layout> layout) const {
+        return layout.param == oneapi::mkl::layout::column_major ? "Column_Major" : "Row_Major";
+    }
+};
+
+class GemmNetlibEngineTests : public ::testing::TestWithParam<oneapi::mkl::layout> {};
+
+TEST_P(GemmNetlibEngineTests, RealSinglePrecision) {
+    float alpha(2.0);
+    float beta(3.0);
+    EXPECT_TRUEORSKIP((test_all<float>(
+        GetParam(), alpha, beta,
+        { oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans })));
+}
+
+TEST_P(GemmNetlibEngineTests, RealDoublePrecision) {
+    double alpha(2.0);
+    double beta(3.0);
+    EXPECT_TRUEORSKIP((test_all<double>(
+        GetParam(), alpha, beta,
+        { oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans })));
+}
+
+TEST_P(GemmNetlibEngineTests, ComplexSinglePrecision) {
+    std::complex<float> alpha(2.0, -0.5);
+    std::complex<float> beta(3.0, -1.5);
+    EXPECT_TRUEORSKIP((test_all<std::complex<float>>(
+        GetParam(), alpha, beta,
+        { oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans,
+          oneapi::mkl::transpose::conjtrans })));
+}
+
+TEST_P(GemmNetlibEngineTests, ComplexDoublePrecision) {
+    std::complex<double> alpha(2.0, -0.5);
+    std::complex<double> beta(3.0, -1.5);
+    EXPECT_TRUEORSKIP((test_all<std::complex<double>>(
+        GetParam(), alpha, beta,
+        { oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans,
+          oneapi::mkl::transpose::conjtrans })));
+}
+
+TEST_P(GemmNetlibEngineTests, IntegerBiasLongK) {
+    EXPECT_TRUEORSKIP((test_bias_long_k<int8_t, uint8_t>(GetParam(), int8_t(127), int8_t(-128),
+                                                         uint8_t(255), uint8_t(0))));
+    EXPECT_TRUEORSKIP((test_bias_long_k<int8_t, int8_t>(GetParam(), int8_t(-128), int8_t(127),
+                                                        int8_t(127), int8_t(-128))));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmNetlibEngineTestSuite, GemmNetlibEngineTests,
+                         testing::Values(oneapi::mkl::layout::column_major,
+                                         oneapi::mkl::layout::row_major),
+                         LayoutNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,159 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _RNG_TEST_LEAPFROG_TEST_HPP__
+#define _RNG_TEST_LEAPFROG_TEST_HPP__
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+
+#include "rng_test_common.hpp"
+
+template <typename Engine, typename Distr = oneapi::mkl::rng::bits<std::uint32_t>>
+class leapfrog_test {
+public:
+    using Type = typename Distr::result_type;
+
+    template <typename Queue>
+    void operator()(Queue queue) {
+        // Prepare arrays for random numbers
+        std::vector<Type> r1(N_GEN_SERVICE);
+        std::vector<Type> r2(N_GEN_SERVICE);
+
+        try {
+            // Initialize rng objects
+            Engine engine(queue);
+            std::vector<Engine*> engines;
+
+            Distr distr;
+
+            // Perform leapfrog
+            for (int i = 0; i < N_ENGINES; i++) {
+                engines.push_back(new Engine(queue));
+                oneapi::mkl::rng::leapfrog(*(engines[i]), i, N_ENGINES);
+            }
+
+            sycl::buffer<Type, 1> r_buffer(r1.data(), r1.size());
+            std::vector<sycl::buffer<Type, 1>> r_buffers;
+            for (int i = 0; i < N_ENGINES; i++) {
+                r_buffers.push_back(sycl::buffer<Type, 1>(r2.data() + i * N_PORTION, N_PORTION));
+            }
+
+            oneapi::mkl::rng::generate(distr, engine, N_GEN_SERVICE, r_buffer);
+            for (int i = 0; i < N_ENGINES; i++) {
+                oneapi::mkl::rng::generate(distr, *(engines[i]), N_PORTION, r_buffers[i]);
+            }
+
+            // Clear memory
+            for (int i = 0; i < N_ENGINES; i++) {
+                delete engines[i];
+            }
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl << e.what() << std::endl;
+            print_error_code(e);
+            status = test_failed;
+            return;
+        }
+
+        // Validation: engine i generates every N_ENGINES-th value from the i-th one
+        std::vector<Type> r_strided(N_GEN_SERVICE);
+        for (int i = 0; i < N_ENGINES; i++) {
+            for (int j = 0; j < N_PORTION; j++) {
+                r_strided[i * N_PORTION + j] = r1[j * N_ENGINES + i];
+            }
+        }
+        status = check_equal_vector(r_strided, r2);
+    }
+
+    int status = test_passed;
+};
+
+// skip_ahead after leapfrog skips values of the subsequence: the engine with
+//  leapfrog(stride - 1, stride) generates N_PORTION values, skips N_PORTION
+//  values of its subsequence and generates N_PORTION more.
+template <typename Engine, typename Distr = oneapi::mkl::rng::bits<std::uint32_t>>
+class leapfrog_skip_ahead_test {
+public:
+    using Type = typename Distr::result_type;
+
+    template <typename Queue>
+    void operator()(Queue queue, std::uint64_t stride) {
+        const std::uint64_t idx = stride - 1;
+
+        // Prepare arrays for random numbers
+        std::vector<Type> r1(3 * N_PORTION * stride);
+        std::vector<Type> r2(2 * N_PORTION);
+
+        try {
+            // Initialize rng objects
+            Engine engine(queue);
+            Engine leapfrog_engine(queue);
+
+            Distr distr;
+
+            oneapi::mkl::rng::leapfrog(leapfrog_engine, idx, stride);
+
+            sycl::buffer<Type, 1> r_buffer(r1.data(), r1.size());
+            sycl::buffer<Type, 1> r_first_buffer(r2.data(), N_PORTION);
+            sycl::buffer<Type, 1> r_second_buffer(r2.data() + N_PORTION, N_PORTION);
+
+            oneapi::mkl::rng::generate(distr, engine, r1.size(), r_buffer);
+            oneapi::mkl::rng::generate(distr, leapfrog_engine, N_PORTION, r_first_buffer);
+            oneapi::mkl::rng::skip_ahead(leapfrog_engine, N_PORTION);
+            oneapi::mkl::rng::generate(distr, leapfrog_engine, N_PORTION, r_second_buffer);
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl << e.what() << std::endl;
+            print_error_code(e);
+            status = test_failed;
+            return;
+        }
+
+        // Validation: values 0 to N_PORTION - 1 and 2 * N_PORTION to
+        //  3 * N_PORTION - 1 of the subsequence
+        std::vector<Type> r_strided(2 * N_PORTION);
+        for (int j = 0; j < N_PORTION; j++) {
+            r_strided[j] = r1[idx + j * stride];
+            r_strided[N_PORTION + j] = r1[idx + (2 * N_PORTION + j) * stride];
+        }
+        status = check_equal_vector(r_strided, r2);
+    }
+
+    int status = test_passed;
+};
+
+#endif // _RNG_TEST_LEAPFROG_TEST_HPP__
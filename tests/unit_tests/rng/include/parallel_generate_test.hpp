@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _RNG_TEST_PARALLEL_GENERATE_TEST_HPP__
+#define _RNG_TEST_PARALLEL_GENERATE_TEST_HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/mkl.hpp"
+
+#include "rng_test_common.hpp"
+
+// Large calls may be split into chunks generated in parallel by a backend: one
+//  call of N_GEN_LARGE values followed by one of N_GEN values must produce the
+//  same values as calls of N_GEN values on an engine with the same seed, which
+//  also checks the state of the engine after the large call.
+template <typename Engine, typename Distr>
+class parallel_generate_test {
+public:
+    using Type = typename Distr::result_type;
+
+    template <typename Queue>
+    void operator()(Queue queue) {
+        // Prepare arrays for random numbers
+        std::vector<Type> r1(N_GEN_LARGE + N_GEN);
+        std::vector<Type> r2(N_GEN_LARGE + N_GEN);
+
+        try {
+            // Initialize rng objects
+            Engine engine1(queue, SEED);
+            Engine engine2(queue, SEED);
+
+            Distr distr;
+
+            sycl::buffer<Type, 1> r_large_buffer(r1.data(), N_GEN_LARGE);
+            sycl::buffer<Type, 1> r_next_buffer(r1.data() + N_GEN_LARGE, N_GEN);
+            oneapi::mkl::rng::generate(distr, engine1, N_GEN_LARGE, r_large_buffer);
+            oneapi::mkl::rng::generate(distr, engine1, N_GEN, r_next_buffer);
+
+            std::vector<sycl::buffer<Type, 1>> r_buffers;
+            for (std::size_t i = 0; i < r2.size(); i += N_GEN) {
+                const std::int64_t n = std::min<std::size_t>(N_GEN, r2.size() - i);
+                r_buffers.push_back(sycl::buffer<Type, 1>(r2.data() + i, n));
+                oneapi::mkl::rng::generate(distr, engine2, n, r_buffers.back());
+            }
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl << e.what() << std::endl;
+            print_error_code(e);
+            status = test_failed;
+            return;
+        }
+
+        // Validation
+        status = check_equal_vector(r1, r2);
+    }
+
+    int status = test_passed;
+};
+
+template <typename Engine, typename Distr>
+class parallel_generate_usm_test {
+public:
+    using Type = typename Distr::result_type;
+
+    template <typename Queue>
+    void operator()(Queue queue) {
+#ifdef CALL_RT_API
+        auto ua = sycl::usm_allocator<Type, sycl::usm::alloc::shared, 64>(queue);
+#else
+        auto ua = sycl::usm_allocator<Type, sycl::usm::alloc::shared, 64>(queue.get_queue());
+#endif
+        // Prepare arrays for random numbers
+        std::vector<Type, decltype(ua)> r1(N_GEN_LARGE + N_GEN, ua);
+        std::vector<Type, decltype(ua)> r2(N_GEN_LARGE + N_GEN, ua);
+
+        try {
+            // Initialize rng objects
+            Engine engine1(queue, SEED);
+            Engine engine2(queue, SEED);
+
+            Distr distr;
+
+            oneapi::mkl::rng::generate(distr, engine1, N_GEN_LARGE, r1.data());
+            oneapi::mkl::rng::generate(distr, engine1, N_GEN, r1.data() + N_GEN_LARGE)
+                .wait_and_throw();
+
+            for (std::size_t i = 0; i < r2.size(); i += N_GEN) {
+                const std::int64_t n = std::min<std::size_t>(N_GEN, r2.size() - i);
+                oneapi::mkl::rng::generate(distr, engine2, n, r2.data() + i).wait_and_throw();
+            }
+        }
+        catch (const oneapi::mkl::unimplemented& e) {
+            status = test_skipped;
+            return;
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "SYCL exception during generation" << std::endl << e.what() << std::endl;
+            print_error_code(e);
+            status = test_failed;
+            return;
+        }
+
+        // Validation
+        status = check_equal_vector(r1, r2);
+    }
+
+    int status = test_passed;
+};
+
+#endif // _RNG_TEST_PARALLEL_GENERATE_TEST_HPP__
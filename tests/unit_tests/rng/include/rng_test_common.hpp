@@ -28,10 +28,17 @@
 #define SEED  777
 #define N_GEN 1000
 
+// Size of the large calls of the parallel generation tests, above the size from
+//  which backends may split a call across threads
+#define N_GEN_LARGE ((1 << 18) + 2)
+
 // Defines for skip_ahead and leapfrog tests
 #define N_ENGINES     5
 #define N_PORTION     100
 #define N_GEN_SERVICE (N_ENGINES * N_PORTION)
+// Leapfrog stride beyond which the values of the subsequence are skipped to
+//  rather than generated and discarded
+#define LEAPFROG_LARGE_STRIDE 97
 
 // defines for skip_ahead_ex tests
 #define N_SKIP     ((std::uint64_t)pow(2, 62))
@@ -20,6 +20,8 @@
 #ifndef _RNG_TEST_STATISTICS_CHECK_HPP__
 #define _RNG_TEST_STATISTICS_CHECK_HPP__
 
+#include <cmath>
+
 #if __has_include(<sycl/sycl.hpp>)
 #include <sycl/sycl.hpp>
 #else
@@ -176,4 +178,193 @@ struct statistics<oneapi::mkl::rng::poisson<Type, Method>> {
     }
 };
 
+template <typename Type, typename Method>
+struct statistics<oneapi::mkl::rng::exponential<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::mkl::rng::exponential<Type, Method>& distr) {
+        double tM, tD, tQ;
+        double a = distr.a();
+        double beta = distr.beta();
+
+        // Theoretical moments
+        tM = a + beta;
+        tD = beta * beta;
+        tQ = 9.0 * beta * beta * beta * beta;
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Type, typename Method>
+struct statistics<oneapi::mkl::rng::gamma<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::mkl::rng::gamma<Type, Method>& distr) {
+        double tM, tD, tQ;
+        double alpha = distr.alpha();
+        double a = distr.a();
+        double beta = distr.beta();
+
+        // Theoretical moments
+        tM = a + alpha * beta;
+        tD = alpha * beta * beta;
+        tQ = 3.0 * alpha * (alpha + 2.0) * beta * beta * beta * beta;
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Type, typename Method>
+struct statistics<oneapi::mkl::rng::beta<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::mkl::rng::beta<Type, Method>& distr) {
+        double tM, tD, tQ;
+        double p = distr.p();
+        double q = distr.q();
+        double a = distr.a();
+        double b = distr.b();
+        double s = p + q;
+
+        // Theoretical moments
+        tM = a + b * p / s;
+        tD = b * b * p * q / (s * s * (s + 1.0));
+        tQ = b * b * b * b * 3.0 * p * q * (p * q * (s - 6.0) + 2.0 * s * s) /
+             (s * s * s * s * (s + 1.0) * (s + 2.0) * (s + 3.0));
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Type, typename Method>
+struct statistics<oneapi::mkl::rng::cauchy<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::mkl::rng::cauchy<Type, Method>& distr) {
+        double a = distr.a();
+        double b = distr.b();
+
+        // The distribution has no moments, so the fractions of the sample
+        //  below its quartiles a - b, a and a + b are compared with theory
+        const double x[3] = { a - b, a, a + b };
+        const double tF[3] = { 0.25, 0.5, 0.75 };
+        double n = (double)r.size();
+        for (int q = 0; q < 3; q++) {
+            double count = 0.0;
+            for (std::size_t i = 0; i < r.size(); i++) {
+                if ((double)r[i] < x[q])
+                    count += 1.0;
+            }
+            double sF = count / n;
+            double Delta = (tF[q] - sF) / sqrt(tF[q] * (1.0 - tF[q]) / n);
+            if (fabs(Delta) > 4.0) {
+                std::cout << "Error: sample fraction below " << x[q] << " (" << sF
+                          << ") disagrees with theory (" << tF[q] << ")"
+                          << " N_GEN = " << r.size() << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <typename Type, typename Method>
+struct statistics<oneapi::mkl::rng::weibull<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::mkl::rng::weibull<Type, Method>& distr) {
+        double tM, tD, tQ;
+        double alpha = distr.alpha();
+        double a = distr.a();
+        double beta = distr.beta();
+
+        // Raw moments of the standard Weibull distribution
+        double m1 = std::tgamma(1.0 + 1.0 / alpha);
+        double m2 = std::tgamma(1.0 + 2.0 / alpha);
+        double m3 = std::tgamma(1.0 + 3.0 / alpha);
+        double m4 = std::tgamma(1.0 + 4.0 / alpha);
+
+        // Theoretical moments
+        tM = a + beta * m1;
+        tD = beta * beta * (m2 - m1 * m1);
+        tQ = beta * beta * beta * beta *
+             (m4 - 4.0 * m1 * m3 + 6.0 * m1 * m1 * m2 - 3.0 * m1 * m1 * m1 * m1);
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Type, typename Method>
+struct statistics<oneapi::mkl::rng::geometric<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::mkl::rng::geometric<Type, Method>& distr) {
+        double tM, tD, tQ;
+        double p = distr.p();
+        double q = 1.0 - p;
+
+        // Theoretical moments
+        tM = q / p;
+        tD = q / (p * p);
+        tQ = q * (p * p - 9.0 * p + 9.0) / (p * p * p * p);
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Type, typename Method>
+struct statistics<oneapi::mkl::rng::discrete<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::mkl::rng::discrete<Type, Method>& distr) {
+        double tM = 0.0, tD = 0.0, tQ = 0.0;
+        const std::vector<double>& p = distr.p();
+
+        // Theoretical moments of the normalized weights
+        for (std::size_t i = 0; i < p.size(); i++)
+            tM += p[i] * i;
+        for (std::size_t i = 0; i < p.size(); i++) {
+            double d = i - tM;
+            tD += p[i] * d * d;
+            tQ += p[i] * d * d * d * d;
+        }
+
+        return compare_moments(r, tM, tD, tQ);
+    }
+};
+
+template <typename Type, typename Method>
+struct statistics<oneapi::mkl::rng::multinomial<Type, Method>> {
+    template <typename AllocType>
+    bool check(std::vector<Type, AllocType>& r,
+               const oneapi::mkl::rng::multinomial<Type, Method>& distr) {
+        double tM, tD, tQ;
+        const std::size_t k = distr.p().size();
+        double n = distr.ntrial();
+        double p = distr.p()[0];
+
+        // Every experiment distributes all of the trials
+        std::vector<Type> first;
+        for (std::size_t i = 0; i < r.size(); i += k) {
+            std::int64_t sum = 0;
+            for (std::size_t j = 0; j < k; j++)
+                sum += r[i + j];
+            if (sum != distr.ntrial()) {
+                std::cout << "Error: experiment " << i / k << " has " << sum
+                          << " trials instead of " << distr.ntrial() << std::endl;
+                return false;
+            }
+            first.push_back(r[i]);
+        }
+
+        // The first outcome count of the experiments is binomial(ntrial, p[0])
+        tM = n * p;
+        tD = n * p * (1.0 - p);
+        tQ = n * p * (1.0 - p) * (1.0 + 3.0 * (n - 2.0) * p * (1.0 - p));
+
+        return compare_moments(first, tM, tD, tQ);
+    }
+};
+
 #endif // _RNG_TEST_STATISTICS_CHECK_HPP__
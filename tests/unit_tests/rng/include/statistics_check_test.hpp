@@ -44,10 +44,31 @@
 #define LOGNORMAL_ARGS_FLOAT  -1.0f, 5.0f, 1.0f, 2.0f
 #define LOGNORMAL_ARGS_DOUBLE -1.0, 5.0, 1.0, 2.0
 
+#define EXPONENTIAL_ARGS_FLOAT  -1.0f, 5.0f
+#define EXPONENTIAL_ARGS_DOUBLE -1.0, 5.0
+
+#define GAMMA_ARGS_FLOAT  2.0f, -1.0f, 5.0f
+#define GAMMA_ARGS_DOUBLE 2.0, -1.0, 5.0
+
+#define BETA_ARGS_FLOAT  2.0f, 3.0f, -1.0f, 5.0f
+#define BETA_ARGS_DOUBLE 2.0, 3.0, -1.0, 5.0
+
+#define CAUCHY_ARGS_FLOAT  -1.0f, 5.0f
+#define CAUCHY_ARGS_DOUBLE -1.0, 5.0
+
+#define WEIBULL_ARGS_FLOAT  2.0f, -1.0f, 5.0f
+#define WEIBULL_ARGS_DOUBLE 2.0, -1.0, 5.0
+
 #define BERNOULLI_ARGS 0.5f
 
 #define POISSON_ARGS 0.5
 
+#define GEOMETRIC_ARGS 0.5f
+
+#define DISCRETE_ARGS std::vector<double>({ 1.0, 2.0, 3.0, 4.0 })
+
+#define MULTINOMIAL_ARGS 10, std::vector<double>({ 0.1, 0.2, 0.3, 0.4 })
+
 template <typename Distr, typename Engine>
 class statistics_test {
 public:
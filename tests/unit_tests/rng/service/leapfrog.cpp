@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "leapfrog_test.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+class Philox4x32x10LeapfrogTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10LeapfrogTests, BinaryPrecision) {
+    rng_test<leapfrog_test<oneapi::mkl::rng::philox4x32x10>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+TEST_P(Philox4x32x10LeapfrogTests, IntegerPrecision) {
+    rng_test<leapfrog_test<oneapi::mkl::rng::philox4x32x10,
+                           oneapi::mkl::rng::poisson<std::uint32_t>>>
+        test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+TEST_P(Philox4x32x10LeapfrogTests, SkipAheadBinaryPrecision) {
+    rng_test<leapfrog_skip_ahead_test<oneapi::mkl::rng::philox4x32x10>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), N_ENGINES)));
+    rng_test<leapfrog_skip_ahead_test<oneapi::mkl::rng::philox4x32x10>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam(), LEAPFROG_LARGE_STRIDE)));
+}
+
+TEST_P(Philox4x32x10LeapfrogTests, SkipAheadIntegerPrecision) {
+    rng_test<leapfrog_skip_ahead_test<oneapi::mkl::rng::philox4x32x10,
+                                      oneapi::mkl::rng::poisson<std::uint32_t>>>
+        test;
+    EXPECT_TRUEORSKIP((test(GetParam(), N_ENGINES)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10LeapfrogTestSuite, Philox4x32x10LeapfrogTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mrg32k3aLeapfrogTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mrg32k3aLeapfrogTests, BinaryPrecision) {
+    rng_test<leapfrog_test<oneapi::mkl::rng::mrg32k3a>> test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+TEST_P(Mrg32k3aLeapfrogTests, IntegerPrecision) {
+    rng_test<leapfrog_test<oneapi::mkl::rng::mrg32k3a,
+                           oneapi::mkl::rng::poisson<std::uint32_t>>>
+        test;
+    EXPECT_TRUEORSKIP((test(GetParam())));
+}
+
+TEST_P(Mrg32k3aLeapfrogTests, SkipAheadBinaryPrecision) {
+    rng_test<leapfrog_skip_ahead_test<oneapi::mkl::rng::mrg32k3a>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam(), N_ENGINES)));
+    rng_test<leapfrog_skip_ahead_test<oneapi::mkl::rng::mrg32k3a>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam(), LEAPFROG_LARGE_STRIDE)));
+}
+
+TEST_P(Mrg32k3aLeapfrogTests, SkipAheadIntegerPrecision) {
+    rng_test<leapfrog_skip_ahead_test<oneapi::mkl::rng::mrg32k3a,
+                                      oneapi::mkl::rng::poisson<std::uint32_t>>>
+        test;
+    EXPECT_TRUEORSKIP((test(GetParam(), N_ENGINES)));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mrg32k3aLeapfrogTestSuite, Mrg32k3aLeapfrogTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
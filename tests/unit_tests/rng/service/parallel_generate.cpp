@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "parallel_generate_test.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+using uniform_float = oneapi::mkl::rng::uniform<float>;
+using uniform_double = oneapi::mkl::rng::uniform<double>;
+using gaussian_float =
+    oneapi::mkl::rng::gaussian<float, oneapi::mkl::rng::gaussian_method::box_muller2>;
+using gaussian_double =
+    oneapi::mkl::rng::gaussian<double, oneapi::mkl::rng::gaussian_method::box_muller2>;
+using bits = oneapi::mkl::rng::bits<std::uint32_t>;
+
+class Philox4x32x10ParallelGenerateTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Philox4x32x10ParallelGenerateTests, UniformSinglePrecision) {
+    rng_test<parallel_generate_test<oneapi::mkl::rng::philox4x32x10, uniform_float>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_test<parallel_generate_usm_test<oneapi::mkl::rng::philox4x32x10, uniform_float>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+TEST_P(Philox4x32x10ParallelGenerateTests, UniformDoublePrecision) {
+    rng_test<parallel_generate_test<oneapi::mkl::rng::philox4x32x10, uniform_double>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_test<parallel_generate_usm_test<oneapi::mkl::rng::philox4x32x10, uniform_double>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+TEST_P(Philox4x32x10ParallelGenerateTests, GaussianSinglePrecision) {
+    rng_test<parallel_generate_test<oneapi::mkl::rng::philox4x32x10, gaussian_float>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_test<parallel_generate_usm_test<oneapi::mkl::rng::philox4x32x10, gaussian_float>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+TEST_P(Philox4x32x10ParallelGenerateTests, GaussianDoublePrecision) {
+    rng_test<parallel_generate_test<oneapi::mkl::rng::philox4x32x10, gaussian_double>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_test<parallel_generate_usm_test<oneapi::mkl::rng::philox4x32x10, gaussian_double>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+TEST_P(Philox4x32x10ParallelGenerateTests, BinaryPrecision) {
+    rng_test<parallel_generate_test<oneapi::mkl::rng::philox4x32x10, bits>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_test<parallel_generate_usm_test<oneapi::mkl::rng::philox4x32x10, bits>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Philox4x32x10ParallelGenerateTestSuite, Philox4x32x10ParallelGenerateTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+class Mrg32k3aParallelGenerateTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(Mrg32k3aParallelGenerateTests, UniformSinglePrecision) {
+    rng_test<parallel_generate_test<oneapi::mkl::rng::mrg32k3a, uniform_float>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_test<parallel_generate_usm_test<oneapi::mkl::rng::mrg32k3a, uniform_float>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+TEST_P(Mrg32k3aParallelGenerateTests, UniformDoublePrecision) {
+    rng_test<parallel_generate_test<oneapi::mkl::rng::mrg32k3a, uniform_double>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_test<parallel_generate_usm_test<oneapi::mkl::rng::mrg32k3a, uniform_double>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+TEST_P(Mrg32k3aParallelGenerateTests, GaussianSinglePrecision) {
+    rng_test<parallel_generate_test<oneapi::mkl::rng::mrg32k3a, gaussian_float>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_test<parallel_generate_usm_test<oneapi::mkl::rng::mrg32k3a, gaussian_float>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+TEST_P(Mrg32k3aParallelGenerateTests, GaussianDoublePrecision) {
+    rng_test<parallel_generate_test<oneapi::mkl::rng::mrg32k3a, gaussian_double>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_test<parallel_generate_usm_test<oneapi::mkl::rng::mrg32k3a, gaussian_double>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+TEST_P(Mrg32k3aParallelGenerateTests, BinaryPrecision) {
+    rng_test<parallel_generate_test<oneapi::mkl::rng::mrg32k3a, bits>> test1;
+    EXPECT_TRUEORSKIP((test1(GetParam())));
+    rng_test<parallel_generate_usm_test<oneapi::mkl::rng::mrg32k3a, bits>> test2;
+    EXPECT_TRUEORSKIP((test2(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(Mrg32k3aParallelGenerateTestSuite, Mrg32k3aParallelGenerateTests,
+                         ::testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace